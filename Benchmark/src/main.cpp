@@ -0,0 +1,280 @@
+#include "Prerequisites.hpp"
+#include "Game.hpp"
+#include "FrameArena.hpp"
+#include "Image.hpp"
+#include "PNGCodec.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+
+// Runs every benchmark and prints the results as JSON on stdout. An
+// optional argument only runs benchmarks whose name contains it.
+
+const double MIN_SAMPLE_TIME = 0.05;
+const unsigned int SAMPLE_COUNT = 5;
+
+// Results are folded into this so the work can't be optimized away.
+volatile uint64_t sink;
+
+struct Result
+{
+	std::string name;
+	uint64_t iterations;
+	double nsPerOp;
+	double bytesPerSec;
+};
+
+static double Now()
+{
+	return std::chrono::duration<double>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Doubles the iteration count until a sample takes long enough, then
+// reports the median of a few samples.
+template<class F>
+static Result Run(const std::string &name, size_t bytesPerOp, F func)
+{
+	uint64_t iterations = 1;
+	double time = 0.0;
+
+	for (;;)
+	{
+		double start = Now();
+
+		for (uint64_t i = 0; i < iterations; ++i)
+			func(i);
+
+		time = Now() - start;
+
+		if (time >= MIN_SAMPLE_TIME)
+			break;
+
+		iterations *= 2;
+	}
+
+	std::vector<double> samples;
+
+	for (unsigned int s = 0; s < SAMPLE_COUNT; ++s)
+	{
+		double start = Now();
+
+		for (uint64_t i = 0; i < iterations; ++i)
+			func(i);
+
+		samples.push_back((Now() - start) / iterations);
+	}
+
+	std::sort(samples.begin(), samples.end());
+	double secondsPerOp = samples[SAMPLE_COUNT / 2];
+
+	Result result;
+	result.name = name;
+	result.iterations = iterations;
+	result.nsPerOp = secondsPerOp * 1e9;
+	result.bytesPerSec = bytesPerOp > 0 ? bytesPerOp / secondsPerOp : 0.0;
+	return result;
+}
+
+template<class F>
+static void Add(std::vector<Result> &results, const std::string &filter,
+	const std::string &name, size_t bytesPerOp, F func)
+{
+	if (filter.empty() || name.find(filter) != std::string::npos)
+		results.push_back(Run(name, bytesPerOp, func));
+}
+
+// Fixed board used by the game benchmarks: the lower half filled with a
+// hole in every other row, so half of those rows count as full lines.
+template<unsigned int Width, unsigned int Height>
+static void FillBoard(Board<Width, Height> &board, Color *color)
+{
+	typedef Board<Width, Height> BoardType;
+
+	for (int32_t i = 0; i < BoardType::ROWS; i++)
+	{
+		for (int32_t j = 0; j < BoardType::COLUMNS; j++)
+		{
+			bool filled = i >= BoardType::ROWS - BoardType::VISIBLE_ROWS / 2 &&
+				(i % 2 == 0 || j != i % BoardType::COLUMNS);
+			board.set(i, j, filled ? color : nullptr);
+		}
+	}
+}
+
+// Deterministic gradient with some noise, similar in entropy to game art.
+static void FillImage(std::vector<uint8_t> &bytes, unsigned int width, unsigned int height,
+	unsigned int channels)
+{
+	uint32_t seed = 12345;
+	bytes.resize(static_cast<size_t>(width) * height * channels);
+
+	for (unsigned int y = 0; y < height; y++)
+	{
+		for (unsigned int x = 0; x < width; x++)
+		{
+			for (unsigned int c = 0; c < channels; c++)
+			{
+				seed = seed * 1664525u + 1013904223u;
+				uint8_t value = static_cast<uint8_t>((x * (c + 1) + y * 2) + (seed >> 29));
+				bytes[(static_cast<size_t>(y) * width + x) * channels + c] = c == 3 ? 255 : value;
+			}
+		}
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	std::string filter = argc > 1 ? argv[1] : "";
+	std::vector<Result> results;
+
+	Color color = { 1.0f, 0.0f, 0.0f, 1.0f };
+	GameBoard board;
+	// Large board variant, one 64 bit mask a row.
+	std::unique_ptr<Board<64, 20>> wideBoard(new Board<64, 20>());
+	Color* tetramino[4][4] =
+	{
+		{ nullptr, nullptr, nullptr, nullptr },
+		{ nullptr, &color, nullptr, nullptr },
+		{ &color, &color, &color, nullptr },
+		{ nullptr, nullptr, nullptr, nullptr }
+	};
+
+	FillBoard(board, &color);
+	FillBoard(*wideBoard, &color);
+
+	Add(results, filter, "CheckCollision", 0, [&](uint64_t i)
+	{
+		sink += CheckCollision(board, tetramino, static_cast<int32_t>(i % 8), static_cast<int32_t>(i % 20));
+	});
+
+	Add(results, filter, "CheckCollision/64x20", 0, [&](uint64_t i)
+	{
+		sink += CheckCollision(*wideBoard, tetramino, static_cast<int32_t>(i % 62), static_cast<int32_t>(i % 20));
+	});
+
+	uint8_t columnTops[GameBoard::COLUMNS];
+	GetColumnTops(board, columnTops);
+
+	Add(results, filter, "GetDropDistance", 0, [&](uint64_t i)
+	{
+		sink += GetDropDistance(board, columnTops, tetramino, static_cast<int32_t>(i % 8), 0);
+	});
+
+	Add(results, filter, "PlaceRemoveTetramino", 0, [&](uint64_t i)
+	{
+		int32_t x = static_cast<int32_t>(i % 8);
+		PlaceTetramino(board, tetramino, x, 2);
+		RemoveTetramino(board, tetramino, x, 2);
+	});
+
+	Add(results, filter, "LookForLines", 0, [&](uint64_t i)
+	{
+		int32_t lines[4];
+		LookForLines(board, lines);
+		sink += lines[0];
+	});
+
+	Add(results, filter, "LookForLines/64x20", 0, [&](uint64_t i)
+	{
+		int32_t lines[4];
+		LookForLines(*wideBoard, lines);
+		sink += lines[0];
+	});
+
+	// Moving rows doesn't depend on their contents, so the same board is
+	// reused even though it changes.
+	Add(results, filter, "RemoveLine", 0, [&](uint64_t i)
+	{
+		RemoveLine(board, GameBoard::ROWS - 1);
+	});
+
+	FillBoard(board, &color);
+
+	{
+		FrameArena arena(64 * 1024);
+		size_t vertexBytes = 0;
+
+		{
+			FrameVector<Vertex> vertices{ FrameAllocator<Vertex>(arena) };
+			BuildBlockVertices(board, 255.0f, 10.0f, 290.0f, 580.0f, vertices);
+			vertexBytes = vertices.size() * sizeof(Vertex);
+		}
+
+		Add(results, filter, "BuildBlockVertices", vertexBytes, [&](uint64_t i)
+		{
+			arena.reset();
+			FrameVector<Vertex> vertices{ FrameAllocator<Vertex>(arena) };
+			vertices.reserve(GameBoard::VISIBLE_ROWS * GameBoard::COLUMNS * 6);
+			BuildBlockVertices(board, 255.0f, 10.0f, 290.0f, 580.0f, vertices);
+			sink += vertices.size();
+		});
+	}
+
+	{
+		std::vector<uint8_t> bytes;
+		Image image;
+
+		FillImage(bytes, 1024, 1024, 4);
+		image.create(1024, 1024, ColorFormat::RGBA8, bytes);
+
+		Add(results, filter, "Image::flipVerticaly/1024x1024/RGBA8", bytes.size(), [&](uint64_t i)
+		{
+			image.flipVerticaly();
+		});
+
+		Add(results, filter, "Image::setPixel/RGBA8", 4, [&](uint64_t i)
+		{
+			uint8_t pixel[4] = { static_cast<uint8_t>(i), 0, 0, 255 };
+			image.setPixel(static_cast<unsigned int>(i % 1024), static_cast<unsigned int>((i / 1024) % 1024), pixel);
+		});
+	}
+
+	// The corpus is generated and encoded up front, so every run decodes
+	// exactly the same files.
+	struct CorpusEntry
+	{
+		unsigned int size;
+		unsigned int channels;
+	};
+
+	const CorpusEntry CORPUS[] = { { 64, 4 }, { 256, 3 }, { 256, 4 }, { 1024, 4 } };
+
+	for (const CorpusEntry &entry : CORPUS)
+	{
+		std::vector<uint8_t> bytes;
+		std::vector<uint8_t> encoded;
+		PNGCodec codec;
+
+		FillImage(bytes, entry.size, entry.size, entry.channels);
+		codec.encode(bytes.data(), entry.size, entry.size,
+			entry.channels == 4 ? ColorFormat::RGBA8 : ColorFormat::RGB8, &encoded);
+
+		char name[64];
+		snprintf(name, sizeof(name), "PNGCodec::decode/%ux%u/%s", entry.size, entry.size,
+			entry.channels == 4 ? "RGBA8" : "RGB8");
+
+		Add(results, filter, name, bytes.size(), [&](uint64_t i)
+		{
+			std::vector<uint8_t> decoded;
+			unsigned int width, height;
+			ColorFormat format;
+
+			codec.decode(encoded, &decoded, &width, &height, &format, 0);
+			sink += decoded.size();
+		});
+	}
+
+	printf("{\n  \"benchmarks\": [\n");
+
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		printf("    { \"name\": \"%s\", \"iterations\": %llu, \"ns_per_op\": %.3f, \"bytes_per_sec\": %.1f }%s\n",
+			results[i].name.c_str(), static_cast<unsigned long long>(results[i].iterations),
+			results[i].nsPerOp, results[i].bytesPerSec, i + 1 < results.size() ? "," : "");
+	}
+
+	printf("  ]\n}\n");
+	return 0;
+}
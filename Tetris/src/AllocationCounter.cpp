@@ -0,0 +1,81 @@
+#include "AllocationCounter.hpp"
+
+#ifdef TRACK_ALLOCATIONS
+#include <cstdlib>
+#include <new>
+
+// Per thread, worker threads are free to allocate.
+static thread_local uint64_t allocationCount = 0;
+
+uint64_t GetAllocationCount()
+{
+	return allocationCount;
+}
+
+static void* CountedAllocate(size_t size)
+{
+	++allocationCount;
+	return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new(size_t size)
+{
+	void *ptr = CountedAllocate(size);
+
+	if (ptr == nullptr)
+		throw std::bad_alloc();
+
+	return ptr;
+}
+
+void* operator new[](size_t size)
+{
+	void *ptr = CountedAllocate(size);
+
+	if (ptr == nullptr)
+		throw std::bad_alloc();
+
+	return ptr;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+	return CountedAllocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+	return CountedAllocate(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t&) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t&) noexcept
+{
+	std::free(ptr);
+}
+
+#endif // TRACK_ALLOCATIONS
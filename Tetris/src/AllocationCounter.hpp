@@ -0,0 +1,16 @@
+#ifndef ALLOCATION_COUNTER_HPP
+#define ALLOCATION_COUNTER_HPP
+#include "Prerequisites.hpp"
+
+// Debug builds replace the global operator new to count heap allocations,
+// so steady state frames can be checked to allocate nothing.
+#ifdef _DEBUG
+#define TRACK_ALLOCATIONS
+#endif
+
+#ifdef TRACK_ALLOCATIONS
+// Allocations made so far by the calling thread.
+uint64_t GetAllocationCount();
+#endif
+
+#endif // ALLOCATION_COUNTER_HPP
@@ -0,0 +1,81 @@
+#include "BitmapFont.hpp"
+#include "Image.hpp"
+#include "PNGCodec.hpp"
+
+BitmapFont::BitmapFont() : mGlyphWidth(0), mGlyphHeight(0), mFirstChar(' ')
+{
+}
+
+BitmapFont::~BitmapFont()
+{
+}
+
+bool BitmapFont::loadFromFile(std::string fileName, TextureAtlas &atlas,
+	unsigned int columns, unsigned int rows, char firstChar)
+{
+	Image img;
+	PNGCodec codec;
+	AtlasRegion region;
+
+	if (img.loadFromFile(fileName, &codec) == false)
+	{
+		// TODO: Error handling.
+		return false;
+	}
+
+	img.convert(ColorFormat::RGBA8);
+
+	if (atlas.insert(img, &region) == false)
+	{
+		// TODO: Error handling.
+		return false;
+	}
+
+	mGlyphWidth = img.getWidth() / columns;
+	mGlyphHeight = img.getHeight() / rows;
+	mFirstChar = firstChar;
+	mGlyphs.resize(columns * rows);
+
+	float du = (region.u1 - region.u0) / columns;
+	float dv = (region.v1 - region.v0) / rows;
+
+	// PNGCodec flips the image, so the first glyph row is at the top.
+	for (unsigned int i = 0; i < mGlyphs.size(); ++i)
+	{
+		unsigned int column = i % columns;
+		unsigned int row = i / columns;
+		AtlasRegion &glyph = mGlyphs.at(i);
+
+		glyph.x = region.x + column * mGlyphWidth;
+		glyph.y = region.y + (rows - row - 1) * mGlyphHeight;
+		glyph.width = mGlyphWidth;
+		glyph.height = mGlyphHeight;
+		glyph.u0 = region.u0 + column * du;
+		glyph.u1 = glyph.u0 + du;
+		glyph.v1 = region.v1 - row * dv;
+		glyph.v0 = glyph.v1 - dv;
+	}
+
+	return true;
+}
+
+bool BitmapFont::getGlyph(char c, AtlasRegion *region)
+{
+	unsigned int index = static_cast<unsigned char>(c) - static_cast<unsigned char>(mFirstChar);
+
+	if (index >= mGlyphs.size())
+		return false;
+
+	*region = mGlyphs.at(index);
+	return true;
+}
+
+unsigned int BitmapFont::getGlyphWidth()
+{
+	return mGlyphWidth;
+}
+
+unsigned int BitmapFont::getGlyphHeight()
+{
+	return mGlyphHeight;
+}
@@ -0,0 +1,29 @@
+#ifndef BITMAP_FONT_HPP
+#define BITMAP_FONT_HPP
+#include "Prerequisites.hpp"
+#include "TextureAtlas.hpp"
+
+// Monospaced font read from a PNG holding a grid of glyphs in character
+// order, the first cell being firstChar. The glyphs live in a TextureAtlas.
+class BitmapFont
+{
+public:
+	BitmapFont();
+	~BitmapFont();
+	BitmapFont(const BitmapFont&) = delete;
+	BitmapFont& operator=(const BitmapFont&) = delete;
+
+	bool loadFromFile(std::string fileName, TextureAtlas &atlas,
+		unsigned int columns, unsigned int rows, char firstChar = ' ');
+	bool getGlyph(char c, AtlasRegion *region);
+	unsigned int getGlyphWidth();
+	unsigned int getGlyphHeight();
+
+private:
+	std::vector<AtlasRegion> mGlyphs;
+	unsigned int mGlyphWidth;
+	unsigned int mGlyphHeight;
+	char mFirstChar;
+};
+
+#endif // BITMAP_FONT_HPP
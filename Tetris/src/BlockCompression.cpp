@@ -0,0 +1,404 @@
+#include "BlockCompression.hpp"
+#include "Simd.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+static const int BLOCK_PIXELS = 16;
+static const uint8_t ALPHA_THRESHOLD = 128;
+static const int POWER_ITERATIONS = 8;
+
+static uint16_t PackColor565(const float color[3])
+{
+	int r = static_cast<int>(color[0] * 31.0f / 255.0f + 0.5f);
+	int g = static_cast<int>(color[1] * 63.0f / 255.0f + 0.5f);
+	int b = static_cast<int>(color[2] * 31.0f / 255.0f + 0.5f);
+
+	r = std::min(std::max(r, 0), 31);
+	g = std::min(std::max(g, 0), 63);
+	b = std::min(std::max(b, 0), 31);
+
+	return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+static void UnpackColor565(uint16_t packed, float color[3])
+{
+	int r = (packed >> 11) & 0x1F;
+	int g = (packed >> 5) & 0x3F;
+	int b = packed & 0x1F;
+
+	color[0] = static_cast<float>((r << 3) | (r >> 2));
+	color[1] = static_cast<float>((g << 2) | (g >> 4));
+	color[2] = static_cast<float>((b << 3) | (b >> 2));
+}
+
+static void ComputePrincipalAxis(const float *r, const float *g, const float *b,
+	int count, float mean[3], float axis[3])
+{
+	mean[0] = mean[1] = mean[2] = 0.0f;
+
+	for (int i = 0; i < count; ++i)
+	{
+		mean[0] += r[i];
+		mean[1] += g[i];
+		mean[2] += b[i];
+	}
+
+	for (int c = 0; c < 3; ++c)
+		mean[c] /= count;
+
+	float cov[6] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+
+	for (int i = 0; i < count; ++i)
+	{
+		float dr = r[i] - mean[0];
+		float dg = g[i] - mean[1];
+		float db = b[i] - mean[2];
+
+		cov[0] += dr * dr;
+		cov[1] += dr * dg;
+		cov[2] += dr * db;
+		cov[3] += dg * dg;
+		cov[4] += dg * db;
+		cov[5] += db * db;
+	}
+
+	axis[0] = axis[1] = axis[2] = 1.0f;
+
+	for (int i = 0; i < POWER_ITERATIONS; ++i)
+	{
+		float x = cov[0] * axis[0] + cov[1] * axis[1] + cov[2] * axis[2];
+		float y = cov[1] * axis[0] + cov[3] * axis[1] + cov[4] * axis[2];
+		float z = cov[2] * axis[0] + cov[4] * axis[1] + cov[5] * axis[2];
+		float length = std::max(std::fabs(x), std::max(std::fabs(y), std::fabs(z)));
+
+		// Flat blocks have no dominant direction, any axis will do.
+		if (length < 1e-6f)
+			break;
+
+		axis[0] = x / length;
+		axis[1] = y / length;
+		axis[2] = z / length;
+	}
+
+	float length = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+
+	for (int c = 0; c < 3; ++c)
+		axis[c] /= length;
+}
+
+#ifdef SIMD_SSE2
+
+static void ProjectRange(const float *r, const float *g, const float *b,
+	const float mean[3], const float axis[3], float *minT, float *maxT)
+{
+	__m128 minV = _mm_set1_ps(1e30f);
+	__m128 maxV = _mm_set1_ps(-1e30f);
+
+	for (int i = 0; i < BLOCK_PIXELS; i += 4)
+	{
+		__m128 t = _mm_add_ps(_mm_add_ps(
+			_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(r + i), _mm_set1_ps(mean[0])), _mm_set1_ps(axis[0])),
+			_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(g + i), _mm_set1_ps(mean[1])), _mm_set1_ps(axis[1]))),
+			_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(b + i), _mm_set1_ps(mean[2])), _mm_set1_ps(axis[2])));
+
+		minV = _mm_min_ps(minV, t);
+		maxV = _mm_max_ps(maxV, t);
+	}
+
+	minV = _mm_min_ps(minV, _mm_shuffle_ps(minV, minV, _MM_SHUFFLE(1, 0, 3, 2)));
+	minV = _mm_min_ps(minV, _mm_shuffle_ps(minV, minV, _MM_SHUFFLE(2, 3, 0, 1)));
+	maxV = _mm_max_ps(maxV, _mm_shuffle_ps(maxV, maxV, _MM_SHUFFLE(1, 0, 3, 2)));
+	maxV = _mm_max_ps(maxV, _mm_shuffle_ps(maxV, maxV, _MM_SHUFFLE(2, 3, 0, 1)));
+
+	*minT = _mm_cvtss_f32(minV);
+	*maxT = _mm_cvtss_f32(maxV);
+}
+
+static uint32_t FindColorIndices(const float *r, const float *g, const float *b,
+	const float palette[4][3], int paletteSize)
+{
+	uint32_t indices = 0;
+
+	for (int i = 0; i < BLOCK_PIXELS; i += 4)
+	{
+		__m128 pr = _mm_loadu_ps(r + i);
+		__m128 pg = _mm_loadu_ps(g + i);
+		__m128 pb = _mm_loadu_ps(b + i);
+		__m128 best = _mm_set1_ps(1e30f);
+		__m128i bestIndex = _mm_setzero_si128();
+
+		for (int p = 0; p < paletteSize; ++p)
+		{
+			__m128 dr = _mm_sub_ps(pr, _mm_set1_ps(palette[p][0]));
+			__m128 dg = _mm_sub_ps(pg, _mm_set1_ps(palette[p][1]));
+			__m128 db = _mm_sub_ps(pb, _mm_set1_ps(palette[p][2]));
+			__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dr, dr),
+				_mm_mul_ps(dg, dg)), _mm_mul_ps(db, db));
+
+			__m128i closer = _mm_castps_si128(_mm_cmplt_ps(distance, best));
+			best = _mm_min_ps(best, distance);
+			bestIndex = _mm_or_si128(_mm_and_si128(closer, _mm_set1_epi32(p)),
+				_mm_andnot_si128(closer, bestIndex));
+		}
+
+		int32_t lanes[4];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), bestIndex);
+
+		for (int j = 0; j < 4; ++j)
+			indices |= static_cast<uint32_t>(lanes[j]) << (2 * (i + j));
+	}
+
+	return indices;
+}
+
+#else
+
+static void ProjectRange(const float *r, const float *g, const float *b,
+	const float mean[3], const float axis[3], float *minT, float *maxT)
+{
+	*minT = 1e30f;
+	*maxT = -1e30f;
+
+	for (int i = 0; i < BLOCK_PIXELS; ++i)
+	{
+		float t = (r[i] - mean[0]) * axis[0] + (g[i] - mean[1]) * axis[1] +
+			(b[i] - mean[2]) * axis[2];
+
+		*minT = std::min(*minT, t);
+		*maxT = std::max(*maxT, t);
+	}
+}
+
+static uint32_t FindColorIndices(const float *r, const float *g, const float *b,
+	const float palette[4][3], int paletteSize)
+{
+	uint32_t indices = 0;
+
+	for (int i = 0; i < BLOCK_PIXELS; ++i)
+	{
+		float best = 1e30f;
+		uint32_t bestIndex = 0;
+
+		for (int p = 0; p < paletteSize; ++p)
+		{
+			float dr = r[i] - palette[p][0];
+			float dg = g[i] - palette[p][1];
+			float db = b[i] - palette[p][2];
+			float distance = dr * dr + dg * dg + db * db;
+
+			if (distance < best)
+			{
+				best = distance;
+				bestIndex = p;
+			}
+		}
+
+		indices |= bestIndex << (2 * i);
+	}
+
+	return indices;
+}
+
+#endif // SIMD_SSE2
+
+void CompressBlockBC1(const uint8_t rgba[64], uint8_t block[8], bool alpha)
+{
+	float r[BLOCK_PIXELS], g[BLOCK_PIXELS], b[BLOCK_PIXELS];
+	float fitR[BLOCK_PIXELS], fitG[BLOCK_PIXELS], fitB[BLOCK_PIXELS];
+	uint32_t transparent = 0;
+	int count = 0;
+
+	for (int i = 0; i < BLOCK_PIXELS; ++i)
+	{
+		r[i] = rgba[i * 4];
+		g[i] = rgba[i * 4 + 1];
+		b[i] = rgba[i * 4 + 2];
+
+		if (alpha && rgba[i * 4 + 3] < ALPHA_THRESHOLD)
+		{
+			transparent |= 3u << (2 * i);
+			continue;
+		}
+
+		fitR[count] = r[i];
+		fitG[count] = g[i];
+		fitB[count] = b[i];
+		++count;
+	}
+
+	uint16_t color0 = 0;
+	uint16_t color1 = 0xFFFF;
+	uint32_t indices = 0xFFFFFFFF;
+
+	if (count > 0)
+	{
+		// Repeating fitted pixels keeps the projection range unchanged.
+		for (int i = count; i < BLOCK_PIXELS; ++i)
+		{
+			fitR[i] = fitR[0];
+			fitG[i] = fitG[0];
+			fitB[i] = fitB[0];
+		}
+
+		float mean[3], axis[3], minT, maxT;
+		ComputePrincipalAxis(fitR, fitG, fitB, count, mean, axis);
+		ProjectRange(fitR, fitG, fitB, mean, axis, &minT, &maxT);
+
+		float end0[3], end1[3];
+
+		for (int c = 0; c < 3; ++c)
+		{
+			end0[c] = mean[c] + axis[c] * maxT;
+			end1[c] = mean[c] + axis[c] * minT;
+		}
+
+		color0 = PackColor565(end0);
+		color1 = PackColor565(end1);
+
+		// color0 > color1 selects the four color mode, transparency needs
+		// the three color mode where index 3 is transparent black.
+		bool threeColors = transparent != 0;
+
+		if ((threeColors && color0 > color1) || (!threeColors && color0 < color1))
+			std::swap(color0, color1);
+
+		float palette[4][3];
+		int paletteSize;
+		UnpackColor565(color0, palette[0]);
+		UnpackColor565(color1, palette[1]);
+
+		if (color0 > color1)
+		{
+			for (int c = 0; c < 3; ++c)
+			{
+				palette[2][c] = (2.0f * palette[0][c] + palette[1][c]) / 3.0f;
+				palette[3][c] = (palette[0][c] + 2.0f * palette[1][c]) / 3.0f;
+			}
+
+			paletteSize = 4;
+		}
+		else
+		{
+			for (int c = 0; c < 3; ++c)
+				palette[2][c] = (palette[0][c] + palette[1][c]) / 2.0f;
+
+			paletteSize = 3;
+		}
+
+		indices = FindColorIndices(r, g, b, palette, paletteSize) | transparent;
+	}
+
+	memcpy(block, &color0, 2);
+	memcpy(block + 2, &color1, 2);
+	memcpy(block + 4, &indices, 4);
+}
+
+void CompressBlockBC2(const uint8_t rgba[64], uint8_t block[16])
+{
+	uint64_t alpha = 0;
+
+	for (int i = 0; i < BLOCK_PIXELS; ++i)
+		alpha |= static_cast<uint64_t>((rgba[i * 4 + 3] * 15 + 127) / 255) << (4 * i);
+
+	memcpy(block, &alpha, 8);
+	CompressBlockBC1(rgba, block + 8, false);
+}
+
+void CompressBlockBC3(const uint8_t rgba[64], uint8_t block[16])
+{
+	uint8_t alpha[BLOCK_PIXELS];
+
+	for (int i = 0; i < BLOCK_PIXELS; ++i)
+		alpha[i] = rgba[i * 4 + 3];
+
+	CompressBlockBC4(alpha, block);
+	CompressBlockBC1(rgba, block + 8, false);
+}
+
+void CompressBlockBC4(const uint8_t values[16], uint8_t block[8])
+{
+	uint8_t minValue = 255;
+	uint8_t maxValue = 0;
+
+	for (int i = 0; i < BLOCK_PIXELS; ++i)
+	{
+		minValue = std::min(minValue, values[i]);
+		maxValue = std::max(maxValue, values[i]);
+	}
+
+	// value0 > value1 selects eight interpolated values; position p along
+	// min..max maps to index 1 (p = 0), 0 (p = 7) or 8 - p in between.
+	uint64_t indices = 0;
+	int range = maxValue - minValue;
+
+	if (range > 0)
+	{
+		for (int i = 0; i < BLOCK_PIXELS; ++i)
+		{
+			int p = ((values[i] - minValue) * 14 + range) / (2 * range);
+			uint64_t index = p == 7 ? 0 : (p == 0 ? 1 : 8 - p);
+			indices |= index << (3 * i);
+		}
+	}
+
+	block[0] = maxValue;
+	block[1] = minValue;
+	memcpy(block + 2, &indices, 6);
+}
+
+void CompressBlockBC5(const uint8_t red[16], const uint8_t green[16], uint8_t block[16])
+{
+	CompressBlockBC4(red, block);
+	CompressBlockBC4(green, block + 8);
+}
+
+void FlipBlockBC1(uint8_t block[8], unsigned int rows)
+{
+	// One byte of 2 bit indices per row.
+	std::reverse(block + 4, block + 4 + rows);
+}
+
+void FlipBlockBC2(uint8_t block[16], unsigned int rows)
+{
+	// Two bytes of 4 bit alpha per row.
+	uint16_t alpha[4];
+	memcpy(alpha, block, 8);
+	std::reverse(alpha, alpha + rows);
+	memcpy(block, alpha, 8);
+
+	FlipBlockBC1(block + 8, rows);
+}
+
+void FlipBlockBC3(uint8_t block[16], unsigned int rows)
+{
+	FlipBlockBC4(block, rows);
+	FlipBlockBC1(block + 8, rows);
+}
+
+void FlipBlockBC4(uint8_t block[8], unsigned int rows)
+{
+	// 48 bits of 3 bit indices, 12 bits per row.
+	uint64_t indices = 0;
+	memcpy(&indices, block + 2, 6);
+
+	uint64_t flipped = indices;
+
+	for (unsigned int row = 0; row < rows; ++row)
+	{
+		unsigned int from = row * 12;
+		unsigned int to = (rows - row - 1) * 12;
+
+		flipped &= ~(0xFFFull << to);
+		flipped |= ((indices >> from) & 0xFFF) << to;
+	}
+
+	memcpy(block + 2, &flipped, 6);
+}
+
+void FlipBlockBC5(uint8_t block[16], unsigned int rows)
+{
+	FlipBlockBC4(block, rows);
+	FlipBlockBC4(block + 8, rows);
+}
+
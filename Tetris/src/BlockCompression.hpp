@@ -0,0 +1,22 @@
+#ifndef BLOCK_COMPRESSION_HPP
+#define BLOCK_COMPRESSION_HPP
+#include "Prerequisites.hpp"
+
+// Encoders for a single 4x4 block. Pixels are given row by row, colors as
+// RGBA8 and single channels as one byte per pixel.
+
+void CompressBlockBC1(const uint8_t rgba[64], uint8_t block[8], bool alpha);
+void CompressBlockBC2(const uint8_t rgba[64], uint8_t block[16]);
+void CompressBlockBC3(const uint8_t rgba[64], uint8_t block[16]);
+void CompressBlockBC4(const uint8_t values[16], uint8_t block[8]);
+void CompressBlockBC5(const uint8_t red[16], const uint8_t green[16], uint8_t block[16]);
+
+// Mirror the first rows (1 to 4) of a block vertically by reordering its
+// indices, the endpoints stay untouched.
+void FlipBlockBC1(uint8_t block[8], unsigned int rows);
+void FlipBlockBC2(uint8_t block[16], unsigned int rows);
+void FlipBlockBC3(uint8_t block[16], unsigned int rows);
+void FlipBlockBC4(uint8_t block[8], unsigned int rows);
+void FlipBlockBC5(uint8_t block[16], unsigned int rows);
+
+#endif // BLOCK_COMPRESSION_HPP
@@ -0,0 +1,299 @@
+#ifndef BOARD_HPP
+#define BOARD_HPP
+#include "Prerequisites.hpp"
+#include "Vertex.hpp"
+#include "FrameArena.hpp"
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+struct Color
+{
+	float r, g, b, a;
+
+	bool operator==(const Color &col)
+	{
+		return (r == col.r && g == col.g && b == col.b && a == col.a);
+	}
+};
+
+// Smallest unsigned type with a bit for every column.
+template<unsigned int Width>
+using BoardRowMask = typename std::conditional<Width <= 16, uint16_t,
+	typename std::conditional<Width <= 32, uint32_t, uint64_t>::type>::type;
+
+// Playfield of Width columns and Height visible rows, with HIDDEN_ROWS more
+// above them where new pieces appear. Every row keeps a mask of its filled
+// cells next to their colors, bit i is column i.
+template<unsigned int Width, unsigned int Height>
+class Board
+{
+public:
+	static_assert(Width >= 4 && Width <= 64, "Board width must be between 4 and 64 columns");
+	static_assert(Height >= 4 && Height + 2 <= 255, "Board height must fit the column tops");
+
+	typedef BoardRowMask<Width> RowMask;
+
+	static const int32_t COLUMNS = Width;
+	static const int32_t VISIBLE_ROWS = Height;
+	static const int32_t HIDDEN_ROWS = 2;
+	static const int32_t ROWS = Height + HIDDEN_ROWS;
+	static const RowMask FULL_ROW = static_cast<RowMask>(~0ull >> (64 - Width));
+
+	Board() { clear(); }
+
+	void clear()
+	{
+		memset(mCells, 0, sizeof(mCells));
+		memset(mRows, 0, sizeof(mRows));
+	}
+
+	Color* get(int32_t row, int32_t column) const
+	{
+		return mCells[row][column];
+	}
+
+	void set(int32_t row, int32_t column, Color *color)
+	{
+		RowMask bit = static_cast<RowMask>(RowMask(1) << column);
+		mCells[row][column] = color;
+		mRows[row] = color == nullptr ? static_cast<RowMask>(mRows[row] & ~bit) :
+			static_cast<RowMask>(mRows[row] | bit);
+	}
+
+	RowMask getRowMask(int32_t row) const
+	{
+		return mRows[row];
+	}
+
+	// Moves every row above index one down, the top row ends up empty.
+	void removeRow(int32_t index)
+	{
+		memmove(mCells[1], mCells[0], index * sizeof(mCells[0]));
+		memmove(&mRows[1], &mRows[0], index * sizeof(mRows[0]));
+		memset(mCells[0], 0, sizeof(mCells[0]));
+		mRows[0] = 0;
+	}
+
+private:
+	Color* mCells[ROWS][Width];
+	RowMask mRows[ROWS];
+};
+
+template<unsigned int Width, unsigned int Height>
+const int32_t Board<Width, Height>::COLUMNS;
+template<unsigned int Width, unsigned int Height>
+const int32_t Board<Width, Height>::VISIBLE_ROWS;
+template<unsigned int Width, unsigned int Height>
+const int32_t Board<Width, Height>::HIDDEN_ROWS;
+template<unsigned int Width, unsigned int Height>
+const int32_t Board<Width, Height>::ROWS;
+template<unsigned int Width, unsigned int Height>
+const typename Board<Width, Height>::RowMask Board<Width, Height>::FULL_ROW;
+
+// The visible rows as two triangles a block, the top one lighter.
+template<unsigned int Width, unsigned int Height>
+void BuildBlockVertices(const Board<Width, Height> &board, float x, float y,
+	float width, float height, FrameVector<Vertex> &vertexData)
+{
+	typedef Board<Width, Height> BoardType;
+
+	y += height; // up to down.
+
+	float dw = width / BoardType::COLUMNS;
+	float dh = height / BoardType::VISIBLE_ROWS;
+
+	for (int32_t i = BoardType::HIDDEN_ROWS; i < BoardType::ROWS; i++)
+	{
+		if (board.getRowMask(i) == 0)
+			continue;
+
+		float top = y - dh * (i - BoardType::HIDDEN_ROWS);
+		float bottom = top - dh;
+
+		for (int32_t j = 0; j < BoardType::COLUMNS; j++)
+		{
+			const Color *color = board.get(i, j);
+
+			if (color == nullptr) continue;
+
+			vertexData.push_back(Vertex{ x + dw * j, top, color->r, color->g, color->b, color->a });
+			vertexData.push_back(Vertex{ x + dw * (j + 1), top, color->r, color->g, color->b, color->a });
+			vertexData.push_back(Vertex{ x + dw * j, bottom, color->r + 0.2f, color->g + 0.2f, color->b + 0.2f, color->a });
+
+			vertexData.push_back(Vertex{ x + dw * j, bottom, color->r + 0.2f, color->g + 0.2f, color->b + 0.2f, color->a });
+			vertexData.push_back(Vertex{ x + dw * (j + 1), top, color->r, color->g, color->b, color->a });
+			vertexData.push_back(Vertex{ x + dw * (j + 1), bottom, color->r, color->g, color->b, color->a });
+		}
+	}
+}
+
+template<unsigned int Width, unsigned int Height>
+void PlaceTetramino(Board<Width, Height> &board, Color* (*tetramino)[4], int32_t x, int32_t y)
+{
+	for (int i = 0; i < 4; i++)
+	{
+		for (int j = 0; j < 4; j++)
+		{
+			if (tetramino[i][j] == nullptr)
+				continue;
+
+			board.set(y + i, x + j, tetramino[i][j]);
+		}
+	}
+}
+
+template<unsigned int Width, unsigned int Height>
+void RemoveTetramino(Board<Width, Height> &board, Color* (*tetramino)[4], int32_t x, int32_t y)
+{
+	// No error checking.
+
+	for (int i = 0; i < 4; i++)
+	{
+		for (int j = 0; j < 4; j++)
+		{
+			if (tetramino[i][j] == nullptr)
+				continue;
+
+			board.set(y + i, x + j, nullptr);
+		}
+	}
+}
+
+// True when the piece fits at x, y. Each piece row is tested against the
+// board row as one mask.
+template<unsigned int Width, unsigned int Height>
+bool CheckCollision(const Board<Width, Height> &board, Color* (*tetramino)[4], int32_t x, int32_t y)
+{
+	typedef Board<Width, Height> BoardType;
+
+	for (int i = 0; i < 4; i++)
+	{
+		uint32_t bits = 0;
+
+		for (int j = 0; j < 4; j++)
+		{
+			if (tetramino[i][j] != nullptr)
+				bits |= 1u << j;
+		}
+
+		if (bits == 0)
+			continue;
+
+		if (y + i < 0 || y + i >= BoardType::ROWS)
+			return false;
+
+		uint64_t mask;
+
+		if (x < 0)
+		{
+			// Blocks left of the first column.
+			if (x <= -4 || (bits & ((1u << -x) - 1)) != 0)
+				return false;
+
+			mask = bits >> -x;
+		}
+		else
+		{
+			// Blocks right of the last column.
+			if (x >= BoardType::COLUMNS ||
+				(x > BoardType::COLUMNS - 4 && (bits >> (BoardType::COLUMNS - x)) != 0))
+				return false;
+
+			mask = static_cast<uint64_t>(bits) << x;
+		}
+
+		if ((board.getRowMask(y + i) & mask) != 0)
+			return false;
+	}
+
+	return true;
+}
+
+template<unsigned int Width, unsigned int Height>
+void LookForLines(const Board<Width, Height> &board, int32_t indices[4])
+{
+	typedef Board<Width, Height> BoardType;
+	int index = 0;
+
+	for (int i = 0; i < 4; i++)
+		indices[i] = -1;
+
+	for (int32_t i = BoardType::HIDDEN_ROWS; i < BoardType::ROWS; i++)
+	{
+		if (board.getRowMask(i) == BoardType::FULL_ROW)
+		{
+			if (index > 3) return;
+
+			indices[index] = i;
+			index++;
+		}
+	}
+}
+
+template<unsigned int Width, unsigned int Height>
+void RemoveLine(Board<Width, Height> &board, uint32_t index)
+{
+	board.removeRow(index);
+}
+
+// Row of the highest block in every column, ROWS for an empty one.
+template<unsigned int Width, unsigned int Height>
+void GetColumnTops(const Board<Width, Height> &board, uint8_t tops[Width])
+{
+	typedef Board<Width, Height> BoardType;
+	typename BoardType::RowMask seen = 0;
+
+	for (int32_t j = 0; j < BoardType::COLUMNS; j++)
+		tops[j] = BoardType::ROWS;
+
+	// Top down, a column's first block is the first time its bit shows up.
+	for (int32_t i = 0; i < BoardType::ROWS && seen != BoardType::FULL_ROW; i++)
+	{
+		typename BoardType::RowMask fresh = board.getRowMask(i) & ~seen;
+
+		for (int32_t j = 0; fresh != 0 && j < BoardType::COLUMNS; j++)
+		{
+			if ((fresh >> j) & 1)
+				tops[j] = static_cast<uint8_t>(i);
+		}
+
+		seen |= fresh;
+	}
+}
+
+// Rows the piece at x, y falls before it lands. Reads the column tops only,
+// unless the piece is already below the surface somewhere.
+template<unsigned int Width, unsigned int Height>
+int32_t GetDropDistance(const Board<Width, Height> &board, const uint8_t tops[Width],
+	Color* (*tetramino)[4], int32_t x, int32_t y)
+{
+	int32_t distance = Board<Width, Height>::ROWS;
+
+	// The lowest block of every piece column lands one row above that
+	// column's top, the closest column decides.
+	for (int j = 0; j < 4; j++)
+	{
+		for (int i = 3; i >= 0; i--)
+		{
+			if (tetramino[i][j] != nullptr)
+			{
+				distance = std::min(distance, tops[x + j] - 1 - (y + i));
+				break;
+			}
+		}
+	}
+
+	if (distance >= 0)
+		return distance;
+
+	// Tucked under an overhang, only a scan down the board knows.
+	distance = 0;
+
+	while (CheckCollision(board, tetramino, x, y + distance + 1))
+		distance++;
+
+	return distance;
+}
+
+#endif // BOARD_HPP
@@ -0,0 +1,635 @@
+#include "ColorConversion.hpp"
+#include "Image.hpp"
+#include "Simd.hpp"
+#include <array>
+#include <cmath>
+#include <cstring>
+
+// Ordered dithering thresholds, scaled to 0..255 when used.
+static const uint8_t BAYER_4X4[4][4] =
+{
+	{  0,  8,  2, 10 },
+	{ 12,  4, 14,  6 },
+	{  3, 11,  1,  9 },
+	{ 15,  7, 13,  5 },
+};
+
+static const uint16_t ROUND_THRESHOLD = 127;
+
+struct PackLayout
+{
+	uint16_t max[4];
+	uint32_t mul[4];
+};
+
+static bool GetPackLayout(ColorFormat format, PackLayout *layout)
+{
+	// Bit layouts match the *_REV data types Texture uploads them with,
+	// the first component lives in the lowest bits.
+	switch (format)
+	{
+	case ColorFormat::R5G6B5:
+		*layout = PackLayout{ { 31, 63, 31, 0 }, { 1, 32, 2048, 0 } };
+		return true;
+
+	case ColorFormat::RGBA4:
+		*layout = PackLayout{ { 15, 15, 15, 15 }, { 1, 16, 256, 4096 } };
+		return true;
+
+	case ColorFormat::RGB5A1:
+		*layout = PackLayout{ { 31, 31, 31, 1 }, { 1, 32, 1024, 32768 } };
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+static uint16_t GetThreshold(unsigned int x, unsigned int y, uint8_t channel, bool dither)
+{
+	// Alpha is never dithered, stippled edges look worse than banding.
+	if (dither == false || channel == 3)
+		return ROUND_THRESHOLD;
+
+	return BAYER_4X4[y & 3][x & 3] * 16 + 8;
+}
+
+static uint32_t Quantize(uint8_t value, uint16_t max, uint16_t threshold)
+{
+	return (value * max + threshold) / 255;
+}
+
+static uint8_t Expand(uint32_t value, uint32_t max)
+{
+	return static_cast<uint8_t>((value * 255 + max / 2) / max);
+}
+
+static void PackRGBA8Scalar(const uint8_t *src, uint8_t *dst, unsigned int x,
+	unsigned int y, unsigned int width, const PackLayout &layout, bool dither)
+{
+	for (; x < width; ++x)
+	{
+		uint32_t packed = 0;
+
+		for (uint8_t i = 0; i < 4; ++i)
+			packed += Quantize(src[x * 4 + i], layout.max[i],
+				GetThreshold(x, y, i, dither)) * layout.mul[i];
+
+		uint16_t value = static_cast<uint16_t>(packed);
+		memcpy(&dst[x * 2], &value, sizeof(value));
+	}
+}
+
+static const uint8_t *GetSRGBToLinearTable()
+{
+	static const std::array<uint8_t, 256> table = []()
+	{
+		std::array<uint8_t, 256> values;
+
+		for (int i = 0; i < 256; ++i)
+		{
+			double c = i / 255.0;
+			c = c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4);
+			values[i] = static_cast<uint8_t>(c * 255.0 + 0.5);
+		}
+
+		return values;
+	}();
+
+	return table.data();
+}
+
+static const uint8_t *GetLinearToSRGBTable()
+{
+	static const std::array<uint8_t, 256> table = []()
+	{
+		std::array<uint8_t, 256> values;
+
+		for (int i = 0; i < 256; ++i)
+		{
+			double c = i / 255.0;
+			c = c <= 0.0031308 ? c * 12.92 : 1.055 * std::pow(c, 1.0 / 2.4) - 0.055;
+			values[i] = static_cast<uint8_t>(c * 255.0 + 0.5);
+		}
+
+		return values;
+	}();
+
+	return table.data();
+}
+
+uint8_t SRGBToLinear(uint8_t value)
+{
+	return GetSRGBToLinearTable()[value];
+}
+
+uint8_t LinearToSRGB(uint8_t value)
+{
+	return GetLinearToSRGBTable()[value];
+}
+
+static void ApplyTable(uint8_t *bytes, size_t pixelCount, uint8_t channels,
+	const uint8_t *table)
+{
+	// Only color channels are gamma encoded, alpha stays linear.
+	for (size_t i = 0; i < pixelCount; ++i)
+	{
+		for (uint8_t c = 0; c < 3; ++c)
+			bytes[i * channels + c] = table[bytes[i * channels + c]];
+	}
+}
+
+#ifdef SIMD_SSE2
+
+SIMD_TARGET("ssse3")
+static size_t ExpandRGB8ToRGBA8SSSE3(const uint8_t *src, uint8_t *dst, size_t pixelCount)
+{
+	const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1,
+		6, 7, 8, -1, 9, 10, 11, -1);
+	const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000));
+	size_t i = 0;
+
+	// Every load reads 16 bytes but consumes 12, keep the last one in bounds.
+	for (; i + 6 <= pixelCount; i += 4)
+	{
+		__m128i rgb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 3));
+		__m128i rgba = _mm_or_si128(_mm_shuffle_epi8(rgb, shuffle), alpha);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), rgba);
+	}
+
+	return i;
+}
+
+SIMD_TARGET("avx2")
+static size_t ExpandRGB8ToRGBA8AVX2(const uint8_t *src, uint8_t *dst, size_t pixelCount)
+{
+	const __m256i shuffle = _mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1,
+		6, 7, 8, -1, 9, 10, 11, -1, 0, 1, 2, -1, 3, 4, 5, -1,
+		6, 7, 8, -1, 9, 10, 11, -1);
+	const __m256i alpha = _mm256_set1_epi32(static_cast<int>(0xFF000000));
+	size_t i = 0;
+
+	for (; i + 10 <= pixelCount; i += 8)
+	{
+		__m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 3));
+		__m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 3 + 12));
+		__m256i rgb = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+		__m256i rgba = _mm256_or_si256(_mm256_shuffle_epi8(rgb, shuffle), alpha);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 4), rgba);
+	}
+
+	return i;
+}
+
+static inline __m128i Div255SSE2(__m128i value)
+{
+	// Exact value / 255 for every 16-bit value the kernels produce.
+	__m128i one = _mm_set1_epi16(1);
+	return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(value, one),
+		_mm_srli_epi16(value, 8)), 8);
+}
+
+static inline __m128i PackPairSSE2(__m128i pixels, __m128i max, __m128i mul,
+	__m128i threshold)
+{
+	__m128i quantized = Div255SSE2(_mm_add_epi16(_mm_mullo_epi16(pixels, max), threshold));
+	return _mm_madd_epi16(quantized, mul);
+}
+
+static inline __m128i SumPairsSSE2(__m128i lo, __m128i hi)
+{
+	// [a0 b0 a1 b1] [a2 b2 a3 b3] -> [a0+b0 a1+b1 a2+b2 a3+b3], truncated to 16 bits.
+	__m128 l = _mm_castsi128_ps(lo);
+	__m128 h = _mm_castsi128_ps(hi);
+	__m128i sum = _mm_add_epi32(
+		_mm_castps_si128(_mm_shuffle_ps(l, h, _MM_SHUFFLE(2, 0, 2, 0))),
+		_mm_castps_si128(_mm_shuffle_ps(l, h, _MM_SHUFFLE(3, 1, 3, 1))));
+
+	return _mm_srai_epi32(_mm_slli_epi32(sum, 16), 16);
+}
+
+static void GetThresholdPairs(unsigned int y, bool dither, int16_t pairs[2][8])
+{
+	for (unsigned int x = 0; x < 4; ++x)
+	{
+		for (uint8_t c = 0; c < 4; ++c)
+			pairs[x / 2][(x % 2) * 4 + c] = GetThreshold(x, y, c, dither);
+	}
+}
+
+static unsigned int PackRGBA8RowSSE2(const uint8_t *src, uint8_t *dst, unsigned int width,
+	unsigned int y, const PackLayout &layout, bool dither)
+{
+	int16_t pairs[2][8];
+	GetThresholdPairs(y, dither, pairs);
+
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i max = _mm_setr_epi16(layout.max[0], layout.max[1], layout.max[2],
+		layout.max[3], layout.max[0], layout.max[1], layout.max[2], layout.max[3]);
+	const __m128i mul = _mm_setr_epi16(
+		static_cast<int16_t>(layout.mul[0]), static_cast<int16_t>(layout.mul[1]),
+		static_cast<int16_t>(layout.mul[2]), static_cast<int16_t>(layout.mul[3]),
+		static_cast<int16_t>(layout.mul[0]), static_cast<int16_t>(layout.mul[1]),
+		static_cast<int16_t>(layout.mul[2]), static_cast<int16_t>(layout.mul[3]));
+	const __m128i t01 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pairs[0]));
+	const __m128i t23 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pairs[1]));
+	unsigned int x = 0;
+
+	for (; x + 8 <= width; x += 8)
+	{
+		__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x * 4));
+		__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x * 4 + 16));
+
+		__m128i p0 = SumPairsSSE2(
+			PackPairSSE2(_mm_unpacklo_epi8(a, zero), max, mul, t01),
+			PackPairSSE2(_mm_unpackhi_epi8(a, zero), max, mul, t23));
+		__m128i p1 = SumPairsSSE2(
+			PackPairSSE2(_mm_unpacklo_epi8(b, zero), max, mul, t01),
+			PackPairSSE2(_mm_unpackhi_epi8(b, zero), max, mul, t23));
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 2), _mm_packs_epi32(p0, p1));
+	}
+
+	return x;
+}
+
+SIMD_TARGET("avx2")
+static inline __m256i PackPairAVX2(__m256i pixels, __m256i max, __m256i mul,
+	__m256i threshold)
+{
+	__m256i value = _mm256_add_epi16(_mm256_mullo_epi16(pixels, max), threshold);
+	value = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(value,
+		_mm256_set1_epi16(1)), _mm256_srli_epi16(value, 8)), 8);
+	return _mm256_madd_epi16(value, mul);
+}
+
+SIMD_TARGET("avx2")
+static inline __m256i SumPairsAVX2(__m256i lo, __m256i hi)
+{
+	__m256 l = _mm256_castsi256_ps(lo);
+	__m256 h = _mm256_castsi256_ps(hi);
+	__m256i sum = _mm256_add_epi32(
+		_mm256_castps_si256(_mm256_shuffle_ps(l, h, _MM_SHUFFLE(2, 0, 2, 0))),
+		_mm256_castps_si256(_mm256_shuffle_ps(l, h, _MM_SHUFFLE(3, 1, 3, 1))));
+
+	return _mm256_srai_epi32(_mm256_slli_epi32(sum, 16), 16);
+}
+
+SIMD_TARGET("avx2")
+static unsigned int PackRGBA8RowAVX2(const uint8_t *src, uint8_t *dst, unsigned int width,
+	unsigned int y, const PackLayout &layout, bool dither)
+{
+	int16_t pairs[2][8];
+	GetThresholdPairs(y, dither, pairs);
+
+	// Unpacking works per 128-bit lane, so lane 1 of the low half holds pixels
+	// 4 and 5, which share thresholds with pixels 0 and 1.
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i max = _mm256_setr_epi16(
+		layout.max[0], layout.max[1], layout.max[2], layout.max[3],
+		layout.max[0], layout.max[1], layout.max[2], layout.max[3],
+		layout.max[0], layout.max[1], layout.max[2], layout.max[3],
+		layout.max[0], layout.max[1], layout.max[2], layout.max[3]);
+	const __m256i mul = _mm256_setr_epi16(
+		static_cast<int16_t>(layout.mul[0]), static_cast<int16_t>(layout.mul[1]),
+		static_cast<int16_t>(layout.mul[2]), static_cast<int16_t>(layout.mul[3]),
+		static_cast<int16_t>(layout.mul[0]), static_cast<int16_t>(layout.mul[1]),
+		static_cast<int16_t>(layout.mul[2]), static_cast<int16_t>(layout.mul[3]),
+		static_cast<int16_t>(layout.mul[0]), static_cast<int16_t>(layout.mul[1]),
+		static_cast<int16_t>(layout.mul[2]), static_cast<int16_t>(layout.mul[3]),
+		static_cast<int16_t>(layout.mul[0]), static_cast<int16_t>(layout.mul[1]),
+		static_cast<int16_t>(layout.mul[2]), static_cast<int16_t>(layout.mul[3]));
+	const __m256i t01 = _mm256_broadcastsi128_si256(
+		_mm_loadu_si128(reinterpret_cast<const __m128i*>(pairs[0])));
+	const __m256i t23 = _mm256_broadcastsi128_si256(
+		_mm_loadu_si128(reinterpret_cast<const __m128i*>(pairs[1])));
+	unsigned int x = 0;
+
+	for (; x + 16 <= width; x += 16)
+	{
+		__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + x * 4));
+		__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + x * 4 + 32));
+
+		__m256i p0 = SumPairsAVX2(
+			PackPairAVX2(_mm256_unpacklo_epi8(a, zero), max, mul, t01),
+			PackPairAVX2(_mm256_unpackhi_epi8(a, zero), max, mul, t23));
+		__m256i p1 = SumPairsAVX2(
+			PackPairAVX2(_mm256_unpacklo_epi8(b, zero), max, mul, t01),
+			PackPairAVX2(_mm256_unpackhi_epi8(b, zero), max, mul, t23));
+
+		__m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(p0, p1),
+			_MM_SHUFFLE(3, 1, 2, 0));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + x * 2), packed);
+	}
+
+	return x;
+}
+
+static inline __m128i PremultiplyPairSSE2(__m128i pixels, __m128i rgbMask, __m128i alphaOne)
+{
+	__m128i alpha = _mm_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3));
+	alpha = _mm_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+	alpha = _mm_or_si128(_mm_and_si128(alpha, rgbMask), alphaOne);
+
+	__m128i value = _mm_add_epi16(_mm_mullo_epi16(pixels, alpha), _mm_set1_epi16(128));
+	return _mm_srli_epi16(_mm_add_epi16(value, _mm_srli_epi16(value, 8)), 8);
+}
+
+static size_t PremultiplyAlphaSSE2(uint8_t *bytes, size_t pixelCount)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i rgbMask = _mm_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+	const __m128i alphaOne = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+	size_t i = 0;
+
+	for (; i + 4 <= pixelCount; i += 4)
+	{
+		__m128i *ptr = reinterpret_cast<__m128i*>(bytes + i * 4);
+		__m128i pixels = _mm_loadu_si128(ptr);
+		__m128i lo = PremultiplyPairSSE2(_mm_unpacklo_epi8(pixels, zero), rgbMask, alphaOne);
+		__m128i hi = PremultiplyPairSSE2(_mm_unpackhi_epi8(pixels, zero), rgbMask, alphaOne);
+		_mm_storeu_si128(ptr, _mm_packus_epi16(lo, hi));
+	}
+
+	return i;
+}
+
+SIMD_TARGET("avx2")
+static inline __m256i PremultiplyPairAVX2(__m256i pixels, __m256i rgbMask, __m256i alphaOne)
+{
+	__m256i alpha = _mm256_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3));
+	alpha = _mm256_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+	alpha = _mm256_or_si256(_mm256_and_si256(alpha, rgbMask), alphaOne);
+
+	__m256i value = _mm256_add_epi16(_mm256_mullo_epi16(pixels, alpha), _mm256_set1_epi16(128));
+	return _mm256_srli_epi16(_mm256_add_epi16(value, _mm256_srli_epi16(value, 8)), 8);
+}
+
+SIMD_TARGET("avx2")
+static size_t PremultiplyAlphaAVX2(uint8_t *bytes, size_t pixelCount)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i rgbMask = _mm256_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0,
+		-1, -1, -1, 0, -1, -1, -1, 0);
+	const __m256i alphaOne = _mm256_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255,
+		0, 0, 0, 255, 0, 0, 0, 255);
+	size_t i = 0;
+
+	for (; i + 8 <= pixelCount; i += 8)
+	{
+		__m256i *ptr = reinterpret_cast<__m256i*>(bytes + i * 4);
+		__m256i pixels = _mm256_loadu_si256(ptr);
+		__m256i lo = PremultiplyPairAVX2(_mm256_unpacklo_epi8(pixels, zero), rgbMask, alphaOne);
+		__m256i hi = PremultiplyPairAVX2(_mm256_unpackhi_epi8(pixels, zero), rgbMask, alphaOne);
+		_mm256_storeu_si256(ptr, _mm256_packus_epi16(lo, hi));
+	}
+
+	return i;
+}
+
+#endif // SIMD_SSE2
+
+void ExpandRGB8ToRGBA8(const uint8_t *src, uint8_t *dst, size_t pixelCount)
+{
+	size_t i = 0;
+
+#ifdef SIMD_SSE2
+	if (CpuHasAVX2())
+		i = ExpandRGB8ToRGBA8AVX2(src, dst, pixelCount);
+	else if (CpuHasSSSE3())
+		i = ExpandRGB8ToRGBA8SSSE3(src, dst, pixelCount);
+#endif
+
+	for (; i < pixelCount; ++i)
+	{
+		dst[i * 4 + 0] = src[i * 3 + 0];
+		dst[i * 4 + 1] = src[i * 3 + 1];
+		dst[i * 4 + 2] = src[i * 3 + 2];
+		dst[i * 4 + 3] = 255;
+	}
+}
+
+void PackRGBA8(const uint8_t *src, uint8_t *dst, unsigned int width,
+	unsigned int height, ColorFormat format, bool dither)
+{
+	PackLayout layout;
+
+	if (GetPackLayout(format, &layout) == false)
+	{
+		// TODO: Error handling.
+		return;
+	}
+
+	for (unsigned int y = 0; y < height; ++y)
+	{
+		const uint8_t *srcRow = src + static_cast<size_t>(y) * width * 4;
+		uint8_t *dstRow = dst + static_cast<size_t>(y) * width * 2;
+		unsigned int x = 0;
+
+#ifdef SIMD_SSE2
+		if (CpuHasAVX2())
+			x = PackRGBA8RowAVX2(srcRow, dstRow, width, y, layout, dither);
+
+		x += PackRGBA8RowSSE2(srcRow + x * 4, dstRow + x * 2, width - x, y, layout, dither);
+#endif
+
+		PackRGBA8Scalar(srcRow, dstRow, x, y, width, layout, dither);
+	}
+}
+
+void PremultiplyAlpha(uint8_t *bytes, size_t pixelCount)
+{
+	size_t i = 0;
+
+#ifdef SIMD_SSE2
+	if (CpuHasAVX2())
+		i = PremultiplyAlphaAVX2(bytes, pixelCount);
+
+	i += PremultiplyAlphaSSE2(bytes + i * 4, pixelCount - i);
+#endif
+
+	for (; i < pixelCount; ++i)
+	{
+		uint8_t *pixel = &bytes[i * 4];
+
+		for (uint8_t c = 0; c < 3; ++c)
+		{
+			unsigned int value = pixel[c] * pixel[3] + 128;
+			pixel[c] = static_cast<uint8_t>((value + (value >> 8)) >> 8);
+		}
+	}
+}
+
+void DecodeToRGBA8(const uint8_t *src, ColorFormat format, uint8_t *dst,
+	size_t pixelCount)
+{
+	switch (format)
+	{
+	case ColorFormat::RGBA8:
+		memcpy(dst, src, pixelCount * 4);
+		return;
+
+	case ColorFormat::SRGB8A8:
+		memcpy(dst, src, pixelCount * 4);
+		ApplyTable(dst, pixelCount, 4, GetSRGBToLinearTable());
+		return;
+
+	case ColorFormat::RGB8:
+		ExpandRGB8ToRGBA8(src, dst, pixelCount);
+		return;
+
+	case ColorFormat::SRGB8:
+		ExpandRGB8ToRGBA8(src, dst, pixelCount);
+		ApplyTable(dst, pixelCount, 4, GetSRGBToLinearTable());
+		return;
+
+	default:
+		break;
+	}
+
+	for (size_t i = 0; i < pixelCount; ++i)
+	{
+		uint8_t *pixel = &dst[i * 4];
+		uint16_t value16;
+		uint32_t value32;
+
+		switch (format)
+		{
+		case ColorFormat::R8:
+			pixel[0] = src[i];
+			pixel[1] = pixel[2] = 0;
+			pixel[3] = 255;
+			break;
+
+		case ColorFormat::RG8:
+			pixel[0] = src[i * 2];
+			pixel[1] = src[i * 2 + 1];
+			pixel[2] = 0;
+			pixel[3] = 255;
+			break;
+
+		case ColorFormat::R3G3B2:
+			pixel[0] = Expand(src[i] & 0x7, 7);
+			pixel[1] = Expand((src[i] >> 3) & 0x7, 7);
+			pixel[2] = Expand(src[i] >> 6, 3);
+			pixel[3] = 255;
+			break;
+
+		case ColorFormat::R5G6B5:
+			memcpy(&value16, &src[i * 2], sizeof(value16));
+			pixel[0] = Expand(value16 & 0x1F, 31);
+			pixel[1] = Expand((value16 >> 5) & 0x3F, 63);
+			pixel[2] = Expand(value16 >> 11, 31);
+			pixel[3] = 255;
+			break;
+
+		case ColorFormat::RGBA4:
+			memcpy(&value16, &src[i * 2], sizeof(value16));
+			pixel[0] = Expand(value16 & 0xF, 15);
+			pixel[1] = Expand((value16 >> 4) & 0xF, 15);
+			pixel[2] = Expand((value16 >> 8) & 0xF, 15);
+			pixel[3] = Expand(value16 >> 12, 15);
+			break;
+
+		case ColorFormat::RGB5A1:
+			memcpy(&value16, &src[i * 2], sizeof(value16));
+			pixel[0] = Expand(value16 & 0x1F, 31);
+			pixel[1] = Expand((value16 >> 5) & 0x1F, 31);
+			pixel[2] = Expand((value16 >> 10) & 0x1F, 31);
+			pixel[3] = (value16 >> 15) ? 255 : 0;
+			break;
+
+		case ColorFormat::RGB10A2:
+			memcpy(&value32, &src[i * 4], sizeof(value32));
+			pixel[0] = Expand(value32 & 0x3FF, 1023);
+			pixel[1] = Expand((value32 >> 10) & 0x3FF, 1023);
+			pixel[2] = Expand((value32 >> 20) & 0x3FF, 1023);
+			pixel[3] = Expand(value32 >> 30, 3);
+			break;
+
+		default:
+			// TODO: Error handling.
+			return;
+		}
+	}
+}
+
+void EncodeFromRGBA8(const uint8_t *src, ColorFormat format, uint8_t *dst,
+	unsigned int width, unsigned int height, bool dither)
+{
+	size_t pixelCount = static_cast<size_t>(width) * height;
+
+	switch (format)
+	{
+	case ColorFormat::RGBA8:
+		memcpy(dst, src, pixelCount * 4);
+		return;
+
+	case ColorFormat::SRGB8A8:
+		memcpy(dst, src, pixelCount * 4);
+		ApplyTable(dst, pixelCount, 4, GetLinearToSRGBTable());
+		return;
+
+	case ColorFormat::R5G6B5:
+	case ColorFormat::RGBA4:
+	case ColorFormat::RGB5A1:
+		PackRGBA8(src, dst, width, height, format, dither);
+		return;
+
+	default:
+		break;
+	}
+
+	const uint8_t *table = GetLinearToSRGBTable();
+
+	for (unsigned int y = 0; y < height; ++y)
+	{
+		for (unsigned int x = 0; x < width; ++x)
+		{
+			size_t i = static_cast<size_t>(y) * width + x;
+			const uint8_t *pixel = &src[i * 4];
+			uint32_t value32;
+
+			switch (format)
+			{
+			case ColorFormat::R8:
+				dst[i] = pixel[0];
+				break;
+
+			case ColorFormat::RG8:
+				dst[i * 2] = pixel[0];
+				dst[i * 2 + 1] = pixel[1];
+				break;
+
+			case ColorFormat::RGB8:
+				memcpy(&dst[i * 3], pixel, 3);
+				break;
+
+			case ColorFormat::SRGB8:
+				dst[i * 3] = table[pixel[0]];
+				dst[i * 3 + 1] = table[pixel[1]];
+				dst[i * 3 + 2] = table[pixel[2]];
+				break;
+
+			case ColorFormat::R3G3B2:
+				dst[i] = static_cast<uint8_t>(
+					Quantize(pixel[0], 7, GetThreshold(x, y, 0, dither)) |
+					(Quantize(pixel[1], 7, GetThreshold(x, y, 1, dither)) << 3) |
+					(Quantize(pixel[2], 3, GetThreshold(x, y, 2, dither)) << 6));
+				break;
+
+			case ColorFormat::RGB10A2:
+				value32 = Quantize(pixel[0], 1023, ROUND_THRESHOLD) |
+					(Quantize(pixel[1], 1023, ROUND_THRESHOLD) << 10) |
+					(Quantize(pixel[2], 1023, ROUND_THRESHOLD) << 20) |
+					(Quantize(pixel[3], 3, ROUND_THRESHOLD) << 30);
+				memcpy(&dst[i * 4], &value32, sizeof(value32));
+				break;
+
+			default:
+				// TODO: Error handling.
+				return;
+			}
+		}
+	}
+}
@@ -0,0 +1,23 @@
+#ifndef COLOR_CONVERSION_HPP
+#define COLOR_CONVERSION_HPP
+#include "Prerequisites.hpp"
+
+enum class ColorFormat;
+
+// All kernels work on tightly packed pixels. RGBA8 is the intermediate format,
+// every other uncompressed format is decoded to it or encoded from it.
+
+void ExpandRGB8ToRGBA8(const uint8_t *src, uint8_t *dst, size_t pixelCount);
+void PackRGBA8(const uint8_t *src, uint8_t *dst, unsigned int width,
+	unsigned int height, ColorFormat format, bool dither);
+void PremultiplyAlpha(uint8_t *bytes, size_t pixelCount);
+
+void DecodeToRGBA8(const uint8_t *src, ColorFormat format, uint8_t *dst,
+	size_t pixelCount);
+void EncodeFromRGBA8(const uint8_t *src, ColorFormat format, uint8_t *dst,
+	unsigned int width, unsigned int height, bool dither);
+
+uint8_t SRGBToLinear(uint8_t value);
+uint8_t LinearToSRGB(uint8_t value);
+
+#endif // COLOR_CONVERSION_HPP
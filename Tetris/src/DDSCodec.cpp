@@ -0,0 +1,259 @@
+#include "DDSCodec.hpp"
+#include "Image.hpp"
+#include <algorithm>
+#include <cstring>
+
+const uint32_t DDS_MAGIC = 0x20534444; // "DDS "
+const size_t DDS_HEADER_SIZE = 128;
+const size_t DDS_DX10_HEADER_SIZE = 20;
+
+const uint32_t DDSD_MIPMAPCOUNT = 0x20000;
+const uint32_t DDPF_ALPHAPIXELS = 0x1;
+const uint32_t DDPF_FOURCC = 0x4;
+const uint32_t DDPF_RGB = 0x40;
+const uint32_t DDPF_LUMINANCE = 0x20000;
+
+const uint32_t DXGI_FORMAT_R8G8B8A8_UNORM = 28;
+const uint32_t DXGI_FORMAT_R8G8B8A8_UNORM_SRGB = 29;
+const uint32_t DXGI_FORMAT_R8G8_UNORM = 49;
+const uint32_t DXGI_FORMAT_R8_UNORM = 61;
+const uint32_t DXGI_FORMAT_BC1_UNORM = 71;
+const uint32_t DXGI_FORMAT_BC2_UNORM = 74;
+const uint32_t DXGI_FORMAT_BC3_UNORM = 77;
+const uint32_t DXGI_FORMAT_BC4_UNORM = 80;
+const uint32_t DXGI_FORMAT_BC4_SNORM = 81;
+const uint32_t DXGI_FORMAT_BC5_UNORM = 83;
+const uint32_t DXGI_FORMAT_BC5_SNORM = 84;
+
+struct DDSInfo
+{
+	unsigned int width;
+	unsigned int height;
+	uint8_t levels;
+	ColorFormat format;
+	size_t dataOffset;
+};
+
+static uint32_t MakeFourCC(const char *code);
+static uint32_t ReadUInt32(const uint8_t *in, size_t offset);
+static bool ParseDDSHeader(const uint8_t *in, size_t size, DDSInfo *info);
+static size_t GetDDSLevelSize(const DDSInfo &info, uint8_t level);
+
+
+DDSCodec::DDSCodec()
+{
+}
+
+DDSCodec::~DDSCodec()
+{
+}
+
+uint8_t DDSCodec::getMipmapLevels(std::vector<uint8_t> &in)
+{
+	DDSInfo info;
+
+	if (ParseDDSHeader(in.data(), in.size(), &info) == false)
+		return 0;
+
+	return info.levels - 1;
+}
+
+bool DDSCodec::shouldBeFlippedVerticaly()
+{
+	return true;
+}
+
+void DDSCodec::decode(std::vector<uint8_t> &in,
+	std::vector<uint8_t> *out, unsigned int *width,
+	unsigned int *height, ColorFormat *format, uint8_t level)
+{
+	size_t offset;
+	size_t length;
+
+	if (getLevelView(in.data(), in.size(), level, &offset, &length,
+		width, height, format) == false)
+	{
+		// TODO: Error handling.
+		return;
+	}
+
+	out->assign(in.begin() + offset, in.begin() + offset + length);
+}
+
+bool DDSCodec::getLevelView(const uint8_t *in, size_t size, uint8_t level,
+	size_t *offset, size_t *length, unsigned int *width,
+	unsigned int *height, ColorFormat *format)
+{
+	DDSInfo info;
+
+	if (ParseDDSHeader(in, size, &info) == false || level >= info.levels)
+		return false;
+
+	// Levels are stored back to back, largest first.
+	size_t levelOffset = info.dataOffset;
+
+	for (uint8_t i = 0; i < level; ++i)
+		levelOffset += GetDDSLevelSize(info, i);
+
+	size_t levelSize = GetDDSLevelSize(info, level);
+
+	if (levelOffset + levelSize > size)
+	{
+		// TODO: Error handling.
+		return false;
+	}
+
+	*offset = levelOffset;
+	*length = levelSize;
+	*width = std::max(1u, info.width >> level);
+	*height = std::max(1u, info.height >> level);
+	*format = info.format;
+	return true;
+}
+
+
+static uint32_t MakeFourCC(const char *code)
+{
+	return static_cast<uint32_t>(code[0]) | (static_cast<uint32_t>(code[1]) << 8) |
+		(static_cast<uint32_t>(code[2]) << 16) | (static_cast<uint32_t>(code[3]) << 24);
+}
+
+static uint32_t ReadUInt32(const uint8_t *in, size_t offset)
+{
+	uint32_t value;
+	memcpy(&value, in + offset, sizeof(value));
+	return value;
+}
+
+static bool ParseDDSHeader(const uint8_t *in, size_t size, DDSInfo *info)
+{
+	if (size < DDS_HEADER_SIZE || ReadUInt32(in, 0) != DDS_MAGIC)
+		return false;
+
+	uint32_t flags = ReadUInt32(in, 8);
+	uint32_t mipmapCount = ReadUInt32(in, 28);
+	uint32_t pixelFlags = ReadUInt32(in, 80);
+	uint32_t fourCC = ReadUInt32(in, 84);
+	uint32_t bitCount = ReadUInt32(in, 88);
+	uint32_t redMask = ReadUInt32(in, 92);
+	uint32_t greenMask = ReadUInt32(in, 96);
+	uint32_t blueMask = ReadUInt32(in, 100);
+	uint32_t alphaMask = ReadUInt32(in, 104);
+
+	info->height = ReadUInt32(in, 12);
+	info->width = ReadUInt32(in, 16);
+	info->levels = static_cast<uint8_t>(std::min(32u,
+		(flags & DDSD_MIPMAPCOUNT) && mipmapCount > 0 ? mipmapCount : 1u));
+	info->format = ColorFormat::NONE;
+	info->dataOffset = DDS_HEADER_SIZE;
+
+	if ((pixelFlags & DDPF_FOURCC) && fourCC == MakeFourCC("DX10"))
+	{
+		if (size < DDS_HEADER_SIZE + DDS_DX10_HEADER_SIZE)
+			return false;
+
+		info->dataOffset += DDS_DX10_HEADER_SIZE;
+
+		switch (ReadUInt32(in, DDS_HEADER_SIZE))
+		{
+		case DXGI_FORMAT_R8G8B8A8_UNORM:
+			info->format = ColorFormat::RGBA8;
+			break;
+
+		case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB:
+			info->format = ColorFormat::SRGB8A8;
+			break;
+
+		case DXGI_FORMAT_R8G8_UNORM:
+			info->format = ColorFormat::RG8;
+			break;
+
+		case DXGI_FORMAT_R8_UNORM:
+			info->format = ColorFormat::R8;
+			break;
+
+		case DXGI_FORMAT_BC1_UNORM:
+			info->format = ColorFormat::BC1_RGBA;
+			break;
+
+		case DXGI_FORMAT_BC2_UNORM:
+			info->format = ColorFormat::BC2_RGBA;
+			break;
+
+		case DXGI_FORMAT_BC3_UNORM:
+			info->format = ColorFormat::BC3_RGBA;
+			break;
+
+		case DXGI_FORMAT_BC4_UNORM:
+			info->format = ColorFormat::BC4_R;
+			break;
+
+		case DXGI_FORMAT_BC4_SNORM:
+			info->format = ColorFormat::BC4_SIGNED_R;
+			break;
+
+		case DXGI_FORMAT_BC5_UNORM:
+			info->format = ColorFormat::BC5_RG;
+			break;
+
+		case DXGI_FORMAT_BC5_SNORM:
+			info->format = ColorFormat::BC5_SIGNED_RG;
+			break;
+
+		default:
+			return false;
+		}
+	}
+	else if (pixelFlags & DDPF_FOURCC)
+	{
+		if (fourCC == MakeFourCC("DXT1"))
+			info->format = (pixelFlags & DDPF_ALPHAPIXELS) ?
+				ColorFormat::BC1_RGBA : ColorFormat::BC1_RGB;
+		else if (fourCC == MakeFourCC("DXT3"))
+			info->format = ColorFormat::BC2_RGBA;
+		else if (fourCC == MakeFourCC("DXT5"))
+			info->format = ColorFormat::BC3_RGBA;
+		else if (fourCC == MakeFourCC("ATI1") || fourCC == MakeFourCC("BC4U"))
+			info->format = ColorFormat::BC4_R;
+		else if (fourCC == MakeFourCC("BC4S"))
+			info->format = ColorFormat::BC4_SIGNED_R;
+		else if (fourCC == MakeFourCC("ATI2") || fourCC == MakeFourCC("BC5U"))
+			info->format = ColorFormat::BC5_RG;
+		else if (fourCC == MakeFourCC("BC5S"))
+			info->format = ColorFormat::BC5_SIGNED_RG;
+		else
+			return false;
+	}
+	else if ((pixelFlags & DDPF_RGB) && redMask == 0xFF && greenMask == 0xFF00 &&
+		blueMask == 0xFF0000)
+	{
+		if (bitCount == 32 && alphaMask == 0xFF000000)
+			info->format = ColorFormat::RGBA8;
+		else if (bitCount == 24)
+			info->format = ColorFormat::RGB8;
+		else
+			return false;
+	}
+	else if ((pixelFlags & DDPF_LUMINANCE) && bitCount == 8)
+	{
+		info->format = ColorFormat::R8;
+	}
+	else
+	{
+		return false;
+	}
+
+	return info->width > 0 && info->height > 0;
+}
+
+static size_t GetDDSLevelSize(const DDSInfo &info, uint8_t level)
+{
+	size_t width = std::max(1u, info.width >> level);
+	size_t height = std::max(1u, info.height >> level);
+	uint8_t blockSize = Image::GetBlockSize(info.format);
+
+	if (blockSize != 0)
+		return ((width + 3) / 4) * ((height + 3) / 4) * blockSize;
+
+	return width * height * Image::GetBytesPerPixel(info.format);
+}
@@ -0,0 +1,23 @@
+#ifndef DDS_CODEC_HPP
+#define DDS_CODEC_HPP
+#include "Prerequisites.hpp"
+#include "ImageCodec.hpp"
+
+class DDSCodec : public ImageCodec
+{
+public:
+	DDSCodec();
+	~DDSCodec();
+
+	uint8_t getMipmapLevels(std::vector<uint8_t> &in);
+	bool shouldBeFlippedVerticaly();
+
+	void decode(std::vector<uint8_t> &in,
+		std::vector<uint8_t> *out, unsigned int *width,
+		unsigned int *height, ColorFormat *format, uint8_t level);
+	bool getLevelView(const uint8_t *in, size_t size, uint8_t level,
+		size_t *offset, size_t *length, unsigned int *width,
+		unsigned int *height, ColorFormat *format);
+};
+
+#endif // DDS_CODEC_HPP
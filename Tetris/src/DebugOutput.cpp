@@ -0,0 +1,203 @@
+#include "DebugOutput.hpp"
+#include <chrono>
+#include <cstring>
+
+// Every group prints this many messages in full before being throttled.
+const unsigned int BUCKET_LOG_LIMIT = 5;
+const double BUCKET_LOG_INTERVAL = 5.0;
+// Guards against a broken frame flooding the log.
+const unsigned int FRAME_LOG_LIMIT = 16;
+
+static double GetSeconds()
+{
+	return std::chrono::duration<double>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static DebugSeverity GetSeverity(GLenum severity)
+{
+	switch (severity)
+	{
+	case gl::DEBUG_SEVERITY_HIGH:
+		return DebugSeverity::HIGH;
+
+	case gl::DEBUG_SEVERITY_MEDIUM:
+		return DebugSeverity::MEDIUM;
+
+	case gl::DEBUG_SEVERITY_LOW:
+		return DebugSeverity::LOW;
+
+	default:
+		return DebugSeverity::NOTIFICATION;
+	}
+}
+
+static const char* GetSourceName(GLenum source)
+{
+	switch (source)
+	{
+	case gl::DEBUG_SOURCE_API: return "api";
+	case gl::DEBUG_SOURCE_WINDOW_SYSTEM: return "window system";
+	case gl::DEBUG_SOURCE_SHADER_COMPILER: return "shader compiler";
+	case gl::DEBUG_SOURCE_THIRD_PARTY: return "third party";
+	case gl::DEBUG_SOURCE_APPLICATION: return "application";
+	default: return "other";
+	}
+}
+
+static const char* GetTypeName(GLenum type)
+{
+	switch (type)
+	{
+	case gl::DEBUG_TYPE_ERROR: return "error";
+	case gl::DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "deprecated";
+	case gl::DEBUG_TYPE_UNDEFINED_BEHAVIOR: return "undefined behavior";
+	case gl::DEBUG_TYPE_PORTABILITY: return "portability";
+	case gl::DEBUG_TYPE_PERFORMANCE: return "performance";
+	case gl::DEBUG_TYPE_MARKER: return "marker";
+	default: return "other";
+	}
+}
+
+static const char* GetSeverityName(GLenum severity)
+{
+	static const char *NAMES[] = { "high", "medium", "low", "notification" };
+	return NAMES[static_cast<int>(GetSeverity(severity))];
+}
+
+DebugOutput::DebugOutput() : mInstalled(false), mKHR(false), mFrameCounts{}, mFrameWarningCount(0),
+	mFrameLogCount(0)
+{
+}
+
+DebugOutput::~DebugOutput()
+{
+	if (mInstalled == false)
+		return;
+
+	if (mKHR)
+		gl::DebugMessageCallback(nullptr, nullptr);
+	else
+		gl::DebugMessageCallbackARB(nullptr, nullptr);
+}
+
+bool DebugOutput::install()
+{
+	if (gl::exts::var_KHR_debug && gl::exts::var_KHR_debug.GetNumMissing() == 0)
+	{
+		gl::Enable(gl::DEBUG_OUTPUT);
+		gl::Enable(gl::DEBUG_OUTPUT_SYNCHRONOUS);
+		gl::DebugMessageCallback(Callback, this);
+		gl::DebugMessageControl(gl::DONT_CARE, gl::DONT_CARE, gl::DONT_CARE, 0, nullptr, gl::TRUE_);
+		mKHR = true;
+	}
+	else if (gl::exts::var_ARB_debug_output && gl::exts::var_ARB_debug_output.GetNumMissing() == 0)
+	{
+		// Same enum values as KHR_debug.
+		gl::Enable(gl::DEBUG_OUTPUT_SYNCHRONOUS);
+		gl::DebugMessageCallbackARB(Callback, this);
+		gl::DebugMessageControlARB(gl::DONT_CARE, gl::DONT_CARE, gl::DONT_CARE, 0, nullptr, gl::TRUE_);
+	}
+	else
+	{
+		// TODO: Error handling.
+		return false;
+	}
+
+	mInstalled = true;
+	return true;
+}
+
+void DebugOutput::beginFrame()
+{
+	for (auto &count : mFrameCounts)
+		count = 0;
+
+	mFrameWarningCount = 0;
+	mFrameLogCount = 0;
+}
+
+unsigned int DebugOutput::getFrameCount(DebugSeverity severity)
+{
+	return mFrameCounts[static_cast<int>(severity)];
+}
+
+unsigned int DebugOutput::getFrameWarningCount()
+{
+	return mFrameWarningCount;
+}
+
+void DebugOutput::printSummary()
+{
+	for (auto &entry : mBuckets)
+	{
+		const Bucket &bucket = entry.second;
+		std::cout << "GL " << GetSourceName(bucket.source) << " " << GetTypeName(bucket.type)
+			<< " (" << GetSeverityName(bucket.severity) << ") id " << bucket.id
+			<< ": " << bucket.count << "x " << bucket.firstMessage << std::endl;
+	}
+}
+
+void DebugOutput::onMessage(GLenum source, GLenum type, GLuint id, GLenum severity,
+	GLsizei length, const GLchar *message)
+{
+	DebugSeverity level = GetSeverity(severity);
+	mFrameCounts[static_cast<int>(level)]++;
+
+	if (level == DebugSeverity::HIGH || level == DebugSeverity::MEDIUM ||
+		type == gl::DEBUG_TYPE_PERFORMANCE)
+		mFrameWarningCount++;
+
+	// Ids are only unique per source and type.
+	uint64_t key = (static_cast<uint64_t>(id) << 32) |
+		(static_cast<uint64_t>(type & 0xFF) << 12) |
+		(static_cast<uint64_t>(source & 0xF) << 8) |
+		static_cast<uint64_t>(level);
+	auto result = mBuckets.emplace(key, Bucket());
+	Bucket &bucket = result.first->second;
+
+	if (result.second)
+	{
+		bucket.source = source;
+		bucket.type = type;
+		bucket.id = id;
+		bucket.severity = severity;
+		bucket.count = 0;
+		bucket.suppressed = 0;
+		bucket.lastLogTime = 0.0;
+		bucket.firstMessage = length < 0 ? std::string(message) : std::string(message, length);
+	}
+
+	bucket.count++;
+
+	if (level == DebugSeverity::NOTIFICATION)
+		return;
+
+	double time = GetSeconds();
+
+	if (mFrameLogCount >= FRAME_LOG_LIMIT ||
+		(bucket.count > BUCKET_LOG_LIMIT && time - bucket.lastLogTime < BUCKET_LOG_INTERVAL))
+	{
+		bucket.suppressed++;
+		return;
+	}
+
+	mFrameLogCount++;
+	bucket.lastLogTime = time;
+	std::cout << "GL " << GetSourceName(source) << " " << GetTypeName(type)
+		<< " (" << GetSeverityName(severity) << ") id " << id << ": ";
+	std::cout.write(message, length < 0 ? strlen(message) : length);
+
+	if (bucket.suppressed > 0)
+		std::cout << " [" << bucket.suppressed << " more suppressed]";
+
+	std::cout << std::endl;
+	bucket.suppressed = 0;
+}
+
+void APIENTRY DebugOutput::Callback(GLenum source, GLenum type, GLuint id,
+	GLenum severity, GLsizei length, const GLchar *message, const void *userParam)
+{
+	DebugOutput *output = const_cast<DebugOutput*>(reinterpret_cast<const DebugOutput*>(userParam));
+	output->onMessage(source, type, id, severity, length, message);
+}
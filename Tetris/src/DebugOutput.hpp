@@ -0,0 +1,66 @@
+#ifndef DEBUG_OUTPUT_HPP
+#define DEBUG_OUTPUT_HPP
+#include "Prerequisites.hpp"
+#include <unordered_map>
+
+enum class DebugSeverity
+{
+	HIGH,
+	MEDIUM,
+	LOW,
+	NOTIFICATION,
+	COUNT
+};
+
+// Collects driver messages through KHR_debug, or ARB_debug_output as a
+// fallback. Messages are grouped by source, type, id and severity; only
+// the first few of a group are printed and after that one summary line
+// every few seconds, notifications are counted but never printed.
+class DebugOutput
+{
+public:
+	DebugOutput();
+	~DebugOutput();
+	DebugOutput(const DebugOutput&) = delete;
+	DebugOutput& operator=(const DebugOutput&) = delete;
+
+	// Needs a current context, works best with a debug context. Messages
+	// are delivered on the calling thread of the GL call that caused them.
+	bool install();
+	// Resets the per frame counters.
+	void beginFrame();
+	unsigned int getFrameCount(DebugSeverity severity);
+	// Messages of high or medium severity plus performance hints, each
+	// counted once.
+	unsigned int getFrameWarningCount();
+	// Prints every group with its total count.
+	void printSummary();
+
+private:
+	struct Bucket
+	{
+		GLenum source;
+		GLenum type;
+		GLuint id;
+		GLenum severity;
+		unsigned int count;
+		unsigned int suppressed;
+		double lastLogTime;
+		std::string firstMessage;
+	};
+
+	bool mInstalled;
+	bool mKHR;
+	unsigned int mFrameCounts[static_cast<int>(DebugSeverity::COUNT)];
+	unsigned int mFrameWarningCount;
+	unsigned int mFrameLogCount;
+	std::unordered_map<uint64_t, Bucket> mBuckets;
+
+	void onMessage(GLenum source, GLenum type, GLuint id, GLenum severity,
+		GLsizei length, const GLchar *message);
+
+	static void APIENTRY Callback(GLenum source, GLenum type, GLuint id,
+		GLenum severity, GLsizei length, const GLchar *message, const void *userParam);
+};
+
+#endif // DEBUG_OUTPUT_HPP
@@ -0,0 +1,71 @@
+#include "FrameArena.hpp"
+
+FrameArena::FrameArena(size_t capacity) : mMemory(new uint8_t[capacity]), mCapacity(capacity),
+	mOffset(0), mOverflowSize(0), mOverflow(nullptr)
+{
+}
+
+FrameArena::~FrameArena()
+{
+	releaseOverflow();
+	delete[] mMemory;
+}
+
+void* FrameArena::allocate(size_t size, size_t alignment)
+{
+	uintptr_t base = reinterpret_cast<uintptr_t>(mMemory);
+	size_t offset = ((base + mOffset + alignment - 1) & ~(alignment - 1)) - base;
+
+	if (offset + size <= mCapacity)
+	{
+		mOffset = offset + size;
+		return mMemory + offset;
+	}
+
+	// The block header keeps the data aligned as long as alignment does
+	// not exceed max_align_t.
+	size_t headerSize = (sizeof(OverflowBlock) + alignof(std::max_align_t) - 1) &
+		~(alignof(std::max_align_t) - 1);
+	OverflowBlock *block = reinterpret_cast<OverflowBlock*>(new uint8_t[headerSize + size]);
+	block->next = mOverflow;
+	mOverflow = block;
+	mOverflowSize += size + alignment;
+
+	return reinterpret_cast<uint8_t*>(block) + headerSize;
+}
+
+void FrameArena::reset()
+{
+	if (mOverflow != nullptr)
+	{
+		releaseOverflow();
+
+		size_t capacity = mCapacity + mOverflowSize;
+		delete[] mMemory;
+		mMemory = new uint8_t[capacity];
+		mCapacity = capacity;
+	}
+
+	mOffset = 0;
+	mOverflowSize = 0;
+}
+
+size_t FrameArena::getUsed()
+{
+	return mOffset + mOverflowSize;
+}
+
+size_t FrameArena::getCapacity()
+{
+	return mCapacity;
+}
+
+void FrameArena::releaseOverflow()
+{
+	while (mOverflow != nullptr)
+	{
+		OverflowBlock *next = mOverflow->next;
+		delete[] reinterpret_cast<uint8_t*>(mOverflow);
+		mOverflow = next;
+	}
+}
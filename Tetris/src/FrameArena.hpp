@@ -0,0 +1,71 @@
+#ifndef FRAME_ARENA_HPP
+#define FRAME_ARENA_HPP
+#include "Prerequisites.hpp"
+#include <cstddef>
+
+// Bump allocator for data that only lives until the end of a frame.
+// Nothing is freed individually, reset() drops everything at once. When
+// a frame needs more than the capacity the rest comes from the heap and
+// the arena grows to the peak on the next reset.
+class FrameArena
+{
+public:
+	explicit FrameArena(size_t capacity);
+	~FrameArena();
+	FrameArena(const FrameArena&) = delete;
+	FrameArena& operator=(const FrameArena&) = delete;
+
+	void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+	void reset();
+	size_t getUsed();
+	size_t getCapacity();
+
+private:
+	struct OverflowBlock
+	{
+		OverflowBlock *next;
+	};
+
+	uint8_t *mMemory;
+	size_t mCapacity;
+	size_t mOffset;
+	size_t mOverflowSize;
+	OverflowBlock *mOverflow;
+
+	void releaseOverflow();
+};
+
+// Standard allocator on top of a FrameArena, deallocation does nothing.
+template<class T>
+class FrameAllocator
+{
+public:
+	typedef T value_type;
+
+	FrameAllocator(FrameArena &arena) : mArena(&arena) {}
+	template<class U>
+	FrameAllocator(const FrameAllocator<U> &other) : mArena(other.mArena) {}
+
+	T* allocate(size_t count)
+	{
+		return reinterpret_cast<T*>(mArena->allocate(count * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(T*, size_t) {}
+
+	template<class U>
+	bool operator==(const FrameAllocator<U> &other) const { return mArena == other.mArena; }
+	template<class U>
+	bool operator!=(const FrameAllocator<U> &other) const { return mArena != other.mArena; }
+
+private:
+	template<class U>
+	friend class FrameAllocator;
+
+	FrameArena *mArena;
+};
+
+template<class T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+#endif // FRAME_ARENA_HPP
@@ -0,0 +1,252 @@
+#include "FrameCapture.hpp"
+#include "Image.hpp"
+#include "PNGCodec.hpp"
+#include "Trace.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+FrameCapture::FrameCapture(unsigned int width, unsigned int height, std::string prefix,
+	CaptureFormat format, unsigned int bufferCount, unsigned int workerCount)
+	: mWidth(width), mHeight(height), mPrefix(prefix), mFormat(format),
+	mSlots(std::max(1u, bufferCount)), mNextSlot(0), mNextFrame(0),
+	mMaxJobs(2 * std::max(1u, workerCount)), mStop(false),
+	mWrittenFrames(0), mDroppedFrames(0)
+{
+	size_t size = static_cast<size_t>(width) * height * 4;
+
+	for (auto &slot : mSlots)
+	{
+		gl::GenBuffers(1, &slot.buffer);
+		gl::BindBuffer(gl::PIXEL_PACK_BUFFER, slot.buffer);
+		gl::BufferData(gl::PIXEL_PACK_BUFFER, size, nullptr, gl::STREAM_READ);
+		slot.fence = nullptr;
+		slot.frame = 0;
+	}
+
+	gl::BindBuffer(gl::PIXEL_PACK_BUFFER, 0);
+
+	for (unsigned int i = 0; i < std::max(1u, workerCount); ++i)
+		mWorkers.emplace_back(&FrameCapture::work, this);
+}
+
+FrameCapture::~FrameCapture()
+{
+	finish();
+
+	for (auto &slot : mSlots)
+		gl::DeleteBuffers(1, &slot.buffer);
+}
+
+void FrameCapture::capture()
+{
+	TRACE_SCOPE("FrameCapture::capture");
+	collect(false);
+
+	Slot &slot = mSlots[mNextSlot];
+
+	// Every buffer is still waiting for the GPU.
+	if (slot.fence != nullptr)
+	{
+		++mNextFrame;
+		++mDroppedFrames;
+		return;
+	}
+
+	gl::BindBuffer(gl::PIXEL_PACK_BUFFER, slot.buffer);
+	gl::PixelStorei(gl::PACK_ALIGNMENT, 1);
+	gl::ReadPixels(0, 0, mWidth, mHeight, gl::RGBA, gl::UNSIGNED_BYTE, nullptr);
+	gl::BindBuffer(gl::PIXEL_PACK_BUFFER, 0);
+
+	slot.fence = gl::FenceSync(gl::SYNC_GPU_COMMANDS_COMPLETE, 0);
+	// collect() polls without the flush bit, an unflushed fence may never
+	// signal when nothing else flushes, as in headless runs with no swap.
+	gl::Flush();
+	slot.frame = mNextFrame++;
+	mNextSlot = (mNextSlot + 1) % mSlots.size();
+}
+
+void FrameCapture::finish()
+{
+	collect(true);
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mStop = true;
+	}
+
+	mCondition.notify_all();
+
+	for (auto &worker : mWorkers)
+		worker.join();
+
+	mWorkers.clear();
+}
+
+unsigned int FrameCapture::getCapturedFrames()
+{
+	return mNextFrame;
+}
+
+unsigned int FrameCapture::getWrittenFrames()
+{
+	return mWrittenFrames;
+}
+
+unsigned int FrameCapture::getDroppedFrames()
+{
+	return mDroppedFrames;
+}
+
+void FrameCapture::collect(bool wait)
+{
+	size_t size = static_cast<size_t>(mWidth) * mHeight * 4;
+
+	// The slot after the last one written is the oldest, go in frame order.
+	for (size_t i = 0; i < mSlots.size(); ++i)
+	{
+		Slot &slot = mSlots[(mNextSlot + i) % mSlots.size()];
+
+		if (slot.fence == nullptr)
+			continue;
+
+		GLenum status = gl::ClientWaitSync(slot.fence,
+			wait ? gl::SYNC_FLUSH_COMMANDS_BIT : 0, wait ? 1000000000ull : 0);
+
+		if (status == gl::TIMEOUT_EXPIRED && wait == false)
+			break;
+
+		if (status == gl::ALREADY_SIGNALED || status == gl::CONDITION_SATISFIED)
+		{
+			gl::BindBuffer(gl::PIXEL_PACK_BUFFER, slot.buffer);
+			const uint8_t *pixels = reinterpret_cast<const uint8_t*>(
+				gl::MapBufferRange(gl::PIXEL_PACK_BUFFER, 0, size, gl::MAP_READ_BIT));
+
+			if (pixels != nullptr)
+			{
+				enqueue(slot.frame, pixels);
+				gl::UnmapBuffer(gl::PIXEL_PACK_BUFFER);
+			}
+			else
+				++mDroppedFrames;
+
+			gl::BindBuffer(gl::PIXEL_PACK_BUFFER, 0);
+		}
+		else
+			++mDroppedFrames;
+
+		gl::DeleteSync(slot.fence);
+		slot.fence = nullptr;
+	}
+}
+
+void FrameCapture::enqueue(unsigned int frame, const uint8_t *pixels)
+{
+	size_t size = static_cast<size_t>(mWidth) * mHeight * 4;
+	Job job;
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		// The encoders are behind.
+		if (mJobs.size() >= mMaxJobs)
+		{
+			++mDroppedFrames;
+			return;
+		}
+
+		if (!mFreeBuffers.empty())
+		{
+			job.pixels = std::move(mFreeBuffers.back());
+			mFreeBuffers.pop_back();
+		}
+	}
+
+	job.frame = frame;
+	job.pixels.resize(size);
+	memcpy(job.pixels.data(), pixels, size);
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mJobs.push_back(std::move(job));
+	}
+
+	mCondition.notify_one();
+}
+
+void FrameCapture::work()
+{
+	Trace::SetThreadName("frame capture");
+
+	for (;;)
+	{
+		Job job;
+
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			mCondition.wait(lock, [this] { return mStop || !mJobs.empty(); });
+
+			if (mJobs.empty())
+				return;
+
+			job = std::move(mJobs.front());
+			mJobs.pop_front();
+		}
+
+		write(job);
+
+		std::lock_guard<std::mutex> lock(mMutex);
+		mFreeBuffers.push_back(std::move(job.pixels));
+	}
+}
+
+void FrameCapture::write(Job &job)
+{
+	TRACE_SCOPE("FrameCapture::write");
+
+	char number[16];
+	snprintf(number, sizeof(number), "_%06u", job.frame);
+	std::string fileName = mPrefix + number;
+	std::vector<uint8_t> encoded;
+	const std::vector<uint8_t> *data = &job.pixels;
+
+	if (mFormat == CaptureFormat::PNG)
+	{
+		// Read backs are bottom to top, PNG wants the top row first.
+		size_t rowSize = static_cast<size_t>(mWidth) * 4;
+
+		for (unsigned int i = 0; i < mHeight / 2; ++i)
+			std::swap_ranges(&job.pixels[i * rowSize], &job.pixels[(i + 1) * rowSize],
+				&job.pixels[(mHeight - i - 1) * rowSize]);
+
+		// Fast settings, capture has to keep up with the frame rate.
+		PNGCodec codec;
+		codec.setCompressionLevel(1);
+		codec.setFilter(PNGFilter::UP);
+		codec.encode(job.pixels.data(), mWidth, mHeight, ColorFormat::RGBA8, &encoded);
+
+		if (encoded.empty())
+		{
+			// TODO: Error handling.
+			++mDroppedFrames;
+			return;
+		}
+
+		fileName += ".png";
+		data = &encoded;
+	}
+	else
+		fileName += ".raw";
+
+	std::ofstream file(fileName, std::ios::binary);
+
+	if (!file.is_open())
+	{
+		// TODO: Error handling.
+		++mDroppedFrames;
+		return;
+	}
+
+	file.write(reinterpret_cast<const char*>(data->data()), data->size());
+	++mWrittenFrames;
+}
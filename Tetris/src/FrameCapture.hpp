@@ -0,0 +1,75 @@
+#ifndef FRAME_CAPTURE_HPP
+#define FRAME_CAPTURE_HPP
+#include "Prerequisites.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+enum class CaptureFormat
+{
+	PNG,
+	// Bottom to top RGBA8 rows without any header.
+	RAW
+};
+
+// Records every frame of the bound read framebuffer to numbered files.
+// Read backs go into a ring of pixel buffers guarded by fences and are
+// only mapped once the GPU is done with them, encoding happens on worker
+// threads. Frames are dropped instead of waiting when either falls behind.
+class FrameCapture
+{
+public:
+	FrameCapture(unsigned int width, unsigned int height, std::string prefix,
+		CaptureFormat format, unsigned int bufferCount = 3, unsigned int workerCount = 2);
+	~FrameCapture();
+	FrameCapture(const FrameCapture&) = delete;
+	FrameCapture& operator=(const FrameCapture&) = delete;
+
+	// Call after the frame is rendered and before it is presented.
+	void capture();
+	// Waits for the frames in flight and the encoders, needs the GL context.
+	void finish();
+	unsigned int getCapturedFrames();
+	unsigned int getWrittenFrames();
+	unsigned int getDroppedFrames();
+
+private:
+	struct Slot
+	{
+		GLuint buffer;
+		GLsync fence;
+		unsigned int frame;
+	};
+
+	struct Job
+	{
+		unsigned int frame;
+		std::vector<uint8_t> pixels;
+	};
+
+	unsigned int mWidth;
+	unsigned int mHeight;
+	std::string mPrefix;
+	CaptureFormat mFormat;
+	std::vector<Slot> mSlots;
+	unsigned int mNextSlot;
+	unsigned int mNextFrame;
+	unsigned int mMaxJobs;
+	std::vector<std::thread> mWorkers;
+	std::mutex mMutex;
+	std::condition_variable mCondition;
+	std::deque<Job> mJobs;
+	std::vector<std::vector<uint8_t>> mFreeBuffers;
+	bool mStop;
+	std::atomic<unsigned int> mWrittenFrames;
+	std::atomic<unsigned int> mDroppedFrames;
+
+	void collect(bool wait);
+	void enqueue(unsigned int frame, const uint8_t *pixels);
+	void work();
+	void write(Job &job);
+};
+
+#endif // FRAME_CAPTURE_HPP
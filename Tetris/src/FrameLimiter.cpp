@@ -0,0 +1,44 @@
+#include "FrameLimiter.hpp"
+#include <thread>
+
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+// Left to spinning, covers the oversleep of a 1 ms timer.
+const std::chrono::microseconds SPIN_TIME(2000);
+
+FrameLimiter::FrameLimiter(double rate)
+	: mInterval(std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+		std::chrono::duration<double>(1.0 / rate))),
+	mNext(std::chrono::steady_clock::now())
+{
+#if defined(_WIN32)
+	// The default timer tick is 15.6 ms, longer than a whole frame.
+	timeBeginPeriod(1);
+#endif
+}
+
+FrameLimiter::~FrameLimiter()
+{
+#if defined(_WIN32)
+	timeEndPeriod(1);
+#endif
+}
+
+void FrameLimiter::wait()
+{
+	auto now = std::chrono::steady_clock::now();
+
+	// A frame ran long, start over instead of rushing the next ones.
+	if (now - mNext > mInterval)
+		mNext = now;
+
+	if (mNext - now > SPIN_TIME)
+		std::this_thread::sleep_for(mNext - now - SPIN_TIME);
+
+	while (std::chrono::steady_clock::now() < mNext)
+		;
+
+	mNext += mInterval;
+}
@@ -0,0 +1,24 @@
+#ifndef FRAME_LIMITER_HPP
+#define FRAME_LIMITER_HPP
+#include "Prerequisites.hpp"
+#include <chrono>
+
+// Paces frames to a fixed rate without vsync. Sleeps for most of the wait
+// and spins the rest, sleep alone wakes up too late too often.
+class FrameLimiter
+{
+public:
+	explicit FrameLimiter(double rate);
+	~FrameLimiter();
+	FrameLimiter(const FrameLimiter&) = delete;
+	FrameLimiter& operator=(const FrameLimiter&) = delete;
+
+	// Blocks until the next frame is due.
+	void wait();
+
+private:
+	std::chrono::steady_clock::duration mInterval;
+	std::chrono::steady_clock::time_point mNext;
+};
+
+#endif // FRAME_LIMITER_HPP
@@ -0,0 +1,474 @@
+#include "Game.hpp"
+#include <algorithm>
+
+// Color index of every cell, 0 is empty.
+static const uint8_t TETRAMINO_SHAPES[7][4][4] =
+{
+	{ // I-type
+		{ 0, 0, 0, 0 },
+		{ 1, 1, 1, 1 },
+		{ 0, 0, 0, 0 },
+		{ 0, 0, 0, 0 }
+	},
+
+	{ // O-type
+		{ 0, 0, 0, 0 },
+		{ 0, 2, 2, 0 },
+		{ 0, 2, 2, 0 },
+		{ 0, 0, 0, 0 }
+	},
+
+	{ // T-type
+		{ 0, 0, 0, 0 },
+		{ 0, 3, 0, 0 },
+		{ 3, 3, 3, 0 },
+		{ 0, 0, 0, 0 }
+	},
+
+	{ // S-type
+		{ 0, 0, 0, 0 },
+		{ 0, 4, 4, 0 },
+		{ 4, 4, 0, 0 },
+		{ 0, 0, 0, 0 }
+	},
+
+	{ // Z-type
+		{ 0, 0, 0, 0 },
+		{ 5, 5, 0, 0 },
+		{ 0, 5, 5, 0 },
+		{ 0, 0, 0, 0 }
+	},
+
+	{ // J-type
+		{ 0, 0, 0, 0 },
+		{ 6, 0, 0, 0 },
+		{ 6, 6, 6, 0 },
+		{ 0, 0, 0, 0 }
+	},
+
+	{ // L-type
+		{ 0, 0, 0, 0 },
+		{ 0, 0, 7, 0 },
+		{ 7, 7, 7, 0 },
+		{ 0, 0, 0, 0 }
+	}
+};
+
+struct LevelSpeed
+{
+	int32_t gravity;
+	int32_t softDrop;
+};
+
+// Cell units per tick. A level lasts LEVEL_TICKS, each one a cell per second
+// faster than the last, starting at 2 and 30 cells per second. Both stay
+// under a cell per tick so a piece never skips a row.
+static const LevelSpeed LEVEL_SPEEDS[] =
+{
+	{ 9, 128 }, { 13, 132 }, { 17, 137 }, { 21, 141 },
+	{ 26, 145 }, { 30, 149 }, { 34, 154 }, { 38, 158 },
+	{ 43, 162 }, { 47, 166 }, { 51, 171 }, { 55, 175 },
+	{ 60, 179 }, { 64, 183 }, { 68, 188 }, { 73, 192 }
+};
+
+static const uint32_t LEVEL_COUNT = sizeof(LEVEL_SPEEDS) / sizeof(LEVEL_SPEEDS[0]);
+static const uint32_t LEVEL_TICKS = 20 * TICKS_PER_SECOND;
+// 17 cells per second.
+static const int32_t SIDE_SPEED = 73;
+static const uint32_t CLEAR_ANIMATION_TICKS = TICKS_PER_SECOND / 2;
+
+// Cell holding the given position, rounded down for negative ones too.
+static int32_t ToCell(int32_t units)
+{
+	return units >= 0 ? units / CELL_UNITS : -((CELL_UNITS - 1 - units) / CELL_UNITS);
+}
+
+Game::Game(uint32_t seed) : mColors
+	{
+		Color { 0.0f, 0.0f, 0.0f, 1.0f },
+		Color { 0.192f, 0.78f, 0.937f, 1.0f },
+		Color { 0.969f, 0.827f, 0.031f, 1.0f },
+		Color { 0.678f, 0.302f, 0.612f, 1.0f },
+		Color { 0.004f, 0.8f, 0.0f, 1.0f },
+		Color { 0.8f, 0.0f, 0.0f, 1.0f },
+		Color { 0.0f, 0.0f, 0.8f, 1.0f },
+		Color { 0.937f, 0.475f, 0.129f, 1.0f },
+	},
+	mX(0), mY(0), mTicks(0), mPoints(0), mNeedNew(true), mGameOver(false), mSpace(0), mDrop(0),
+	mRemoveAnimation(false), mAnimationTicks(0), mLinesToRemove{ -1, -1, -1, -1 },
+	mRandom(seed * 2654435761u + 0x9E3779B9u)
+{
+	// xorshift never leaves zero.
+	if (mRandom == 0)
+		mRandom = 1;
+
+	GetColumnTops(mBoard, mColumnTops);
+
+	for (int i = 0; i < 8; i++)
+	{
+		mGhostColors[i] = mColors[i];
+		mGhostColors[i].a = 0.3f;
+	}
+
+	for (int t = 0; t < 7; t++)
+	{
+		for (int i = 0; i < 4; i++)
+		{
+			for (int j = 0; j < 4; j++)
+			{
+				uint8_t color = TETRAMINO_SHAPES[t][i][j];
+				mTetraminoType[t][i][j] = color == 0 ? nullptr : &mColors[color];
+			}
+		}
+	}
+}
+
+Game::~Game()
+{
+}
+
+void Game::update(const GameInput &input)
+{
+	int32_t dx = 0;
+	int32_t dy = 0;
+	int32_t ix = 0, iy = 0;
+
+	if (mGameOver == true)
+		return;
+
+	if (input.rotate)
+		mSpace += 1;
+	else
+		mSpace = 0;
+
+	if (input.drop)
+		mDrop += 1;
+	else
+		mDrop = 0;
+
+	if (input.left)
+		dx = -SIDE_SPEED;
+
+	if (input.right)
+		dx = SIDE_SPEED;
+
+	const LevelSpeed &speed = LEVEL_SPEEDS[std::min(mTicks / LEVEL_TICKS, LEVEL_COUNT - 1)];
+	++mTicks;
+
+	if (input.down)
+		dy = speed.softDrop;
+	else
+		dy = speed.gravity;
+
+	// Checks if it's time to choose new tetramino and if so
+	// places in on top of the table.
+	if (mNeedNew)
+	{
+		CopyTetramino(mCurrTetramino, mTetraminoType[nextRandom() % 7]);
+		GetTopCoords(mCurrTetramino, GameBoard::COLUMNS, &ix, &iy);
+		mX = ix * CELL_UNITS;
+		mY = iy * CELL_UNITS;
+
+		if (!CheckCollision(mBoard, mCurrTetramino, ix, iy))
+		{
+			mGameOver = true;
+			return;
+		}
+
+		mNeedNew = false;
+	}
+
+	// Rotating tetramino.
+	if (mSpace == 1)
+	{
+		RotateTetraminoRight(mCurrTetramino);
+
+		ix = ToCell(mX);
+		iy = ToCell(mY);
+
+		if (CheckCollision(mBoard, mCurrTetramino, ix, iy));
+		else if (CheckCollision(mBoard, mCurrTetramino, ix + 1, iy))
+			mX += CELL_UNITS;
+		else if (CheckCollision(mBoard, mCurrTetramino, ix - 1, iy))
+			mX -= CELL_UNITS;
+		else
+		{
+			RotateTetraminoLeft(mCurrTetramino);
+			RotateTetraminoLeft(mCurrTetramino);
+
+			if (!CheckCollision(mBoard, mCurrTetramino, ix, iy))
+				RotateTetraminoRight(mCurrTetramino);
+		}
+	}
+
+	ix = ToCell(mX);
+	iy = ToCell(mY);
+
+	// Hard drop lands the piece right away.
+	if (mDrop == 1)
+	{
+		iy += GetDropDistance(mBoard, mColumnTops, mCurrTetramino, ix, iy);
+		mY = iy * CELL_UNITS;
+		lockTetramino(ix, iy);
+	}
+	// Tetramino go down or stays on its place.
+	else if (!CheckCollision(mBoard, mCurrTetramino, ix, ToCell(mY + dy)))
+		lockTetramino(ix, iy);
+	else if (CheckCollision(mBoard, mCurrTetramino, ToCell(mX + dx), ToCell(mY + dy)))
+		mX += dx;
+
+	mY += dy;
+
+	if (mRemoveAnimation == false && mNeedNew == true)
+	{
+		LookForLines(mBoard, mLinesToRemove);
+		mAnimationTicks = 0;
+
+		if (mLinesToRemove[0] != -1)
+			mRemoveAnimation = true;
+	}
+
+	if (mRemoveAnimation == true)
+	{
+		if (mAnimationTicks > CLEAR_ANIMATION_TICKS)
+		{
+			uint32_t sum = 0;
+			uint32_t multiplier = 0;
+			for (int i = 0; i < 4 && mLinesToRemove[i] != -1; i++)
+			{
+				sum += (GameBoard::ROWS - mLinesToRemove[i]) * 5;
+				multiplier++;
+				RemoveLine(mBoard, mLinesToRemove[i]);
+			}
+
+			mPoints += sum * multiplier;
+			mRemoveAnimation = false;
+			GetColumnTops(mBoard, mColumnTops);
+		}
+
+		++mAnimationTicks;
+	}
+}
+
+void Game::buildBlockVertices(FrameVector<Vertex> &vertices, float x, float y,
+	float width, float height)
+{
+	// A piece that just landed is already part of the table.
+	bool falling = mNeedNew == false && mGameOver == false;
+	int32_t ix = ToCell(mX);
+	int32_t iy = ToCell(mY);
+	int32_t ghostY = iy;
+	Color* ghost[4][4];
+
+	// The ghost goes in first, the piece covers it where they overlap.
+	if (falling)
+	{
+		ghostY += GetDropDistance(mBoard, mColumnTops, mCurrTetramino, ix, iy);
+
+		for (int i = 0; i < 4; i++)
+		{
+			for (int j = 0; j < 4; j++)
+			{
+				Color *color = mCurrTetramino[i][j];
+				ghost[i][j] = color == nullptr ? nullptr : &mGhostColors[color - mColors];
+			}
+		}
+
+		PlaceTetramino(mBoard, ghost, ix, ghostY);
+		PlaceTetramino(mBoard, mCurrTetramino, ix, iy);
+	}
+
+	BuildBlockVertices(mBoard, x, y, width, height, vertices);
+
+	if (falling)
+	{
+		RemoveTetramino(mBoard, mCurrTetramino, ix, iy);
+		RemoveTetramino(mBoard, ghost, ix, ghostY);
+	}
+}
+
+void Game::lockTetramino(int32_t x, int32_t y)
+{
+	PlaceTetramino(mBoard, mCurrTetramino, x, y);
+	mNeedNew = true;
+
+	for (int i = 0; i < 4; i++)
+	{
+		for (int j = 0; j < 4; j++)
+		{
+			if (mCurrTetramino[i][j] != nullptr && y + i < mColumnTops[x + j])
+				mColumnTops[x + j] = static_cast<uint8_t>(y + i);
+		}
+	}
+}
+
+uint32_t Game::nextRandom()
+{
+	mRandom ^= mRandom << 13;
+	mRandom ^= mRandom >> 17;
+	mRandom ^= mRandom << 5;
+	return mRandom;
+}
+
+uint32_t Game::getPoints()
+{
+	return mPoints;
+}
+
+bool Game::isGameOver()
+{
+	return mGameOver;
+}
+
+uint32_t Game::getClearedRows()
+{
+	uint32_t rows = 0;
+
+	if (mRemoveAnimation == false)
+		return 0;
+
+	// The hidden rows are above the visible board.
+	for (int i = 0; i < 4 && mLinesToRemove[i] != -1; i++)
+		rows |= 1u << (mLinesToRemove[i] - GameBoard::HIDDEN_ROWS);
+
+	return rows;
+}
+
+void CreateGrid(std::vector<Vertex> &vertices, std::vector<GLushort> &indices,
+	int32_t columns, int32_t rows, float x, float y, float width, float height)
+{
+	float dw = width / columns;
+	float dh = height / rows;
+
+	// Only the border points are needed, every line joins two of them.
+	// Bottom and top edge first, then the inner points of the side edges.
+	for (int32_t i = 0; i <= columns; i++)
+		vertices.push_back(Vertex{ x + dw * i, y, 0.0f, 0.0f, 1.0f, 1.0f });
+
+	for (int32_t i = 0; i <= columns; i++)
+		vertices.push_back(Vertex{ x + dw * i, y + height, 0.0f, 0.0f, 1.0f, 1.0f });
+
+	for (int32_t j = 1; j < rows; j++)
+	{
+		vertices.push_back(Vertex{ x, y + j * dh, 0.0f, 0.0f, 1.0f, 1.0f });
+		vertices.push_back(Vertex{ x + width, y + j * dh, 0.0f, 0.0f, 1.0f, 1.0f });
+	}
+
+	GLushort top = columns + 1;
+	GLushort sides = 2 * (columns + 1);
+
+	for (GLushort i = 0; i <= columns; i++)
+	{
+		indices.push_back(i);
+		indices.push_back(top + i);
+	}
+
+	indices.push_back(0);
+	indices.push_back(columns);
+
+	for (GLushort j = 0; j < rows - 1; j++)
+	{
+		indices.push_back(sides + 2 * j);
+		indices.push_back(sides + 2 * j + 1);
+	}
+
+	indices.push_back(top);
+	indices.push_back(top + columns);
+}
+
+void GetTopCoords(Color* (*tetramino)[4], int32_t columns, int32_t *x, int32_t *y)
+{
+	*x = (columns - 4) / 2;
+	
+	for (int i = 0; i < 4; i++)
+	{
+		for(int j = 0; j < 4; j++) // Columns first!
+		{
+			if (!(tetramino[i][j] == nullptr))
+			{
+				*y = -i;
+				return;
+			}
+		}
+	}
+}
+
+void CopyTetramino(Color * (*dst)[4], Color* (*src)[4])
+{
+	for (int i = 0; i < 4; i++)
+	{
+		for (int j = 0; j < 4; j++)
+			dst[i][j] = src[i][j];
+	}
+
+}
+
+void RotateTetraminoRight(Color* (*tetramino)[4])
+{
+	// [0][0] [0][1]  [0][2]  [0][3]
+	// [1][0] [1][1]  [1][2]  [1][3]
+	// [2][0] [2][1]  [2][2]  [2][3]
+	// [3][0] [3][1]  [3][2]  [3][3]
+	Color *tmp;
+	tmp = tetramino[3][0];
+	tetramino[3][0] = tetramino[3][3];
+	tetramino[3][3] = tetramino[0][3];
+	tetramino[0][3] = tetramino[0][0];
+	tetramino[0][0] = tmp;
+
+	tmp = tetramino[2][0];
+	tetramino[2][0] = tetramino[3][2];
+	tetramino[3][2] = tetramino[1][3];
+	tetramino[1][3] = tetramino[0][1];
+	tetramino[0][1] = tmp;
+
+	tmp = tetramino[1][0];
+	tetramino[1][0] = tetramino[3][1];
+	tetramino[3][1] = tetramino[2][3];
+	tetramino[2][3] = tetramino[0][2];
+	tetramino[0][2] = tmp;
+
+	tmp = tetramino[2][1];
+	tetramino[2][1] = tetramino[2][2];
+	tetramino[2][2] = tetramino[1][2];
+	tetramino[1][2] = tetramino[1][1];
+	tetramino[1][1] = tmp;
+}
+
+void RotateTetraminoLeft(Color* (*tetramino)[4])
+{
+	// [0][0] [0][1]  [0][2]  [0][3]
+	// [1][0] [1][1]  [1][2]  [1][3]
+	// [2][0] [2][1]  [2][2]  [2][3]
+	// [3][0] [3][1]  [3][2]  [3][3]
+	Color *tmp;
+	tmp = tetramino[3][0];
+	tetramino[3][0] = tetramino[0][0];
+	tetramino[0][0] = tetramino[0][3];
+	tetramino[0][3] = tetramino[3][3];
+	tetramino[3][3] = tmp;
+
+	tmp = tetramino[2][0];
+	tetramino[2][0] = tetramino[0][1];
+	tetramino[0][1] = tetramino[1][3];
+	tetramino[1][3] = tetramino[3][2];
+	tetramino[3][2] = tmp;
+
+	tmp = tetramino[1][0];
+	tetramino[1][0] = tetramino[0][2];
+	tetramino[0][2] = tetramino[2][3];
+	tetramino[2][3] = tetramino[3][1];
+	tetramino[3][1] = tmp;
+
+	tmp = tetramino[2][1];
+	tetramino[2][1] = tetramino[1][1];
+	tetramino[1][1] = tetramino[1][2];
+	tetramino[1][2] = tetramino[2][2];
+	tetramino[2][2] = tmp;
+
+	// [0][3] [1][3] [2][3] [3][3]
+	// [0][2] [1][2] [2][2] [3][2]
+	// [0][1] [1][1] [2][1] [3][1]
+	// [0][0] [1][0] [2][0] [3][0]
+}
+
@@ -0,0 +1,77 @@
+#ifndef GAME_HPP
+#define GAME_HPP
+#include "Prerequisites.hpp"
+#include "Board.hpp"
+
+// Game ticks per second of play, one update() call is one tick.
+const uint32_t TICKS_PER_SECOND = 60;
+// Positions are fixed point, this many units to a cell.
+const int32_t CELL_UNITS = 256;
+
+// The standard 10 by 20 board.
+typedef Board<10, 20> GameBoard;
+static_assert(GameBoard::VISIBLE_ROWS <= 32, "Cleared rows are reported as a 32 bit mask");
+
+struct GameInput
+{
+	bool left;
+	bool right;
+	bool down;
+	bool rotate;
+	bool drop;
+};
+
+void CreateGrid(std::vector<Vertex> &vertices, std::vector<GLushort> &indices,
+	int32_t columns, int32_t rows, float x, float y, float width, float height);
+// Spawn position of a piece, centered on a board of the given width.
+void GetTopCoords(Color* (*tetramino)[4], int32_t columns, int32_t *x, int32_t *y);
+void CopyTetramino(Color* (*dst)[4], Color* (*src)[4]);
+void RotateTetraminoLeft(Color* (*tetramino)[4]);
+void RotateTetraminoRight(Color* (*tetramino)[4]);
+
+// Game state without any window or GL dependency, advanced in fixed ticks.
+class Game
+{
+public:
+	// The same seed and inputs play the same game on every platform.
+	explicit Game(uint32_t seed);
+	~Game();
+	Game(const Game&) = delete;
+	Game& operator=(const Game&) = delete;
+
+	// Advances the game by one tick, integer math only.
+	void update(const GameInput &input);
+	// Appends the board, falling piece and its landing spot included.
+	void buildBlockVertices(FrameVector<Vertex> &vertices, float x, float y,
+		float width, float height);
+	uint32_t getPoints();
+	bool isGameOver();
+	// Bit i is set while visible row i, counted from the top, is cleared.
+	uint32_t getClearedRows();
+
+private:
+	void lockTetramino(int32_t x, int32_t y);
+
+	Color mColors[8];
+	Color mGhostColors[8];
+	GameBoard mBoard;
+	uint8_t mColumnTops[GameBoard::COLUMNS];
+	Color* mTetraminoType[7][4][4];
+	Color* mCurrTetramino[4][4];
+	int32_t mX, mY;
+	uint32_t mTicks;
+	uint32_t mPoints;
+	bool mNeedNew;
+	bool mGameOver;
+	int mSpace;
+	int mDrop;
+	bool mRemoveAnimation;
+	uint32_t mAnimationTicks;
+	int32_t mLinesToRemove[4];
+	uint32_t mRandom;
+
+	// xorshift32, the C runtime's rand() differs between platforms.
+	uint32_t nextRandom();
+};
+
+#endif // GAME_HPP
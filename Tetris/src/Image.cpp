@@ -1,24 +1,37 @@
 #include "Image.hpp"
+#include "BlockCompression.hpp"
+#include "ColorConversion.hpp"
+#include "ImageFilter.hpp"
+#include "MappedFile.hpp"
+#include "Parallel.hpp"
+#include "Trace.hpp"
+#include <algorithm>
+#include <cstring>
 
 static const uint8_t BASE_LEVEL = 0;
 
-Image::Image() : mBytes(), mLevels(0), mMipmaps()
+Image::Image() : mBytes(), mMipmaps(), mLevels(0), mWidth(0), mHeight(0), mFormat(ColorFormat::NONE),
+	mTopDown(false), mView(nullptr), mViewSize(0)
 {
 }
 
-Image::Image(std::string fileName, ImageCodec *codec) : mBytes(), mLevels(0), mMipmaps()
+Image::Image(std::string fileName, ImageCodec *codec)
+	: mBytes(), mMipmaps(), mLevels(0), mWidth(0), mHeight(0), mFormat(ColorFormat::NONE),
+	mTopDown(false), mView(nullptr), mViewSize(0)
 {
 	loadFromFile(fileName, codec);
 }
 
 Image::Image(unsigned int width, unsigned int height, ColorFormat format, std::vector<uint8_t> bytes)
-	: mBytes(), mLevels(0), mMipmaps()
+	: mBytes(), mMipmaps(), mLevels(0), mWidth(0), mHeight(0), mFormat(ColorFormat::NONE),
+	mTopDown(false), mView(nullptr), mViewSize(0)
 {
 	create(width, height, format, bytes);
 }
 
 Image::Image(unsigned int width, unsigned int height, ColorFormat format, uint8_t *bytes)
-	: mBytes(), mLevels(0), mMipmaps()
+	: mBytes(), mMipmaps(), mLevels(0), mWidth(0), mHeight(0), mFormat(ColorFormat::NONE),
+	mTopDown(false), mView(nullptr), mViewSize(0)
 {
 	create(width, height, format, bytes);
 }
@@ -27,14 +40,15 @@ Image::~Image()
 {
 }
 
-void Image::loadFromFile(std::string fileName, ImageCodec *codec)
+bool Image::loadFromFile(std::string fileName, ImageCodec *codec)
 {
+	TRACE_SCOPE("Image::loadFromFile");
 	std::ifstream in(fileName, std::ifstream::binary);
 
 	if (in.is_open() == false)
 	{
 		// TODO: Error handling.
-		return;
+		return false;
 	}
 
 	std::vector<uint8_t> data;
@@ -48,7 +62,11 @@ void Image::loadFromFile(std::string fileName, ImageCodec *codec)
 
 	in.close();
 
-	return loadFromMemory(data, codec);
+	mWidth = mHeight = 0;
+	mFormat = ColorFormat::NONE;
+	loadFromMemory(data, codec);
+
+	return mWidth != 0 && mHeight != 0;
 }
 
 void Image::loadFromMemory(std::vector<uint8_t> &memory, ImageCodec *codec, uint8_t level)
@@ -67,19 +85,86 @@ void Image::loadFromMemory(std::vector<uint8_t> &memory, ImageCodec *codec, uint
 			{
 				std::shared_ptr<Image> mipmap = std::make_shared<Image>();
 				mipmap->loadFromMemory(memory, codec, i + 1);
-
-				if (shouldFlip)
-					mipmap->flipVerticaly();
-
 				mMipmaps.at(i) = mipmap;
 			}
 		}
 	}
 
+	releaseMapping();
 	codec->decode(memory, &mBytes, &mWidth, &mHeight, &mFormat, level);
+	mTopDown = shouldFlip;
+
+	if (shouldFlip)
+		flipVerticaly();
+}
+
+void Image::loadFromMappedFile(std::string fileName, ImageCodec *codec)
+{
+	std::shared_ptr<MappedFile> mapping = std::make_shared<MappedFile>();
+
+	if (mapping->open(fileName) == false)
+	{
+		// TODO: Error handling.
+		return;
+	}
+
+	// Codecs that can't hand out views decode from the mapping as usual.
+	if (loadView(mapping, codec, BASE_LEVEL) == false)
+	{
+		std::vector<uint8_t> data(mapping->getData(), mapping->getData() + mapping->getSize());
+		return loadFromMemory(data, codec);
+	}
+
+	mMipmaps.clear();
+
+	for (uint8_t level = BASE_LEVEL + 1; ; ++level)
+	{
+		std::shared_ptr<Image> mipmap = std::make_shared<Image>();
+
+		if (mipmap->loadView(mapping, codec, level) == false)
+			break;
+
+		mMipmaps.push_back(mipmap);
+	}
+
+	mLevels = static_cast<uint8_t>(mMipmaps.size());
+}
+
+void Image::saveToFile(std::string fileName, ImageCodec *codec)
+{
+	std::vector<uint8_t> data;
+	bool shouldFlip = codec->shouldBeFlippedVerticaly() != mTopDown;
+
+	// Flip to the codec's row order for the duration of the encode.
+	if (shouldFlip)
+		flipVerticaly();
+
+	if (codec->shouldBeFlippedVerticaly() != mTopDown)
+	{
+		// TODO: Error handling.
+		return;
+	}
+
+	codec->encode(getData(), mWidth, mHeight, mFormat, &data);
 
 	if (shouldFlip)
 		flipVerticaly();
+
+	if (data.empty())
+	{
+		// TODO: Error handling.
+		return;
+	}
+
+	std::ofstream out(fileName, std::ios::binary);
+
+	if (out.is_open() == false)
+	{
+		// TODO: Error handling.
+		return;
+	}
+
+	out.write(reinterpret_cast<const char*>(data.data()), data.size());
 }
 
 uint8_t Image::getMaxMipmapLevel()
@@ -97,18 +182,22 @@ std::shared_ptr<Image> Image::getMipmap(uint8_t level)
 
 void Image::create(unsigned int width, unsigned int height, ColorFormat format, std::vector<uint8_t> bytes)
 {
+	releaseMapping();
 	mWidth = width;
 	mHeight = height;
 	mFormat = format;
+	mTopDown = false;
 	mBytes = bytes;
 }
 
 void Image::create(unsigned int width, unsigned int height, ColorFormat format, uint8_t *bytes)
 {
+	releaseMapping();
 	mWidth = width;
 	mHeight = height;
 	mFormat = format;
-	mBytes.resize(mWidth * mHeight * static_cast<unsigned int>(mFormat));
+	mTopDown = false;
+	mBytes.resize(mWidth * mHeight * GetBytesPerPixel(mFormat));
 
 	if (bytes != nullptr)
 		memcpy(mBytes.data(), bytes, mBytes.size());
@@ -129,80 +218,423 @@ unsigned int Image::getHeight()
 	return mHeight;
 }
 
+bool Image::isTopDown()
+{
+	return mTopDown;
+}
+
 const std::vector<uint8_t>& Image::getBytes()
 {
+	// Mapped images have to be copied out to be returned as a vector.
+	detach();
 	return mBytes;
 }
 
+const uint8_t* Image::getData()
+{
+	return mView != nullptr ? mView : mBytes.data();
+}
+
+size_t Image::getDataSize()
+{
+	return mView != nullptr ? mViewSize : mBytes.size();
+}
+
 void Image::setPixel(unsigned int x, unsigned int y, uint8_t *bytes)
 {
-	unsigned int row = y * mWidth * static_cast<unsigned int>(mFormat);
-	unsigned int col = x * static_cast<unsigned int>(mFormat);
+	uint8_t bytesPerPixel = GetBytesPerPixel(mFormat);
+	unsigned int row = y * mWidth * bytesPerPixel;
+	unsigned int col = x * bytesPerPixel;
+
+	detach();
 
-	for (char i = 0; i < static_cast<char>(mFormat); ++i)
+	for (uint8_t i = 0; i < bytesPerPixel; ++i)
 		mBytes.at(row + col + i) = bytes[i];
 }
 
 void Image::flipVerticaly()
 {
-	uint8_t bytesPerPixel;
+	uint8_t bytesPerPixel = GetBytesPerPixel(mFormat);
 	uint8_t flipByte;
 
+	if (mFormat == ColorFormat::NONE)
+		return;
+
+	if (bytesPerPixel == 0)
+	{
+		if (flipCompressedVerticaly())
+			mTopDown = !mTopDown;
+
+		return;
+	}
+
+	mTopDown = !mTopDown;
+
+	uint8_t *data = getMutableData();
+
+	for (unsigned int v = 0; v < mHeight / 2; ++v)
+	{
+		unsigned int row1 = v * mWidth * bytesPerPixel;
+		unsigned int row2 = (mHeight - v - 1) * mWidth * bytesPerPixel;
+
+		for (unsigned int u = 0; u < mWidth; ++u)
+		{
+			unsigned int pixel1 = row1 + u * bytesPerPixel;
+			unsigned int pixel2 = row2 + u * bytesPerPixel;
+
+			for (uint8_t i = 0; i < bytesPerPixel; ++i)
+			{
+				flipByte = data[pixel1 + i];
+				data[pixel1 + i] = data[pixel2 + i];
+				data[pixel2 + i] = flipByte;
+			}
+		}
+	}
+}
+
+void Image::convert(ColorFormat format, bool dither)
+{
+	uint8_t srcBytesPerPixel = GetBytesPerPixel(mFormat);
+	uint8_t dstBytesPerPixel = GetBytesPerPixel(format);
+
+	if (format == mFormat)
+		return;
+
+	if (srcBytesPerPixel == 0 || dstBytesPerPixel == 0)
+	{
+		// TODO: Error handling.
+		return;
+	}
+
+	size_t pixelCount = static_cast<size_t>(mWidth) * mHeight;
+	std::vector<uint8_t> bytes(pixelCount * dstBytesPerPixel);
+
+	// Both sides are sRGB, going through linear RGBA8 would band the dark
+	// tones for nothing. The channels are copied as they are.
+	if (mFormat == ColorFormat::SRGB8 && format == ColorFormat::SRGB8A8)
+		ExpandRGB8ToRGBA8(getData(), bytes.data(), pixelCount);
+	else if (mFormat == ColorFormat::SRGB8A8 && format == ColorFormat::SRGB8)
+		EncodeFromRGBA8(getData(), ColorFormat::RGB8, bytes.data(), mWidth, mHeight, false);
+	else if (mFormat == ColorFormat::RGBA8)
+		EncodeFromRGBA8(getData(), format, bytes.data(), mWidth, mHeight, dither);
+	else if (format == ColorFormat::RGBA8)
+		DecodeToRGBA8(getData(), mFormat, bytes.data(), pixelCount);
+	else
+	{
+		std::vector<uint8_t> rgba(pixelCount * 4);
+		DecodeToRGBA8(getData(), mFormat, rgba.data(), pixelCount);
+		EncodeFromRGBA8(rgba.data(), format, bytes.data(), mWidth, mHeight, dither);
+	}
+
+	releaseMapping();
+	mBytes.swap(bytes);
+	mFormat = format;
+
+	for (auto &mipmap : mMipmaps)
+		mipmap->convert(format, dither);
+}
+
+void Image::premultiplyAlpha()
+{
+	if (mFormat != ColorFormat::RGBA8 && mFormat != ColorFormat::SRGB8A8)
+	{
+		// TODO: Error handling.
+		return;
+	}
+
+	PremultiplyAlpha(getMutableData(), static_cast<size_t>(mWidth) * mHeight);
+
+	for (auto &mipmap : mMipmaps)
+		mipmap->premultiplyAlpha();
+}
+
+void Image::generateMipmaps(MipmapFilter filter, bool gammaCorrect)
+{
+	uint8_t channels = GetBytesPerPixel(mFormat);
+
 	switch (mFormat)
 	{
 	case ColorFormat::R8:
-	case ColorFormat::R3G3B2:
-		bytesPerPixel = 1;
+	case ColorFormat::RG8:
+	case ColorFormat::RGB8:
+	case ColorFormat::RGBA8:
 		break;
 
+	case ColorFormat::SRGB8:
+	case ColorFormat::SRGB8A8:
+		gammaCorrect = true;
+		break;
+
+	default:
+		// TODO: Error handling.
+		return;
+	}
+
+	unsigned int width = mWidth;
+	unsigned int height = mHeight;
+	std::vector<float> level(static_cast<size_t>(width) * height * channels);
+	DecodeToLinear(getData(), static_cast<size_t>(width) * height, channels,
+		gammaCorrect, level.data());
+
+	// Every level is filtered from the unquantized previous one.
+	mMipmaps.clear();
+
+	while (width > 1 || height > 1)
+	{
+		unsigned int nextWidth = std::max(1u, width / 2);
+		unsigned int nextHeight = std::max(1u, height / 2);
+		size_t pixelCount = static_cast<size_t>(nextWidth) * nextHeight;
+		std::vector<float> next(pixelCount * channels);
+
+		Downsample(level.data(), width, height, channels, next.data(),
+			nextWidth, nextHeight, filter);
+
+		std::shared_ptr<Image> mipmap = std::make_shared<Image>(nextWidth, nextHeight, mFormat);
+		EncodeFromLinear(next.data(), pixelCount, channels, gammaCorrect, mipmap->mBytes.data());
+		mipmap->mTopDown = mTopDown;
+		mMipmaps.push_back(mipmap);
+
+		level.swap(next);
+		width = nextWidth;
+		height = nextHeight;
+	}
+
+	mLevels = static_cast<uint8_t>(mMipmaps.size());
+}
+
+void Image::compress(ColorFormat format)
+{
+	uint8_t blockSize = GetBlockSize(format);
+
+	if (blockSize == 0 || GetBytesPerPixel(mFormat) == 0 ||
+		format == ColorFormat::BC4_SIGNED_R || format == ColorFormat::BC5_SIGNED_RG)
+	{
+		// TODO: Error handling.
+		return;
+	}
+
+	// sRGB data is compressed as stored, there are no sRGB BC formats.
+	size_t pixelCount = static_cast<size_t>(mWidth) * mHeight;
+	std::vector<uint8_t> rgba;
+	const uint8_t *pixels = getData();
+
+	if (mFormat == ColorFormat::RGB8 || mFormat == ColorFormat::SRGB8)
+	{
+		rgba.resize(pixelCount * 4);
+		ExpandRGB8ToRGBA8(getData(), rgba.data(), pixelCount);
+		pixels = rgba.data();
+	}
+	else if (mFormat != ColorFormat::RGBA8 && mFormat != ColorFormat::SRGB8A8)
+	{
+		rgba.resize(pixelCount * 4);
+		DecodeToRGBA8(getData(), mFormat, rgba.data(), pixelCount);
+		pixels = rgba.data();
+	}
+
+	unsigned int blocksX = (mWidth + 3) / 4;
+	unsigned int blocksY = (mHeight + 3) / 4;
+	std::vector<uint8_t> bytes(static_cast<size_t>(blocksX) * blocksY * blockSize);
+
+	ParallelFor(blocksY, [&](unsigned int begin, unsigned int end)
+	{
+		uint8_t block[64];
+		uint8_t red[16];
+		uint8_t green[16];
+
+		for (unsigned int by = begin; by < end; ++by)
+		{
+			for (unsigned int bx = 0; bx < blocksX; ++bx)
+			{
+				// Blocks hanging over the edge repeat the last row and column.
+				for (unsigned int i = 0; i < 16; ++i)
+				{
+					unsigned int x = std::min(bx * 4 + i % 4, mWidth - 1);
+					unsigned int y = std::min(by * 4 + i / 4, mHeight - 1);
+					memcpy(&block[i * 4], &pixels[(static_cast<size_t>(y) * mWidth + x) * 4], 4);
+					red[i] = block[i * 4];
+					green[i] = block[i * 4 + 1];
+				}
+
+				uint8_t *out = &bytes[(static_cast<size_t>(by) * blocksX + bx) * blockSize];
+
+				switch (format)
+				{
+				case ColorFormat::BC1_RGB:
+					CompressBlockBC1(block, out, false);
+					break;
+
+				case ColorFormat::BC1_RGBA:
+					CompressBlockBC1(block, out, true);
+					break;
+
+				case ColorFormat::BC2_RGBA:
+					CompressBlockBC2(block, out);
+					break;
+
+				case ColorFormat::BC3_RGBA:
+					CompressBlockBC3(block, out);
+					break;
+
+				case ColorFormat::BC4_R:
+					CompressBlockBC4(red, out);
+					break;
+
+				default:
+					CompressBlockBC5(red, green, out);
+					break;
+				}
+			}
+		}
+	}, 4);
+
+	releaseMapping();
+	mBytes.swap(bytes);
+	mFormat = format;
+
+	for (auto &mipmap : mMipmaps)
+		mipmap->compress(format);
+}
+
+uint8_t Image::GetBytesPerPixel(ColorFormat format)
+{
+	switch (format)
+	{
+	case ColorFormat::R8:
+	case ColorFormat::R3G3B2:
+		return 1;
+
 	case ColorFormat::RG8:
 	case ColorFormat::R5G6B5:
 	case ColorFormat::RGB5A1:
 	case ColorFormat::RGBA4:
-		bytesPerPixel = 2;
-		break;
+		return 2;
 
 	case ColorFormat::RGB8:
 	case ColorFormat::SRGB8:
-		bytesPerPixel = 3;
-		break;
+		return 3;
 
 	case ColorFormat::RGBA8:
 	case ColorFormat::RGB10A2:
 	case ColorFormat::SRGB8A8:
-		bytesPerPixel = 4;
-		break;
+		return 4;
 
-	case ColorFormat::NONE:
-		return;
+	default:
+		return 0;
+	}
+}
+
+uint8_t Image::GetBlockSize(ColorFormat format)
+{
+	switch (format)
+	{
+	case ColorFormat::BC1_RGB:
+	case ColorFormat::BC1_RGBA:
+	case ColorFormat::BC4_R:
+	case ColorFormat::BC4_SIGNED_R:
+		return 8;
+
+	case ColorFormat::BC2_RGBA:
+	case ColorFormat::BC3_RGBA:
+	case ColorFormat::BC5_RG:
+	case ColorFormat::BC5_SIGNED_RG:
+		return 16;
 
 	default:
-		return flipCompressedVerticaly();
+		return 0;
 	}
+}
 
-	for (unsigned int v = 0; v < mHeight / 2; ++v)
+bool Image::flipCompressedVerticaly()
+{
+	uint8_t blockSize = GetBlockSize(mFormat);
+	void (*flipBlock)(uint8_t*, unsigned int) = nullptr;
+
+	switch (mFormat)
 	{
-		unsigned int row1 = v * mWidth * bytesPerPixel;
-		unsigned int row2 = (mHeight - v - 1) * mWidth * bytesPerPixel;
+	case ColorFormat::BC1_RGB:
+	case ColorFormat::BC1_RGBA:
+		flipBlock = FlipBlockBC1;
+		break;
+	case ColorFormat::BC2_RGBA:
+		flipBlock = FlipBlockBC2;
+		break;
+	case ColorFormat::BC3_RGBA:
+		flipBlock = FlipBlockBC3;
+		break;
+	case ColorFormat::BC4_R:
+	case ColorFormat::BC4_SIGNED_R:
+		flipBlock = FlipBlockBC4;
+		break;
+	case ColorFormat::BC5_RG:
+	case ColorFormat::BC5_SIGNED_RG:
+		flipBlock = FlipBlockBC5;
+		break;
+	default:
+		// TODO: Error handling.
+		return false;
+	}
 
-		for (unsigned int u = 0; u < mWidth; ++u)
-		{
-			unsigned int pixel1 = row1 + u * bytesPerPixel;
-			unsigned int pixel2 = row2 + u * bytesPerPixel;
+	// Block rows are swapped whole, which only works out when the last block
+	// row has no padding rows. Other heights keep the file's row order.
+	if (mHeight > 4 && mHeight % 4 != 0)
+		return false;
 
-			for (uint8_t i = 0; i < bytesPerPixel; ++i)
-			{
-				flipByte = mBytes.at(pixel1 + i);
-				mBytes.at(pixel1 + i) = mBytes.at(pixel2 + i);
-				mBytes.at(pixel2 + i) = flipByte;
-			}
-		}
+	size_t rowSize = static_cast<size_t>((mWidth + 3) / 4) * blockSize;
+	unsigned int blockRows = (mHeight + 3) / 4;
+	unsigned int rows = std::min(mHeight, 4u);
+	uint8_t *data = getMutableData();
+
+	for (unsigned int v = 0; v < blockRows / 2; ++v)
+	{
+		uint8_t *row1 = data + v * rowSize;
+		uint8_t *row2 = data + (blockRows - v - 1) * rowSize;
+		std::swap_ranges(row1, row1 + rowSize, row2);
 	}
+
+	for (size_t offset = 0; offset < rowSize * blockRows; offset += blockSize)
+		flipBlock(data + offset, rows);
+
+	return true;
+}
+
+bool Image::loadView(std::shared_ptr<MappedFile> mapping, ImageCodec *codec, uint8_t level)
+{
+	size_t offset;
+	size_t length;
+
+	if (codec->getLevelView(mapping->getData(), mapping->getSize(), level,
+		&offset, &length, &mWidth, &mHeight, &mFormat) == false)
+		return false;
+
+	mBytes.clear();
+	mMapping = mapping;
+	mView = mapping->getData() + offset;
+	mViewSize = length;
+
+	// Flipping would write every row and so copy every page of the mapping.
+	mTopDown = codec->shouldBeFlippedVerticaly();
+
+	return true;
+}
+
+uint8_t* Image::getMutableData()
+{
+	return mView != nullptr ? mView : mBytes.data();
+}
+
+void Image::detach()
+{
+	if (mView == nullptr)
+		return;
+
+	mBytes.assign(mView, mView + mViewSize);
+	releaseMapping();
 }
 
-void Image::flipCompressedVerticaly()
+void Image::releaseMapping()
 {
-	// TODO: void Image::flipCompressedVerticaly()
-	return;
+	mMapping.reset();
+	mView = nullptr;
+	mViewSize = 0;
 }
 
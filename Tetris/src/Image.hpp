@@ -2,6 +2,7 @@
 #define IMAGE_HPP
 #include "Prerequisites.hpp"
 #include "ImageCodec.hpp"
+class MappedFile;
 
 enum class ColorFormat
 {
@@ -37,6 +38,12 @@ enum class ColorFormat
 	RGBA = RGBA8,
 };
 
+enum class MipmapFilter
+{
+	BOX,
+	KAISER,
+};
+
 
 class Image
 {
@@ -53,8 +60,11 @@ public:
 	Image(const Image&) = delete;
 	Image& operator=(const Image&) = delete;
 
-	void loadFromFile(std::string fileName, ImageCodec *codec);
+	// False when the file can't be read or decoded.
+	bool loadFromFile(std::string fileName, ImageCodec *codec);
 	void loadFromMemory(std::vector<uint8_t> &memory, ImageCodec *codec, uint8_t level = 0);
+	void loadFromMappedFile(std::string fileName, ImageCodec *codec);
+	void saveToFile(std::string fileName, ImageCodec *codec);
 	uint8_t getMaxMipmapLevel();
 	std::shared_ptr<Image> getMipmap(uint8_t level);
 	virtual void create(unsigned int width, unsigned int height, ColorFormat format,
@@ -65,8 +75,22 @@ public:
 	unsigned int getWidth();
 	unsigned int getHeight();
 	const std::vector<uint8_t>& getBytes();
+	const uint8_t* getData();
+	size_t getDataSize();
 	void setPixel(unsigned int x, unsigned int y, uint8_t *bytes);
 	void flipVerticaly();
+	// Images are bottom to top, ready for GL, except views of a mapped file
+	// and block compressed levels whose height isn't a multiple of 4. Those
+	// keep the file's row order, draw them with V flipped. Flipping a view
+	// once works too but copies every page.
+	bool isTopDown();
+	void convert(ColorFormat format, bool dither = false);
+	void premultiplyAlpha();
+	void generateMipmaps(MipmapFilter filter = MipmapFilter::BOX, bool gammaCorrect = true);
+	void compress(ColorFormat format);
+
+	static uint8_t GetBytesPerPixel(ColorFormat format);
+	static uint8_t GetBlockSize(ColorFormat format);
 
 protected:
 	std::vector<uint8_t> mBytes;
@@ -75,8 +99,19 @@ protected:
 	unsigned int mWidth;
 	unsigned int mHeight;
 	ColorFormat mFormat;
+	bool mTopDown;
+
+	// Images loaded through loadFromMappedFile() point into the mapping
+	// instead of owning mBytes, until something needs to resize the data.
+	std::shared_ptr<MappedFile> mMapping;
+	uint8_t *mView;
+	size_t mViewSize;
 
-	void flipCompressedVerticaly();
+	bool flipCompressedVerticaly();
+	bool loadView(std::shared_ptr<MappedFile> mapping, ImageCodec *codec, uint8_t level);
+	uint8_t* getMutableData();
+	void detach();
+	void releaseMapping();
 };
 
 
@@ -18,7 +18,15 @@ public:
 	virtual void decode(std::vector<uint8_t> &in, 
 		std::vector<uint8_t> *out, unsigned int *width,
 		unsigned int *height, ColorFormat *format, uint8_t level) = 0;
-	//virtual void encode() = 0;
+
+	// Codecs storing levels ready for upload can report where a level lives
+	// inside the encoded data, so it can be used without a decoded copy.
+	virtual bool getLevelView(const uint8_t*, size_t, uint8_t, size_t*, size_t*,
+		unsigned int*, unsigned int*, ColorFormat*) { return false; }
+
+	// Rows are taken top to bottom, out is left empty on failure.
+	virtual void encode(const uint8_t*, unsigned int, unsigned int, ColorFormat,
+		std::vector<uint8_t>*) {}
 };
 
 #endif // IMAGE_CODEC_HPP
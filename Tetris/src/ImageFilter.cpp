@@ -0,0 +1,279 @@
+#include "ImageFilter.hpp"
+#include "Image.hpp"
+#include "Parallel.hpp"
+#include "Simd.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+static const float PI = 3.14159265358979f;
+static const float KAISER_RADIUS = 1.5f;
+static const float KAISER_ALPHA = 4.0f;
+static const unsigned int SRGB_ENCODE_STEPS = 4096;
+static const unsigned int PIXELS_PER_RANGE = 16384;
+
+struct FilterTaps
+{
+	unsigned int taps;
+	std::vector<unsigned int> indices;
+	std::vector<float> weights;
+};
+
+static const float *GetSRGBDecodeTable()
+{
+	static const std::array<float, 256> table = []()
+	{
+		std::array<float, 256> values;
+
+		for (int i = 0; i < 256; ++i)
+		{
+			float c = i / 255.0f;
+			values[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+		}
+
+		return values;
+	}();
+
+	return table.data();
+}
+
+static const uint8_t *GetSRGBEncodeTable()
+{
+	static const std::array<uint8_t, SRGB_ENCODE_STEPS> table = []()
+	{
+		std::array<uint8_t, SRGB_ENCODE_STEPS> values;
+
+		for (unsigned int i = 0; i < SRGB_ENCODE_STEPS; ++i)
+		{
+			float c = i / static_cast<float>(SRGB_ENCODE_STEPS - 1);
+			c = c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+			values[i] = static_cast<uint8_t>(c * 255.0f + 0.5f);
+		}
+
+		return values;
+	}();
+
+	return table.data();
+}
+
+static float BesselI0(float x)
+{
+	float sum = 1.0f;
+	float term = 1.0f;
+
+	for (int k = 1; k < 20; ++k)
+	{
+		term *= (x / (2.0f * k)) * (x / (2.0f * k));
+		sum += term;
+	}
+
+	return sum;
+}
+
+static float Sinc(float x)
+{
+	if (std::fabs(x) < 1e-5f)
+		return 1.0f;
+
+	return std::sin(PI * x) / (PI * x);
+}
+
+static float Kaiser(float x)
+{
+	float t = x / KAISER_RADIUS;
+
+	if (t <= -1.0f || t >= 1.0f)
+		return 0.0f;
+
+	return Sinc(x) * BesselI0(KAISER_ALPHA * std::sqrt(1.0f - t * t)) / BesselI0(KAISER_ALPHA);
+}
+
+static FilterTaps BuildTaps(unsigned int srcSize, unsigned int dstSize, MipmapFilter filter)
+{
+	// Weights are computed in destination pixel units, so the same kernel
+	// handles exact halving and the uneven steps of odd dimensions.
+	float scale = static_cast<float>(srcSize) / dstSize;
+	float radius = filter == MipmapFilter::KAISER ? KAISER_RADIUS * scale : 0.5f * scale;
+	int lastIndex = static_cast<int>(srcSize) - 1;
+	std::vector<unsigned int> starts(dstSize);
+	std::vector<std::vector<float>> weights(dstSize);
+	FilterTaps result;
+	result.taps = 1;
+
+	for (unsigned int o = 0; o < dstSize; ++o)
+	{
+		float center = (o + 0.5f) * scale;
+		int first = static_cast<int>(std::floor(center - radius));
+		int last = static_cast<int>(std::ceil(center + radius));
+		int start = std::min(std::max(first, 0), lastIndex);
+		std::vector<float> &local = weights[o];
+		float sum = 0.0f;
+
+		local.assign(std::min(std::max(last, 0), lastIndex) - start + 1, 0.0f);
+
+		for (int i = first; i <= last; ++i)
+		{
+			float weight;
+
+			if (filter == MipmapFilter::KAISER)
+				weight = Kaiser((i + 0.5f - center) / scale);
+			else
+				weight = std::max(0.0f, std::min(i + 1.0f, center + radius) -
+					std::max(static_cast<float>(i), center - radius));
+
+			// Edges are clamped, outside texels fold back onto the border.
+			local[std::min(std::max(i, 0), lastIndex) - start] += weight;
+			sum += weight;
+		}
+
+		for (float &weight : local)
+			weight /= sum;
+
+		while (local.size() > 1 && local.back() == 0.0f)
+			local.pop_back();
+
+		while (local.size() > 1 && local.front() == 0.0f)
+		{
+			local.erase(local.begin());
+			++start;
+		}
+
+		starts[o] = start;
+		result.taps = std::max(result.taps, static_cast<unsigned int>(local.size()));
+	}
+
+	result.indices.resize(dstSize * result.taps);
+	result.weights.resize(dstSize * result.taps, 0.0f);
+
+	for (unsigned int o = 0; o < dstSize; ++o)
+	{
+		for (unsigned int t = 0; t < result.taps; ++t)
+		{
+			bool used = t < weights[o].size();
+			result.indices[o * result.taps + t] = starts[o] + (used ? t : 0);
+			result.weights[o * result.taps + t] = used ? weights[o][t] : 0.0f;
+		}
+	}
+
+	return result;
+}
+
+static void FilterVertical(const float *src, size_t rowLength, const unsigned int *indices,
+	const float *weights, unsigned int taps, float *row)
+{
+	std::fill(row, row + rowLength, 0.0f);
+
+	for (unsigned int t = 0; t < taps; ++t)
+	{
+		if (weights[t] == 0.0f)
+			continue;
+
+		const float *srcRow = src + indices[t] * rowLength;
+		size_t i = 0;
+
+#ifdef SIMD_SSE2
+		__m128 weight = _mm_set1_ps(weights[t]);
+
+		for (; i + 4 <= rowLength; i += 4)
+			_mm_storeu_ps(row + i, _mm_add_ps(_mm_loadu_ps(row + i),
+				_mm_mul_ps(weight, _mm_loadu_ps(srcRow + i))));
+#endif
+
+		for (; i < rowLength; ++i)
+			row[i] += weights[t] * srcRow[i];
+	}
+}
+
+static void FilterHorizontal(const float *row, uint8_t channels, const FilterTaps &taps,
+	float *dst, unsigned int dstWidth)
+{
+	for (unsigned int x = 0; x < dstWidth; ++x)
+	{
+		const unsigned int *indices = &taps.indices[x * taps.taps];
+		const float *weights = &taps.weights[x * taps.taps];
+
+#ifdef SIMD_SSE2
+		if (channels == 4)
+		{
+			__m128 sum = _mm_setzero_ps();
+
+			for (unsigned int t = 0; t < taps.taps; ++t)
+				sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights[t]),
+					_mm_loadu_ps(row + indices[t] * 4)));
+
+			_mm_storeu_ps(dst + x * 4, sum);
+			continue;
+		}
+#endif
+
+		for (uint8_t c = 0; c < channels; ++c)
+		{
+			float sum = 0.0f;
+
+			for (unsigned int t = 0; t < taps.taps; ++t)
+				sum += weights[t] * row[indices[t] * channels + c];
+
+			dst[x * channels + c] = sum;
+		}
+	}
+}
+
+void DecodeToLinear(const uint8_t *src, size_t pixelCount, uint8_t channels,
+	bool gammaCorrect, float *dst)
+{
+	const float *table = GetSRGBDecodeTable();
+	uint8_t colorChannels = (gammaCorrect && channels >= 3) ? 3 : 0;
+
+	ParallelFor(static_cast<unsigned int>(pixelCount), [&](unsigned int begin, unsigned int end)
+	{
+		for (size_t i = begin * channels; i < end * channels; ++i)
+		{
+			if (i % channels < colorChannels)
+				dst[i] = table[src[i]];
+			else
+				dst[i] = src[i] / 255.0f;
+		}
+	}, PIXELS_PER_RANGE);
+}
+
+void EncodeFromLinear(const float *src, size_t pixelCount, uint8_t channels,
+	bool gammaCorrect, uint8_t *dst)
+{
+	const uint8_t *table = GetSRGBEncodeTable();
+	uint8_t colorChannels = (gammaCorrect && channels >= 3) ? 3 : 0;
+
+	ParallelFor(static_cast<unsigned int>(pixelCount), [&](unsigned int begin, unsigned int end)
+	{
+		for (size_t i = begin * channels; i < end * channels; ++i)
+		{
+			float value = std::min(std::max(src[i], 0.0f), 1.0f);
+
+			if (i % channels < colorChannels)
+				dst[i] = table[static_cast<unsigned int>(value * (SRGB_ENCODE_STEPS - 1) + 0.5f)];
+			else
+				dst[i] = static_cast<uint8_t>(value * 255.0f + 0.5f);
+		}
+	}, PIXELS_PER_RANGE);
+}
+
+void Downsample(const float *src, unsigned int width, unsigned int height,
+	uint8_t channels, float *dst, unsigned int dstWidth, unsigned int dstHeight,
+	MipmapFilter filter)
+{
+	FilterTaps horizontal = BuildTaps(width, dstWidth, filter);
+	FilterTaps vertical = BuildTaps(height, dstHeight, filter);
+	size_t rowLength = static_cast<size_t>(width) * channels;
+
+	ParallelFor(dstHeight, [&](unsigned int begin, unsigned int end)
+	{
+		std::vector<float> row(rowLength);
+
+		for (unsigned int y = begin; y < end; ++y)
+		{
+			FilterVertical(src, rowLength, &vertical.indices[y * vertical.taps],
+				&vertical.weights[y * vertical.taps], vertical.taps, row.data());
+			FilterHorizontal(row.data(), channels, horizontal,
+				dst + static_cast<size_t>(y) * dstWidth * channels, dstWidth);
+		}
+	}, std::max(1u, PIXELS_PER_RANGE / std::max(1u, dstWidth)));
+}
@@ -0,0 +1,19 @@
+#ifndef IMAGE_FILTER_HPP
+#define IMAGE_FILTER_HPP
+#include "Prerequisites.hpp"
+
+enum class MipmapFilter;
+
+// Filtering is done on interleaved float pixels in linear space. When
+// gammaCorrect is set the first three channels of 3 and 4 channel images
+// are treated as sRGB encoded, alpha is always linear.
+
+void DecodeToLinear(const uint8_t *src, size_t pixelCount, uint8_t channels,
+	bool gammaCorrect, float *dst);
+void EncodeFromLinear(const float *src, size_t pixelCount, uint8_t channels,
+	bool gammaCorrect, uint8_t *dst);
+void Downsample(const float *src, unsigned int width, unsigned int height,
+	uint8_t channels, float *dst, unsigned int dstWidth, unsigned int dstHeight,
+	MipmapFilter filter);
+
+#endif // IMAGE_FILTER_HPP
@@ -0,0 +1,137 @@
+#include "MappedFile.hpp"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(_WIN32)
+
+MappedFile::MappedFile() : mData(nullptr), mSize(0), mFile(INVALID_HANDLE_VALUE), mMapping(nullptr)
+{
+}
+
+bool MappedFile::open(std::string fileName)
+{
+	close();
+
+	mFile = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (mFile == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER size;
+
+	if (GetFileSizeEx(mFile, &size) == FALSE || size.QuadPart == 0)
+	{
+		close();
+		return false;
+	}
+
+	mMapping = CreateFileMappingA(mFile, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+
+	if (mMapping == nullptr)
+	{
+		close();
+		return false;
+	}
+
+	mData = static_cast<uint8_t*>(MapViewOfFile(mMapping, FILE_MAP_COPY, 0, 0, 0));
+
+	if (mData == nullptr)
+	{
+		close();
+		return false;
+	}
+
+	mSize = static_cast<size_t>(size.QuadPart);
+	return true;
+}
+
+void MappedFile::close()
+{
+	if (mData != nullptr)
+		UnmapViewOfFile(mData);
+
+	if (mMapping != nullptr)
+		CloseHandle(mMapping);
+
+	if (mFile != INVALID_HANDLE_VALUE)
+		CloseHandle(mFile);
+
+	mData = nullptr;
+	mSize = 0;
+	mMapping = nullptr;
+	mFile = INVALID_HANDLE_VALUE;
+}
+
+#else
+
+MappedFile::MappedFile() : mData(nullptr), mSize(0), mFile(-1)
+{
+}
+
+bool MappedFile::open(std::string fileName)
+{
+	close();
+
+	mFile = ::open(fileName.c_str(), O_RDONLY);
+
+	if (mFile == -1)
+		return false;
+
+	struct stat info;
+
+	if (fstat(mFile, &info) != 0 || info.st_size == 0)
+	{
+		close();
+		return false;
+	}
+
+	void *data = mmap(nullptr, info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, mFile, 0);
+
+	if (data == MAP_FAILED)
+	{
+		close();
+		return false;
+	}
+
+	mData = static_cast<uint8_t*>(data);
+	mSize = static_cast<size_t>(info.st_size);
+	return true;
+}
+
+void MappedFile::close()
+{
+	if (mData != nullptr)
+		munmap(mData, mSize);
+
+	if (mFile != -1)
+		::close(mFile);
+
+	mData = nullptr;
+	mSize = 0;
+	mFile = -1;
+}
+
+#endif
+
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+uint8_t* MappedFile::getData()
+{
+	return mData;
+}
+
+size_t MappedFile::getSize()
+{
+	return mSize;
+}
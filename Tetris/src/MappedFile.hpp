@@ -0,0 +1,31 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+#include "Prerequisites.hpp"
+
+// Read-only file mapped copy-on-write. Pages can be modified in place,
+// changes stay private to the process and never reach the file.
+class MappedFile
+{
+public:
+	MappedFile();
+	~MappedFile();
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	bool open(std::string fileName);
+	void close();
+	uint8_t* getData();
+	size_t getSize();
+
+private:
+	uint8_t *mData;
+	size_t mSize;
+#if defined(_WIN32)
+	void *mFile;
+	void *mMapping;
+#else
+	int mFile;
+#endif
+};
+
+#endif // MAPPED_FILE_HPP
@@ -1,10 +1,30 @@
 #include "PNGCodec.hpp"
 #include "Image.hpp"
+#include "Parallel.hpp"
+#include "Trace.hpp"
 #include <png.h>
+#include <zlib.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
 
 const unsigned int SIGNATURE_LENGTH = 8;
+// Uncompressed bytes per strip in parallel mode, the same as pigz uses.
+const size_t STRIP_SIZE = 128 * 1024;
+// Deflate window, every strip is primed with this much of the data before it.
+const size_t DICTIONARY_SIZE = 32 * 1024;
+const size_t MAX_IDAT_SIZE = 256 * 1024;
 void PNGReadCallback(png_structp PNG_ptr, png_bytep outBytes,
 	png_size_t byteCountToRead);
+void PNGWriteCallback(png_structp PNGPtr, png_bytep inBytes,
+	png_size_t byteCountToWrite);
+void PNGFlushCallback(png_structp PNGPtr);
+void FilterRow(PNGFilter filter, const uint8_t *row, const uint8_t *prev,
+	unsigned int bytesPerPixel, size_t length, uint8_t *out);
+void WriteChunk(std::vector<uint8_t> *out, const char *type,
+	const uint8_t *data, size_t size);
+void WriteUInt32(uint8_t *out, uint32_t value);
 
 struct PNGVectorStream
 {
@@ -13,7 +33,8 @@ struct PNGVectorStream
 };
 
 
-PNGCodec::PNGCodec()
+PNGCodec::PNGCodec() : mCompressionLevel(Z_DEFAULT_COMPRESSION),
+	mFilter(PNGFilter::ADAPTIVE), mParallel(false)
 {
 }
 
@@ -21,6 +42,21 @@ PNGCodec::~PNGCodec()
 {
 }
 
+void PNGCodec::setCompressionLevel(int level)
+{
+	mCompressionLevel = std::min(std::max(level, -1), 9);
+}
+
+void PNGCodec::setFilter(PNGFilter filter)
+{
+	mFilter = filter;
+}
+
+void PNGCodec::setParallel(bool parallel)
+{
+	mParallel = parallel;
+}
+
 uint8_t PNGCodec::getMipmapLevels(std::vector<uint8_t> &in)
 {
 	return 0;
@@ -35,6 +71,8 @@ void PNGCodec::decode(std::vector<uint8_t> &in,
 	std::vector<uint8_t> *out, unsigned int *width, 
 	unsigned int *height, ColorFormat *format, uint8_t level)
 {
+	TRACE_SCOPE("PNGCodec::decode");
+
 	if (level != 0)
 	{
 		// TODO: Error handling.
@@ -113,6 +151,210 @@ void PNGCodec::decode(std::vector<uint8_t> &in,
 	png_destroy_read_struct(&pngPtr, &pngInfoPtr, nullptr);
 }
 
+void PNGCodec::encode(const uint8_t *in, unsigned int width,
+	unsigned int height, ColorFormat format, std::vector<uint8_t> *out)
+{
+	int colorType;
+	unsigned int bytesPerPixel;
+
+	out->clear();
+
+	switch (format)
+	{
+	case ColorFormat::R8:
+		colorType = PNG_COLOR_TYPE_GRAY;
+		bytesPerPixel = 1;
+		break;
+
+	case ColorFormat::RG8:
+		colorType = PNG_COLOR_TYPE_GRAY_ALPHA;
+		bytesPerPixel = 2;
+		break;
+
+	case ColorFormat::RGB8:
+	case ColorFormat::SRGB8:
+		colorType = PNG_COLOR_TYPE_RGB;
+		bytesPerPixel = 3;
+		break;
+
+	case ColorFormat::RGBA8:
+	case ColorFormat::SRGB8A8:
+		colorType = PNG_COLOR_TYPE_RGBA;
+		bytesPerPixel = 4;
+		break;
+
+	default:
+		// TODO: Error handling.
+		return;
+	}
+
+	if (mParallel && static_cast<size_t>(width) * bytesPerPixel * height > STRIP_SIZE)
+		return encodeParallel(in, width, height, colorType, bytesPerPixel, out);
+
+	png_structp pngPtr = png_create_write_struct(
+		PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+
+	if (pngPtr == nullptr)
+	{
+		// TODO: Error handling.
+		return;
+	}
+
+	png_infop pngInfoPtr = png_create_info_struct(pngPtr);
+
+	if (pngInfoPtr == nullptr)
+	{
+		// TODO: Error handling.
+		png_destroy_write_struct(&pngPtr, nullptr);
+		return;
+	}
+
+	if (setjmp(png_jmpbuf(pngPtr)))
+	{
+		// TODO: Error handling.
+		png_destroy_write_struct(&pngPtr, &pngInfoPtr);
+		out->clear();
+		return;
+	}
+
+	static const int FILTER_FLAGS[] = { PNG_FILTER_NONE, PNG_FILTER_SUB,
+		PNG_FILTER_UP, PNG_FILTER_AVG, PNG_FILTER_PAETH, PNG_ALL_FILTERS };
+
+	png_set_write_fn(pngPtr, out, PNGWriteCallback, PNGFlushCallback);
+	png_set_compression_level(pngPtr, mCompressionLevel);
+	png_set_filter(pngPtr, PNG_FILTER_TYPE_BASE, FILTER_FLAGS[static_cast<int>(mFilter)]);
+	png_set_IHDR(pngPtr, pngInfoPtr, width, height, 8, colorType,
+		PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+	png_write_info(pngPtr, pngInfoPtr);
+
+	for (unsigned int i = 0; i < height; ++i)
+		png_write_row(pngPtr, const_cast<png_bytep>(&in[i * width * bytesPerPixel]));
+
+	png_write_end(pngPtr, nullptr);
+	png_destroy_write_struct(&pngPtr, &pngInfoPtr);
+}
+
+void PNGCodec::encodeParallel(const uint8_t *in, unsigned int width, unsigned int height,
+	int colorType, unsigned int bytesPerPixel, std::vector<uint8_t> *out)
+{
+	// Filtering only looks at the unfiltered row above, so rows are
+	// independent. Every filtered row starts with its filter type byte.
+	size_t rowSize = static_cast<size_t>(width) * bytesPerPixel;
+	size_t filteredRowSize = rowSize + 1;
+	std::vector<uint8_t> filtered(filteredRowSize * height);
+
+	ParallelFor(height, [&](unsigned int begin, unsigned int end)
+	{
+		for (unsigned int i = begin; i < end; ++i)
+			FilterRow(mFilter, &in[i * rowSize], i == 0 ? nullptr : &in[(i - 1) * rowSize],
+				bytesPerPixel, rowSize, &filtered[i * filteredRowSize]);
+	}, 16);
+
+	// Every strip is a raw deflate stream primed with the data before it,
+	// all but the last end on a byte boundary with a sync flush so they can
+	// simply be appended to each other.
+	size_t stripCount = (filtered.size() + STRIP_SIZE - 1) / STRIP_SIZE;
+	std::vector<std::vector<uint8_t>> strips(stripCount);
+	std::vector<uLong> checksums(stripCount);
+	std::atomic<bool> failed(false);
+
+	ParallelFor(static_cast<unsigned int>(stripCount), [&](unsigned int begin, unsigned int end)
+	{
+		for (unsigned int i = begin; i < end; ++i)
+		{
+			size_t offset = i * STRIP_SIZE;
+			size_t size = std::min(STRIP_SIZE, filtered.size() - offset);
+			bool last = i == stripCount - 1;
+			z_stream stream = {};
+
+			checksums[i] = adler32(1, &filtered[offset], static_cast<uInt>(size));
+
+			if (deflateInit2(&stream, mCompressionLevel, Z_DEFLATED, -15, 8,
+				Z_DEFAULT_STRATEGY) != Z_OK)
+			{
+				// TODO: Error handling.
+				failed = true;
+				continue;
+			}
+
+			if (i > 0)
+			{
+				size_t dictionarySize = std::min(DICTIONARY_SIZE, offset);
+				deflateSetDictionary(&stream, &filtered[offset - dictionarySize],
+					static_cast<uInt>(dictionarySize));
+			}
+
+			// Room for the empty stored block a sync flush adds.
+			strips[i].resize(deflateBound(&stream, static_cast<uLong>(size)) + 16);
+			stream.next_in = &filtered[offset];
+			stream.avail_in = static_cast<uInt>(size);
+			stream.next_out = strips[i].data();
+			stream.avail_out = static_cast<uInt>(strips[i].size());
+
+			int result = deflate(&stream, last ? Z_FINISH : Z_SYNC_FLUSH);
+
+			if (result != (last ? Z_STREAM_END : Z_OK) || stream.avail_in != 0)
+				failed = true;
+
+			strips[i].resize(stream.total_out);
+			deflateEnd(&stream);
+		}
+	});
+
+	if (failed)
+	{
+		// TODO: Error handling.
+		return;
+	}
+
+	// zlib header, FLEVEL only tells decoders how hard the encoder tried.
+	uint8_t level = mCompressionLevel < 0 || mCompressionLevel == 6 ? 2 :
+		mCompressionLevel < 2 ? 0 : mCompressionLevel < 6 ? 1 : 3;
+	uint8_t cmf = 0x78;
+	uint8_t flg = level << 6;
+	flg += (31 - (cmf * 256 + flg) % 31) % 31;
+
+	uLong checksum = checksums[0];
+	size_t stripsSize = strips[0].size();
+
+	for (size_t i = 1; i < stripCount; ++i)
+	{
+		size_t size = std::min(STRIP_SIZE, filtered.size() - i * STRIP_SIZE);
+		checksum = adler32_combine(checksum, checksums[i], static_cast<z_off_t>(size));
+		stripsSize += strips[i].size();
+	}
+
+	std::vector<uint8_t> data;
+	data.reserve(2 + stripsSize + 4);
+	data.push_back(cmf);
+	data.push_back(flg);
+
+	for (auto &strip : strips)
+		data.insert(data.end(), strip.begin(), strip.end());
+
+	data.resize(data.size() + 4);
+	WriteUInt32(&data[data.size() - 4], static_cast<uint32_t>(checksum));
+
+	static const uint8_t SIGNATURE[SIGNATURE_LENGTH] = { 137, 'P', 'N', 'G', '\r', '\n', 26, '\n' };
+	uint8_t header[13];
+	WriteUInt32(&header[0], width);
+	WriteUInt32(&header[4], height);
+	header[8] = 8;
+	header[9] = static_cast<uint8_t>(colorType);
+	header[10] = 0;
+	header[11] = 0;
+	header[12] = 0;
+
+	out->reserve(SIGNATURE_LENGTH + 25 + data.size() + 12 * (data.size() / MAX_IDAT_SIZE + 2));
+	out->insert(out->end(), SIGNATURE, SIGNATURE + SIGNATURE_LENGTH);
+	WriteChunk(out, "IHDR", header, sizeof(header));
+
+	for (size_t offset = 0; offset < data.size(); offset += MAX_IDAT_SIZE)
+		WriteChunk(out, "IDAT", &data[offset], std::min(MAX_IDAT_SIZE, data.size() - offset));
+
+	WriteChunk(out, "IEND", nullptr, 0);
+}
+
 
 void PNGReadCallback(png_structp PNGPtr, png_bytep outBytes,
 	png_size_t byteCountToRead)
@@ -139,3 +381,126 @@ void PNGReadCallback(png_structp PNGPtr, png_bytep outBytes,
 	stream->offset += byteCountToRead;
 }
 
+void PNGWriteCallback(png_structp PNGPtr, png_bytep inBytes,
+	png_size_t byteCountToWrite)
+{
+	std::vector<uint8_t> *out = reinterpret_cast<std::vector<uint8_t>*>(png_get_io_ptr(PNGPtr));
+	out->insert(out->end(), inBytes, inBytes + byteCountToWrite);
+}
+
+void PNGFlushCallback(png_structp PNGPtr)
+{
+}
+
+static uint8_t PaethPredictor(int a, int b, int c)
+{
+	int p = a + b - c;
+	int pa = std::abs(p - a);
+	int pb = std::abs(p - b);
+	int pc = std::abs(p - c);
+
+	if (pa <= pb && pa <= pc)
+		return static_cast<uint8_t>(a);
+
+	return static_cast<uint8_t>(pb <= pc ? b : c);
+}
+
+static void ApplyFilter(PNGFilter filter, const uint8_t *row, const uint8_t *prev,
+	unsigned int bytesPerPixel, size_t length, uint8_t *out)
+{
+	for (size_t i = 0; i < length; ++i)
+	{
+		uint8_t a = i >= bytesPerPixel ? row[i - bytesPerPixel] : 0;
+		uint8_t b = prev != nullptr ? prev[i] : 0;
+		uint8_t c = prev != nullptr && i >= bytesPerPixel ? prev[i - bytesPerPixel] : 0;
+
+		switch (filter)
+		{
+		case PNGFilter::SUB:
+			out[i] = row[i] - a;
+			break;
+
+		case PNGFilter::UP:
+			out[i] = row[i] - b;
+			break;
+
+		case PNGFilter::AVERAGE:
+			out[i] = row[i] - static_cast<uint8_t>((a + b) / 2);
+			break;
+
+		case PNGFilter::PAETH:
+			out[i] = row[i] - PaethPredictor(a, b, c);
+			break;
+
+		default:
+			out[i] = row[i];
+			break;
+		}
+	}
+}
+
+void FilterRow(PNGFilter filter, const uint8_t *row, const uint8_t *prev,
+	unsigned int bytesPerPixel, size_t length, uint8_t *out)
+{
+	if (filter != PNGFilter::ADAPTIVE)
+	{
+		out[0] = static_cast<uint8_t>(filter);
+		ApplyFilter(filter, row, prev, bytesPerPixel, length, out + 1);
+		return;
+	}
+
+	// Same heuristic as libpng, the smallest sum of the bytes taken as
+	// signed values usually compresses best.
+	std::vector<uint8_t> candidate(length);
+	uint64_t bestSum = UINT64_MAX;
+
+	for (int type = 0; type < 5; ++type)
+	{
+		PNGFilter current = static_cast<PNGFilter>(type);
+		uint64_t sum = 0;
+
+		ApplyFilter(current, row, prev, bytesPerPixel, length, candidate.data());
+
+		for (size_t i = 0; i < length; ++i)
+			sum += std::abs(static_cast<int8_t>(candidate[i]));
+
+		if (sum < bestSum)
+		{
+			bestSum = sum;
+			out[0] = static_cast<uint8_t>(type);
+			memcpy(out + 1, candidate.data(), length);
+		}
+	}
+}
+
+void WriteChunk(std::vector<uint8_t> *out, const char *type,
+	const uint8_t *data, size_t size)
+{
+	uint8_t header[8];
+	uint8_t footer[4];
+
+	WriteUInt32(&header[0], static_cast<uint32_t>(size));
+	memcpy(&header[4], type, 4);
+
+	uLong crc = crc32(0, &header[4], 4);
+
+	if (size > 0)
+		crc = crc32(crc, data, static_cast<uInt>(size));
+
+	WriteUInt32(footer, static_cast<uint32_t>(crc));
+
+	out->insert(out->end(), header, header + 8);
+
+	if (size > 0)
+		out->insert(out->end(), data, data + size);
+
+	out->insert(out->end(), footer, footer + 4);
+}
+
+void WriteUInt32(uint8_t *out, uint32_t value)
+{
+	out[0] = static_cast<uint8_t>(value >> 24);
+	out[1] = static_cast<uint8_t>(value >> 16);
+	out[2] = static_cast<uint8_t>(value >> 8);
+	out[3] = static_cast<uint8_t>(value);
+}
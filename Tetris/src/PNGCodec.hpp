@@ -3,19 +3,47 @@
 #include "Prerequisites.hpp"
 #include "ImageCodec.hpp"
 
+// Row filter applied before compression, ADAPTIVE picks the best one
+// per row like libpng does.
+enum class PNGFilter
+{
+	NONE,
+	SUB,
+	UP,
+	AVERAGE,
+	PAETH,
+	ADAPTIVE
+};
+
 class PNGCodec : public ImageCodec
 {
 public:
 	PNGCodec();
 	~PNGCodec();
-	
+
+	// zlib level from 0 to 9, -1 is the zlib default.
+	void setCompressionLevel(int level);
+	void setFilter(PNGFilter filter);
+	// Compresses strips of rows on separate threads and joins the deflate
+	// streams, at the cost of a slightly bigger file.
+	void setParallel(bool parallel);
+
 	uint8_t getMipmapLevels(std::vector<uint8_t> &in);
 	bool shouldBeFlippedVerticaly();
 
 	void decode(std::vector<uint8_t> &in,
 		std::vector<uint8_t> *out, unsigned int *width,
 		unsigned int *height, ColorFormat *format, uint8_t level);
-	// void encode();
+	void encode(const uint8_t *in, unsigned int width,
+		unsigned int height, ColorFormat format, std::vector<uint8_t> *out);
+
+private:
+	int mCompressionLevel;
+	PNGFilter mFilter;
+	bool mParallel;
+
+	void encodeParallel(const uint8_t *in, unsigned int width, unsigned int height,
+		int colorType, unsigned int bytesPerPixel, std::vector<uint8_t> *out);
 };
 
 #endif // PNG_CODEC_HPP
@@ -0,0 +1,37 @@
+#include "Parallel.hpp"
+#include <algorithm>
+#include <thread>
+
+void ParallelFor(unsigned int count,
+	const std::function<void(unsigned int begin, unsigned int end)> &func,
+	unsigned int minRange)
+{
+	if (count == 0)
+		return;
+
+	unsigned int threadCount = std::max(1u, std::thread::hardware_concurrency());
+	threadCount = std::min(threadCount, std::max(1u, count / std::max(1u, minRange)));
+
+	if (threadCount == 1)
+		return func(0, count);
+
+	std::vector<std::thread> threads;
+	threads.reserve(threadCount - 1);
+
+	unsigned int range = count / threadCount;
+	unsigned int remainder = count % threadCount;
+	unsigned int begin = range + (remainder > 0 ? 1 : 0);
+	unsigned int firstEnd = begin;
+
+	for (unsigned int i = 1; i < threadCount; ++i)
+	{
+		unsigned int end = begin + range + (i < remainder ? 1 : 0);
+		threads.emplace_back(func, begin, end);
+		begin = end;
+	}
+
+	func(0, firstEnd);
+
+	for (auto &thread : threads)
+		thread.join();
+}
@@ -0,0 +1,13 @@
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+#include "Prerequisites.hpp"
+#include <functional>
+
+// Splits [0, count) into contiguous ranges and runs them on hardware threads.
+// The calling thread takes the first range. Ranges are never shorter than
+// minRange, so small jobs stay on the calling thread.
+void ParallelFor(unsigned int count,
+	const std::function<void(unsigned int begin, unsigned int end)> &func,
+	unsigned int minRange = 1);
+
+#endif // PARALLEL_HPP
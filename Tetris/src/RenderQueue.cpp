@@ -0,0 +1,113 @@
+#include "RenderQueue.hpp"
+#include <algorithm>
+
+// Commands a frame can record before the queue has to grow.
+const size_t COMMAND_CAPACITY = 64;
+
+RenderQueue::RenderQueue() : mStateValid(false), mBlend(BlendMode::NONE),
+	mProgram(0), mVao(0), mTexture(0), mSampler(0)
+{
+	mCommands.reserve(COMMAND_CAPACITY);
+	mSortEntries.reserve(COMMAND_CAPACITY);
+}
+
+RenderQueue::~RenderQueue()
+{
+}
+
+void RenderQueue::submit(const DrawCommand &command)
+{
+	if (command.count == 0)
+		return;
+
+	mCommands.push_back(command);
+}
+
+void RenderQueue::flush()
+{
+	mSortEntries.clear();
+
+	for (size_t i = 0; i < mCommands.size(); ++i)
+		mSortEntries.push_back(SortEntry{ MakeKey(mCommands.at(i)), i });
+
+	// Equal states keep the order they were recorded in. The index breaks
+	// ties instead of a stable sort, which would allocate a buffer.
+	std::sort(mSortEntries.begin(), mSortEntries.end(),
+		[](const SortEntry &a, const SortEntry &b)
+		{
+			return a.key < b.key || (a.key == b.key && a.index < b.index);
+		});
+
+	for (const SortEntry &entry : mSortEntries)
+	{
+		const DrawCommand &command = mCommands.at(entry.index);
+
+		if (mStateValid == false || command.blend != mBlend)
+		{
+			if (command.blend == BlendMode::NONE)
+				gl::Disable(gl::BLEND);
+			else
+			{
+				gl::Enable(gl::BLEND);
+				gl::BlendFunc(gl::SRC_ALPHA, gl::ONE_MINUS_SRC_ALPHA);
+			}
+
+			mBlend = command.blend;
+		}
+
+		if (mStateValid == false || command.program != mProgram)
+		{
+			gl::UseProgram(command.program);
+			mProgram = command.program;
+		}
+
+		if (mStateValid == false || command.vao != mVao)
+		{
+			gl::BindVertexArray(command.vao);
+			mVao = command.vao;
+		}
+
+		if (mStateValid == false || command.texture != mTexture)
+		{
+			gl::ActiveTexture(gl::TEXTURE0);
+			gl::BindTexture(gl::TEXTURE_2D, command.texture);
+			mTexture = command.texture;
+		}
+
+		if (mStateValid == false || command.sampler != mSampler)
+		{
+			gl::BindSampler(0, command.sampler);
+			mSampler = command.sampler;
+		}
+
+		mStateValid = true;
+
+		if (command.indexType == 0)
+			gl::DrawArrays(command.primitive, command.first, command.count);
+		else
+		{
+			size_t indexSize = command.indexType == gl::UNSIGNED_SHORT ? 2 :
+				(command.indexType == gl::UNSIGNED_BYTE ? 1 : 4);
+			gl::DrawElements(command.primitive, command.count, command.indexType,
+				(GLvoid*)(command.first * indexSize));
+		}
+	}
+
+	mCommands.clear();
+}
+
+void RenderQueue::invalidate()
+{
+	mStateValid = false;
+}
+
+uint64_t RenderQueue::MakeKey(const DrawCommand &command)
+{
+	// layer:8 | blend:4 | program:12 | texture:20 | vao:20. Names wider
+	// than their field only make the grouping coarser.
+	return static_cast<uint64_t>(command.layer) << 56 |
+		static_cast<uint64_t>(command.blend) << 52 |
+		static_cast<uint64_t>(command.program & 0xFFF) << 40 |
+		static_cast<uint64_t>(command.texture & 0xFFFFF) << 20 |
+		static_cast<uint64_t>(command.vao & 0xFFFFF);
+}
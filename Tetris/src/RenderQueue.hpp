@@ -0,0 +1,71 @@
+#ifndef RENDER_QUEUE_HPP
+#define RENDER_QUEUE_HPP
+#include "Prerequisites.hpp"
+
+enum class BlendMode : uint8_t
+{
+	NONE,
+	ALPHA,
+};
+
+// Layers are drawn in order, inside a layer commands get grouped by
+// state, so only draws that don't overlap may share a layer.
+enum class RenderLayer : uint8_t
+{
+	BOARD,
+	GRID,
+	OVERLAY,
+	UI,
+};
+
+struct DrawCommand
+{
+	RenderLayer layer;
+	BlendMode blend;
+	GLuint program;
+	GLuint vao;
+	GLuint texture;
+	GLuint sampler;
+	GLenum primitive;
+	GLint first;
+	GLsizei count;
+	// Zero for DrawArrays, otherwise the index type of the VAO's element
+	// buffer and first counts indices.
+	GLenum indexType;
+};
+
+// Records the draws of a frame, sorts them by state and submits them in
+// one pass, skipping binds of state that is already current.
+class RenderQueue
+{
+public:
+	RenderQueue();
+	~RenderQueue();
+	RenderQueue(const RenderQueue&) = delete;
+	RenderQueue& operator=(const RenderQueue&) = delete;
+
+	void submit(const DrawCommand &command);
+	void flush();
+	// Forget the cached state after GL calls made outside the queue.
+	void invalidate();
+
+private:
+	struct SortEntry
+	{
+		uint64_t key;
+		size_t index;
+	};
+
+	std::vector<DrawCommand> mCommands;
+	std::vector<SortEntry> mSortEntries;
+	bool mStateValid;
+	BlendMode mBlend;
+	GLuint mProgram;
+	GLuint mVao;
+	GLuint mTexture;
+	GLuint mSampler;
+
+	static uint64_t MakeKey(const DrawCommand &command);
+};
+
+#endif // RENDER_QUEUE_HPP
@@ -0,0 +1,63 @@
+#include "RenderTarget.hpp"
+#include "Image.hpp"
+
+RenderTarget::RenderTarget(unsigned int width, unsigned int height) : mWidth(width), mHeight(height)
+{
+	gl::GenRenderbuffers(1, &mColorBuffer);
+	gl::BindRenderbuffer(gl::RENDERBUFFER, mColorBuffer);
+	gl::RenderbufferStorage(gl::RENDERBUFFER, gl::RGBA8, width, height);
+
+	gl::GenFramebuffers(1, &mFramebuffer);
+	gl::BindFramebuffer(gl::FRAMEBUFFER, mFramebuffer);
+	gl::FramebufferRenderbuffer(gl::FRAMEBUFFER, gl::COLOR_ATTACHMENT0,
+		gl::RENDERBUFFER, mColorBuffer);
+	gl::BindFramebuffer(gl::FRAMEBUFFER, 0);
+}
+
+RenderTarget::~RenderTarget()
+{
+	gl::DeleteFramebuffers(1, &mFramebuffer);
+	gl::DeleteRenderbuffers(1, &mColorBuffer);
+}
+
+bool RenderTarget::isComplete()
+{
+	gl::BindFramebuffer(gl::FRAMEBUFFER, mFramebuffer);
+	bool complete = gl::CheckFramebufferStatus(gl::FRAMEBUFFER) == gl::FRAMEBUFFER_COMPLETE;
+	gl::BindFramebuffer(gl::FRAMEBUFFER, 0);
+
+	return complete;
+}
+
+void RenderTarget::bind()
+{
+	gl::BindFramebuffer(gl::FRAMEBUFFER, mFramebuffer);
+	gl::Viewport(0, 0, mWidth, mHeight);
+}
+
+void RenderTarget::readPixels(Image &img)
+{
+	std::vector<uint8_t> bytes(static_cast<size_t>(mWidth) * mHeight * 4);
+
+	gl::BindFramebuffer(gl::READ_FRAMEBUFFER, mFramebuffer);
+	gl::ReadBuffer(gl::COLOR_ATTACHMENT0);
+	gl::PixelStorei(gl::PACK_ALIGNMENT, 1);
+	gl::ReadPixels(0, 0, mWidth, mHeight, gl::RGBA, gl::UNSIGNED_BYTE, bytes.data());
+
+	img.create(mWidth, mHeight, ColorFormat::RGBA8, bytes);
+}
+
+unsigned int RenderTarget::getWidth()
+{
+	return mWidth;
+}
+
+unsigned int RenderTarget::getHeight()
+{
+	return mHeight;
+}
+
+void RenderTarget::Unbind()
+{
+	gl::BindFramebuffer(gl::FRAMEBUFFER, 0);
+}
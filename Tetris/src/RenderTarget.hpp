@@ -0,0 +1,32 @@
+#ifndef RENDER_TARGET_HPP
+#define RENDER_TARGET_HPP
+#include "Prerequisites.hpp"
+
+class Image;
+
+// Offscreen RGBA8 framebuffer, used when there is no visible window.
+class RenderTarget
+{
+public:
+	RenderTarget(unsigned int width, unsigned int height);
+	~RenderTarget();
+	RenderTarget(const RenderTarget&) = delete;
+	RenderTarget& operator=(const RenderTarget&) = delete;
+
+	bool isComplete();
+	void bind();
+	// Rows are stored bottom to top.
+	void readPixels(Image &img);
+	unsigned int getWidth();
+	unsigned int getHeight();
+
+	static void Unbind();
+
+private:
+	GLuint mFramebuffer;
+	GLuint mColorBuffer;
+	unsigned int mWidth;
+	unsigned int mHeight;
+};
+
+#endif // RENDER_TARGET_HPP
@@ -0,0 +1,256 @@
+#include "ShaderProgram.hpp"
+#include <cstdio>
+
+static const uint32_t BINARY_MAGIC = 0x42505354; // "TSPB"
+
+std::unordered_map<uint64_t, std::weak_ptr<ShaderProgram>> ShaderProgram::msPrograms;
+std::string ShaderProgram::msBinaryCacheDirectory = ".";
+std::unordered_map<std::string, GLuint> ShaderProgram::msUniformBlockBindings;
+
+static uint64_t HashBytes(uint64_t hash, const char *str)
+{
+	// FNV-1a, the terminating zero is hashed as a separator.
+	do
+	{
+		hash ^= static_cast<uint8_t>(*str);
+		hash *= 0x100000001B3ull;
+	} while (*str++ != '\0');
+
+	return hash;
+}
+
+static GLuint CompileShader(GLenum type, const char *source)
+{
+	GLuint shader = gl::CreateShader(type);
+	GLint result;
+	GLint logLength;
+
+	gl::ShaderSource(shader, 1, (const GLchar**)&source, nullptr);
+	gl::CompileShader(shader);
+	gl::GetShaderiv(shader, gl::COMPILE_STATUS, &result);
+
+	if (result == gl::FALSE_)
+	{
+		gl::GetShaderiv(shader, gl::INFO_LOG_LENGTH, &logLength);
+		std::vector<char> log(logLength + 1, '\0');
+		gl::GetShaderInfoLog(shader, logLength, nullptr, log.data());
+		std::cout << log.data() << std::endl;
+	}
+
+	return shader;
+}
+
+ShaderProgram::ShaderProgram() : mId(0)
+{
+}
+
+ShaderProgram::~ShaderProgram()
+{
+	if (mId != 0)
+		gl::DeleteProgram(mId);
+}
+
+bool ShaderProgram::loadFromSource(const char *vs, const char *fs)
+{
+	std::string binaryPath;
+	bool binarySupported = gl::exts::var_ARB_get_program_binary &&
+		msBinaryCacheDirectory.empty() == false;
+
+	mUniformLocations.clear();
+
+	if (mId != 0)
+		gl::DeleteProgram(mId);
+
+	if (binarySupported)
+	{
+		binaryPath = GetBinaryPath(HashSource(vs, fs));
+
+		if (loadBinary(binaryPath))
+		{
+			bindUniformBlocks();
+			return true;
+		}
+	}
+
+	GLuint vertexShader = CompileShader(gl::VERTEX_SHADER, vs);
+	GLuint fragmentShader = CompileShader(gl::FRAGMENT_SHADER, fs);
+	GLint result;
+	GLint logLength;
+
+	mId = gl::CreateProgram();
+	gl::AttachShader(mId, vertexShader);
+	gl::AttachShader(mId, fragmentShader);
+
+	if (binarySupported)
+		gl::ProgramParameteri(mId, gl::PROGRAM_BINARY_RETRIEVABLE_HINT, gl::TRUE_);
+
+	gl::LinkProgram(mId);
+	gl::DetachShader(mId, vertexShader);
+	gl::DetachShader(mId, fragmentShader);
+	gl::DeleteShader(vertexShader);
+	gl::DeleteShader(fragmentShader);
+	gl::GetProgramiv(mId, gl::LINK_STATUS, &result);
+
+	if (result == gl::FALSE_)
+	{
+		gl::GetProgramiv(mId, gl::INFO_LOG_LENGTH, &logLength);
+		std::vector<char> log(logLength + 1, '\0');
+		gl::GetProgramInfoLog(mId, logLength, nullptr, log.data());
+		std::cout << log.data() << std::endl;
+		return false;
+	}
+
+	if (binarySupported)
+		saveBinary(binaryPath);
+
+	bindUniformBlocks();
+	return true;
+}
+
+void ShaderProgram::use()
+{
+	gl::UseProgram(mId);
+}
+
+GLuint ShaderProgram::getId()
+{
+	return mId;
+}
+
+GLint ShaderProgram::getUniformLocation(const std::string &name)
+{
+	auto it = mUniformLocations.find(name);
+
+	if (it != mUniformLocations.end())
+		return it->second;
+
+	GLint location = gl::GetUniformLocation(mId, name.c_str());
+	mUniformLocations.emplace(name, location);
+	return location;
+}
+
+std::shared_ptr<ShaderProgram> ShaderProgram::Get(const char *vs, const char *fs)
+{
+	uint64_t hash = HashSource(vs, fs);
+	std::shared_ptr<ShaderProgram> program = msPrograms[hash].lock();
+
+	if (program == nullptr)
+	{
+		program = std::make_shared<ShaderProgram>();
+		program->loadFromSource(vs, fs);
+		msPrograms[hash] = program;
+	}
+
+	return program;
+}
+
+void ShaderProgram::SetBinaryCacheDirectory(std::string directory)
+{
+	msBinaryCacheDirectory = directory;
+}
+
+void ShaderProgram::SetUniformBlockBinding(std::string name, GLuint binding)
+{
+	msUniformBlockBindings[name] = binding;
+}
+
+uint64_t ShaderProgram::HashSource(const char *vs, const char *fs)
+{
+	uint64_t hash = 0xCBF29CE484222325ull;
+
+	hash = HashBytes(hash, vs);
+	hash = HashBytes(hash, fs);
+
+	return hash;
+}
+
+std::string ShaderProgram::GetBinaryPath(uint64_t hash)
+{
+	// Binaries are only valid for the driver that produced them.
+	const char *driverStrings[] = {
+		(const char*)gl::GetString(gl::VENDOR),
+		(const char*)gl::GetString(gl::RENDERER),
+		(const char*)gl::GetString(gl::VERSION)
+	};
+
+	for (const char *str : driverStrings)
+		hash = HashBytes(hash, str != nullptr ? str : "");
+
+	char name[32];
+	snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(hash));
+
+	return msBinaryCacheDirectory + "/" + name;
+}
+
+bool ShaderProgram::loadBinary(const std::string &path)
+{
+	std::ifstream in(path, std::ios::binary);
+	uint32_t header[3];
+
+	if (in.is_open() == false)
+		return false;
+
+	in.read(reinterpret_cast<char*>(header), sizeof(header));
+
+	if (in.good() == false || header[0] != BINARY_MAGIC)
+		return false;
+
+	std::vector<char> binary(header[2]);
+	in.read(binary.data(), binary.size());
+
+	if (in.good() == false)
+		return false;
+
+	GLint result;
+
+	mId = gl::CreateProgram();
+	gl::ProgramBinary(mId, header[1], binary.data(), binary.size());
+	gl::GetProgramiv(mId, gl::LINK_STATUS, &result);
+
+	// Rejected binaries (e.g. after a driver update) fall back to compiling.
+	if (result == gl::FALSE_)
+	{
+		gl::DeleteProgram(mId);
+		mId = 0;
+		return false;
+	}
+
+	return true;
+}
+
+void ShaderProgram::saveBinary(const std::string &path)
+{
+	GLint length = 0;
+	GLenum format;
+
+	gl::GetProgramiv(mId, gl::PROGRAM_BINARY_LENGTH, &length);
+
+	if (length <= 0)
+		return;
+
+	std::vector<char> binary(length);
+	gl::GetProgramBinary(mId, length, &length, &format, binary.data());
+
+	std::ofstream out(path, std::ios::binary);
+
+	if (out.is_open() == false)
+	{
+		// TODO: Error handling.
+		return;
+	}
+
+	uint32_t header[3] = { BINARY_MAGIC, format, static_cast<uint32_t>(length) };
+	out.write(reinterpret_cast<const char*>(header), sizeof(header));
+	out.write(binary.data(), length);
+}
+
+void ShaderProgram::bindUniformBlocks()
+{
+	for (auto &block : msUniformBlockBindings)
+	{
+		GLuint index = gl::GetUniformBlockIndex(mId, block.first.c_str());
+
+		if (index != gl::INVALID_INDEX)
+			gl::UniformBlockBinding(mId, index, block.second);
+	}
+}
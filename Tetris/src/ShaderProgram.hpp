@@ -0,0 +1,44 @@
+#ifndef SHADER_PROGRAM_HPP
+#define SHADER_PROGRAM_HPP
+#include "Prerequisites.hpp"
+#include <unordered_map>
+
+class ShaderProgram
+{
+public:
+	ShaderProgram();
+	~ShaderProgram();
+	ShaderProgram(const ShaderProgram&) = delete;
+	ShaderProgram& operator=(const ShaderProgram&) = delete;
+
+	bool loadFromSource(const char *vs, const char *fs);
+	void use();
+	GLuint getId();
+	GLint getUniformLocation(const std::string &name);
+
+	// Returns the program built from the given sources, compiling it only
+	// the first time. Programs live while somebody holds them.
+	static std::shared_ptr<ShaderProgram> Get(const char *vs, const char *fs);
+	// Linked binaries are stored here when GL_ARB_get_program_binary is
+	// available. An empty string disables the cache.
+	static void SetBinaryCacheDirectory(std::string directory);
+	// Uniform blocks with this name get attached to the binding point in
+	// every program linked afterwards.
+	static void SetUniformBlockBinding(std::string name, GLuint binding);
+
+private:
+	GLuint mId;
+	std::unordered_map<std::string, GLint> mUniformLocations;
+
+	static std::unordered_map<uint64_t, std::weak_ptr<ShaderProgram>> msPrograms;
+	static std::string msBinaryCacheDirectory;
+	static std::unordered_map<std::string, GLuint> msUniformBlockBindings;
+
+	static uint64_t HashSource(const char *vs, const char *fs);
+	static std::string GetBinaryPath(uint64_t hash);
+	bool loadBinary(const std::string &path);
+	void saveBinary(const std::string &path);
+	void bindUniformBlocks();
+};
+
+#endif // SHADER_PROGRAM_HPP
@@ -1,15 +1,46 @@
 #ifndef SHADERS_HPP
 #define SHADERS_HPP
+#include <glm/mat4x4.hpp>
+#include <cstdint>
+
+// Per-frame constants shared by every program, the struct mirrors the
+// std140 layout of the block.
+const char FRAME_CONSTANTS_BLOCK_NAME[] = "FrameConstants";
+const unsigned int FRAME_CONSTANTS_BINDING = 0;
+
+// Rows of the board being cleared are bits of clearedRows, counted from
+// the top visible row. boardRect is x, y, width, height.
+struct FrameConstants
+{
+	glm::mat4 projection;
+	float time;
+	float clearStartTime;
+	uint32_t clearedRows;
+	float boardRows;
+	float boardRect[4];
+};
+
+#define FRAME_CONSTANTS_BLOCK \
+"layout(std140) uniform FrameConstants {\n" \
+"	mat4 projection;\n" \
+"	float time;\n" \
+"	float clearStartTime;\n" \
+"	uint clearedRows;\n" \
+"	float boardRows;\n" \
+"	vec4 boardRect;\n" \
+"};\n"
 
 const char VERTEX_SHADER[] = ""
 "#version 330 core \n"
+FRAME_CONSTANTS_BLOCK
 "layout(location = 0) in vec2 pos;\n"
 "layout(location = 1) in vec4 color;\n"
 "out vec4 vertexColor;\n"
-"uniform mat4 orthoMatrix;\n"
+"out vec2 worldPos;\n"
 "void main(){\n"
-"	gl_Position = orthoMatrix * vec4(pos, 1.0f, 1.0f);\n"
+"	gl_Position = projection * vec4(pos, 1.0f, 1.0f);\n"
 "	vertexColor = color;\n"
+"	worldPos = pos;\n"
 "}\n";
 
 
@@ -22,14 +53,35 @@ const char FRAGMENT_SHADER[] = ""
 "}\n";
 
 
+// Blocks in cleared rows fade into the background color.
+const char FRAGMENT_BLOCK_SHADER[] = ""
+"#version 330 core \n"
+FRAME_CONSTANTS_BLOCK
+"in vec4 vertexColor;\n"
+"in vec2 worldPos;\n"
+"layout(location = 0) out vec4 fragmentColor;\n"
+"const vec4 clearColor = vec4(0.8f, 0.8f, 0.8f, 1.0f);\n"
+"const float fadeTime = 0.3f;\n"
+"void main(){\n"
+"	float rowHeight = boardRect.w / boardRows;\n"
+"	int row = int(floor((boardRect.y + boardRect.w - worldPos.y) / rowHeight));\n"
+"	fragmentColor = vertexColor;\n"
+"	if (row >= 0 && row < 32 && (clearedRows & (1u << uint(row))) != 0u)\n"
+"	{\n"
+"		float fade = clamp((time - clearStartTime) / fadeTime, 0.0f, 1.0f);\n"
+"		fragmentColor = mix(vertexColor, clearColor, fade);\n"
+"	}\n"
+"}\n";
+
+
 const char VERTEX_TEXTURE_SHADER[] = ""
 "#version 330 core \n"
+FRAME_CONSTANTS_BLOCK
 "layout(location = 0) in vec2 pos;\n"
 "layout(location = 1) in vec2 texCoord;\n"
 "out vec2 outCoord;\n"
-"uniform mat4 orthoMatrix;\n"
 "void main() {\n"
-"	gl_Position = orthoMatrix * vec4(pos, 1.0f, 1.0f);\n"
+"	gl_Position = projection * vec4(pos, 1.0f, 1.0f);\n"
 "	outCoord = texCoord;\n"
 "}\n";
 
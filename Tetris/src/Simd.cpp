@@ -0,0 +1,81 @@
+#include "Simd.hpp"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#ifdef SIMD_SSE2
+
+static void CpuId(int leaf, int regs[4])
+{
+#if defined(_MSC_VER)
+	__cpuidex(regs, leaf, 0);
+#else
+	__asm__ __volatile__("cpuid"
+		: "=a"(regs[0]), "=b"(regs[1]), "=c"(regs[2]), "=d"(regs[3])
+		: "a"(leaf), "c"(0));
+#endif
+}
+
+static uint64_t XGetBV()
+{
+#if defined(_MSC_VER)
+	return _xgetbv(0);
+#else
+	uint32_t eax, edx;
+	__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+
+bool CpuHasSSSE3()
+{
+	static const bool hasSSSE3 = []()
+	{
+		int regs[4];
+		CpuId(1, regs);
+		return (regs[2] & (1 << 9)) != 0;
+	}();
+
+	return hasSSSE3;
+}
+
+bool CpuHasAVX2()
+{
+	static const bool hasAVX2 = []()
+	{
+		int regs[4];
+		CpuId(0, regs);
+
+		if (regs[0] < 7)
+			return false;
+
+		// AVX state has to be enabled by the OS (OSXSAVE + XCR0 bits 1 and 2).
+		CpuId(1, regs);
+
+		if ((regs[2] & (1 << 27)) == 0 || (regs[2] & (1 << 28)) == 0)
+			return false;
+
+		if ((XGetBV() & 0x6) != 0x6)
+			return false;
+
+		CpuId(7, regs);
+		return (regs[1] & (1 << 5)) != 0;
+	}();
+
+	return hasAVX2;
+}
+
+#else
+
+bool CpuHasSSSE3()
+{
+	return false;
+}
+
+bool CpuHasAVX2()
+{
+	return false;
+}
+
+#endif
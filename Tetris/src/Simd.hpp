@@ -0,0 +1,27 @@
+#ifndef SIMD_HPP
+#define SIMD_HPP
+#include "Prerequisites.hpp"
+
+// SSE2 is the baseline on every x64 target and on Win32 builds with /arch:SSE2.
+// SSSE3 and AVX2 kernels are compiled in unconditionally and picked at runtime.
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__) || \
+	(defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SIMD_SSE2
+#endif
+
+#ifdef SIMD_SSE2
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#define SIMD_TARGET(isa)
+#else
+#define SIMD_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+bool CpuHasSSSE3();
+bool CpuHasAVX2();
+
+#endif // SIMD_HPP
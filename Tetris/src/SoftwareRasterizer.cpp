@@ -0,0 +1,152 @@
+#include "SoftwareRasterizer.hpp"
+#include "Image.hpp"
+#include <algorithm>
+#include <cmath>
+
+static float EdgeFunction(float ax, float ay, float bx, float by, float px, float py)
+{
+	return (bx - ax) * (py - ay) - (by - ay) * (px - ax);
+}
+
+// Top-left fill convention, so pixels on shared edges are drawn once.
+static bool IsTopLeft(float ax, float ay, float bx, float by)
+{
+	return (ay == by && bx < ax) || by < ay;
+}
+
+SoftwareRasterizer::SoftwareRasterizer(unsigned int width, unsigned int height)
+	: mWidth(width), mHeight(height), mColor(static_cast<size_t>(width) * height * 4, 0.0f)
+{
+}
+
+SoftwareRasterizer::~SoftwareRasterizer()
+{
+}
+
+void SoftwareRasterizer::clear(float r, float g, float b, float a)
+{
+	for (size_t i = 0; i < mColor.size(); i += 4)
+	{
+		mColor[i + 0] = r;
+		mColor[i + 1] = g;
+		mColor[i + 2] = b;
+		mColor[i + 3] = a;
+	}
+}
+
+void SoftwareRasterizer::drawTriangles(const Vertex *vertices, size_t count)
+{
+	for (size_t i = 0; i + 2 < count; i += 3)
+		drawTriangle(vertices[i], vertices[i + 1], vertices[i + 2]);
+}
+
+void SoftwareRasterizer::drawLines(const Vertex *vertices, const GLushort *indices, size_t count)
+{
+	for (size_t i = 0; i + 1 < count; i += 2)
+		drawLine(vertices[indices[i]], vertices[indices[i + 1]]);
+}
+
+void SoftwareRasterizer::copyToImage(Image &img)
+{
+	std::vector<uint8_t> bytes(mColor.size());
+
+	for (size_t i = 0; i < mColor.size(); ++i)
+		bytes[i] = static_cast<uint8_t>(std::min(std::max(mColor[i], 0.0f), 1.0f) * 255.0f + 0.5f);
+
+	img.create(mWidth, mHeight, ColorFormat::RGBA8, bytes);
+}
+
+void SoftwareRasterizer::drawTriangle(const Vertex &v0, const Vertex &v1, const Vertex &v2)
+{
+	const Vertex *a = &v0;
+	const Vertex *b = &v1;
+	const Vertex *c = &v2;
+	float area = EdgeFunction(a->x, a->y, b->x, b->y, c->x, c->y);
+
+	if (area == 0.0f)
+		return;
+
+	// No culling, wind everything counter-clockwise.
+	if (area < 0.0f)
+	{
+		std::swap(b, c);
+		area = -area;
+	}
+
+	int minX = std::max(0, static_cast<int>(std::floor(std::min({ a->x, b->x, c->x }))));
+	int maxX = std::min(static_cast<int>(mWidth) - 1, static_cast<int>(std::ceil(std::max({ a->x, b->x, c->x }))));
+	int minY = std::max(0, static_cast<int>(std::floor(std::min({ a->y, b->y, c->y }))));
+	int maxY = std::min(static_cast<int>(mHeight) - 1, static_cast<int>(std::ceil(std::max({ a->y, b->y, c->y }))));
+
+	bool topLeft0 = IsTopLeft(b->x, b->y, c->x, c->y);
+	bool topLeft1 = IsTopLeft(c->x, c->y, a->x, a->y);
+	bool topLeft2 = IsTopLeft(a->x, a->y, b->x, b->y);
+
+	for (int y = minY; y <= maxY; ++y)
+	{
+		float py = y + 0.5f;
+
+		for (int x = minX; x <= maxX; ++x)
+		{
+			float px = x + 0.5f;
+			float w0 = EdgeFunction(b->x, b->y, c->x, c->y, px, py);
+			float w1 = EdgeFunction(c->x, c->y, a->x, a->y, px, py);
+			float w2 = EdgeFunction(a->x, a->y, b->x, b->y, px, py);
+
+			if (w0 < 0.0f || w1 < 0.0f || w2 < 0.0f ||
+				(w0 == 0.0f && topLeft0 == false) ||
+				(w1 == 0.0f && topLeft1 == false) ||
+				(w2 == 0.0f && topLeft2 == false))
+				continue;
+
+			w0 /= area;
+			w1 /= area;
+			w2 /= area;
+
+			blend(x, y,
+				w0 * a->r + w1 * b->r + w2 * c->r,
+				w0 * a->g + w1 * b->g + w2 * c->g,
+				w0 * a->b + w1 * b->b + w2 * c->b,
+				w0 * a->a + w1 * b->a + w2 * c->a);
+		}
+	}
+}
+
+void SoftwareRasterizer::drawLine(const Vertex &v0, const Vertex &v1)
+{
+	// One pixel wide DDA along the major axis through pixel centers, the
+	// last pixel is left out like in the diamond-exit rule.
+	float dx = v1.x - v0.x;
+	float dy = v1.y - v0.y;
+	float length = std::max(std::fabs(dx), std::fabs(dy));
+	int steps = static_cast<int>(std::floor(length + 0.5f));
+
+	if (steps == 0)
+		return;
+
+	for (int i = 0; i < steps; ++i)
+	{
+		float t = (i + 0.5f) / length;
+		int x = static_cast<int>(std::floor(v0.x + dx * t));
+		int y = static_cast<int>(std::floor(v0.y + dy * t));
+
+		if (x < 0 || y < 0 || x >= static_cast<int>(mWidth) || y >= static_cast<int>(mHeight))
+			continue;
+
+		blend(x, y,
+			v0.r + (v1.r - v0.r) * t,
+			v0.g + (v1.g - v0.g) * t,
+			v0.b + (v1.b - v0.b) * t,
+			v0.a + (v1.a - v0.a) * t);
+	}
+}
+
+void SoftwareRasterizer::blend(unsigned int x, unsigned int y, float r, float g, float b, float a)
+{
+	float *dst = &mColor[(static_cast<size_t>(y) * mWidth + x) * 4];
+
+	dst[0] = r * a + dst[0] * (1.0f - a);
+	dst[1] = g * a + dst[1] * (1.0f - a);
+	dst[2] = b * a + dst[2] * (1.0f - a);
+	dst[3] = a * a + dst[3] * (1.0f - a);
+}
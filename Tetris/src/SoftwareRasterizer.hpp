@@ -0,0 +1,34 @@
+#ifndef SOFTWARE_RASTERIZER_HPP
+#define SOFTWARE_RASTERIZER_HPP
+#include "Prerequisites.hpp"
+#include "Vertex.hpp"
+
+class Image;
+
+// CPU fallback for the colored triangles and lines the game draws. Vertex
+// positions are in pixels with the origin in the bottom left corner,
+// which is what the orthographic projection maps them to on the GPU.
+// Colors are blended with SRC_ALPHA, ONE_MINUS_SRC_ALPHA.
+class SoftwareRasterizer
+{
+public:
+	SoftwareRasterizer(unsigned int width, unsigned int height);
+	~SoftwareRasterizer();
+
+	void clear(float r, float g, float b, float a);
+	void drawTriangles(const Vertex *vertices, size_t count);
+	void drawLines(const Vertex *vertices, const GLushort *indices, size_t count);
+	// Rows are stored bottom to top like a GL read back.
+	void copyToImage(Image &img);
+
+private:
+	unsigned int mWidth;
+	unsigned int mHeight;
+	std::vector<float> mColor;
+
+	void drawTriangle(const Vertex &v0, const Vertex &v1, const Vertex &v2);
+	void drawLine(const Vertex &v0, const Vertex &v1);
+	void blend(unsigned int x, unsigned int y, float r, float g, float b, float a);
+};
+
+#endif // SOFTWARE_RASTERIZER_HPP
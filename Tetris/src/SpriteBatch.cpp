@@ -0,0 +1,66 @@
+#include "SpriteBatch.hpp"
+#include "TextureAtlas.hpp"
+
+SpriteBatch::SpriteBatch(size_t maxSprites) : mMaxSprites(maxSprites)
+{
+	mVertices.reserve(maxSprites * 6);
+
+	gl::GenVertexArrays(1, &mVao);
+	gl::BindVertexArray(mVao);
+	gl::GenBuffers(1, &mVbo);
+	gl::BindBuffer(gl::ARRAY_BUFFER, mVbo);
+	gl::BufferData(gl::ARRAY_BUFFER, maxSprites * 6 * sizeof(TextureVertex), nullptr, gl::DYNAMIC_DRAW);
+	gl::EnableVertexAttribArray(0);
+	gl::VertexAttribPointer(0, 2, gl::FLOAT, gl::FALSE_, sizeof(TextureVertex), 0);
+	gl::EnableVertexAttribArray(1);
+	gl::VertexAttribPointer(1, 2, gl::FLOAT, gl::FALSE_, sizeof(TextureVertex), (GLvoid*)(2 * sizeof(float)));
+	gl::BindVertexArray(0);
+}
+
+SpriteBatch::~SpriteBatch()
+{
+	gl::DeleteBuffers(1, &mVbo);
+	gl::DeleteVertexArrays(1, &mVao);
+}
+
+void SpriteBatch::begin()
+{
+	mVertices.clear();
+}
+
+void SpriteBatch::draw(const AtlasRegion &region, float x, float y, float width, float height)
+{
+	if (mVertices.size() == mMaxSprites * 6)
+	{
+		// TODO: Error handling.
+		return;
+	}
+
+	mVertices.push_back(TextureVertex{ x, y, region.u0, region.v0 });
+	mVertices.push_back(TextureVertex{ x, y + height, region.u0, region.v1 });
+	mVertices.push_back(TextureVertex{ x + width, y, region.u1, region.v0 });
+
+	mVertices.push_back(TextureVertex{ x, y + height, region.u0, region.v1 });
+	mVertices.push_back(TextureVertex{ x + width, y, region.u1, region.v0 });
+	mVertices.push_back(TextureVertex{ x + width, y + height, region.u1, region.v1 });
+}
+
+void SpriteBatch::end(RenderQueue &queue, DrawCommand command)
+{
+	if (mVertices.empty())
+		return;
+
+	// Orphan the storage so the driver doesn't wait for the previous draw.
+	gl::BindBuffer(gl::ARRAY_BUFFER, mVbo);
+	gl::BufferData(gl::ARRAY_BUFFER, mMaxSprites * 6 * sizeof(TextureVertex), nullptr, gl::DYNAMIC_DRAW);
+	gl::BufferSubData(gl::ARRAY_BUFFER, 0, mVertices.size() * sizeof(TextureVertex), mVertices.data());
+
+	command.vao = mVao;
+	command.primitive = gl::TRIANGLES;
+	command.first = 0;
+	command.count = mVertices.size();
+	command.indexType = 0;
+	queue.submit(command);
+
+	mVertices.clear();
+}
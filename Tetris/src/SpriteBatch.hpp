@@ -0,0 +1,30 @@
+#ifndef SPRITE_BATCH_HPP
+#define SPRITE_BATCH_HPP
+#include "Prerequisites.hpp"
+#include "Vertex.hpp"
+#include "RenderQueue.hpp"
+
+struct AtlasRegion;
+
+// Collects textured quads from one atlas into a single draw command. The
+// buffer holds one batch, so end() is called at most once per frame.
+class SpriteBatch
+{
+public:
+	SpriteBatch(size_t maxSprites);
+	~SpriteBatch();
+	SpriteBatch(const SpriteBatch&) = delete;
+	SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+	void begin();
+	void draw(const AtlasRegion &region, float x, float y, float width, float height);
+	void end(RenderQueue &queue, DrawCommand command);
+
+private:
+	GLuint mVao;
+	GLuint mVbo;
+	size_t mMaxSprites;
+	std::vector<TextureVertex> mVertices;
+};
+
+#endif // SPRITE_BATCH_HPP
@@ -0,0 +1,123 @@
+#include "Text.hpp"
+#include "BitmapFont.hpp"
+
+Text::Text(BitmapFont &font, size_t maxLength) : mFont(font), mMaxLength(maxLength),
+	mVertexCount(0), mX(0.0f), mY(0.0f), mScale(1.0f), mDirty(false)
+{
+	mString.reserve(maxLength);
+	mVertices.reserve(maxLength * 6);
+
+	gl::GenVertexArrays(1, &mVao);
+	gl::BindVertexArray(mVao);
+	gl::GenBuffers(1, &mVbo);
+	gl::BindBuffer(gl::ARRAY_BUFFER, mVbo);
+	gl::BufferData(gl::ARRAY_BUFFER, maxLength * 6 * sizeof(TextureVertex), nullptr, gl::DYNAMIC_DRAW);
+	gl::EnableVertexAttribArray(0);
+	gl::VertexAttribPointer(0, 2, gl::FLOAT, gl::FALSE_, sizeof(TextureVertex), 0);
+	gl::EnableVertexAttribArray(1);
+	gl::VertexAttribPointer(1, 2, gl::FLOAT, gl::FALSE_, sizeof(TextureVertex), (GLvoid*)(2 * sizeof(float)));
+	gl::BindVertexArray(0);
+}
+
+Text::~Text()
+{
+	gl::DeleteBuffers(1, &mVbo);
+	gl::DeleteVertexArrays(1, &mVao);
+}
+
+void Text::setString(const std::string &str)
+{
+	if (str == mString)
+		return;
+
+	mString = str;
+	mDirty = true;
+}
+
+void Text::setString(const char *str)
+{
+	if (mString == str)
+		return;
+
+	// Reuses the capacity of the old string.
+	mString.assign(str);
+	mDirty = true;
+}
+
+void Text::setPosition(float x, float y)
+{
+	if (x == mX && y == mY)
+		return;
+
+	mX = x;
+	mY = y;
+	mDirty = true;
+}
+
+void Text::setScale(float scale)
+{
+	if (scale == mScale)
+		return;
+
+	mScale = scale;
+	mDirty = true;
+}
+
+const std::string& Text::getString()
+{
+	return mString;
+}
+
+void Text::draw(RenderQueue &queue, DrawCommand command)
+{
+	if (mDirty)
+		rebuild();
+
+	command.vao = mVao;
+	command.primitive = gl::TRIANGLES;
+	command.first = 0;
+	command.count = mVertexCount;
+	command.indexType = 0;
+	queue.submit(command);
+}
+
+void Text::rebuild()
+{
+	float width = mFont.getGlyphWidth() * mScale;
+	float height = mFont.getGlyphHeight() * mScale;
+	float x = mX;
+	float y = mY;
+	AtlasRegion glyph;
+
+	mVertices.clear();
+
+	// (mX, mY) is the top left corner of the first line.
+	for (size_t i = 0; i < mString.size() && mVertices.size() < mMaxLength * 6; ++i)
+	{
+		if (mString[i] == '\n')
+		{
+			x = mX;
+			y -= height;
+			continue;
+		}
+
+		if (mString[i] != ' ' && mFont.getGlyph(mString[i], &glyph))
+		{
+			mVertices.push_back(TextureVertex{ x, y - height, glyph.u0, glyph.v0 });
+			mVertices.push_back(TextureVertex{ x, y, glyph.u0, glyph.v1 });
+			mVertices.push_back(TextureVertex{ x + width, y - height, glyph.u1, glyph.v0 });
+
+			mVertices.push_back(TextureVertex{ x, y, glyph.u0, glyph.v1 });
+			mVertices.push_back(TextureVertex{ x + width, y - height, glyph.u1, glyph.v0 });
+			mVertices.push_back(TextureVertex{ x + width, y, glyph.u1, glyph.v1 });
+		}
+
+		x += width;
+	}
+
+	gl::BindBuffer(gl::ARRAY_BUFFER, mVbo);
+	gl::BufferSubData(gl::ARRAY_BUFFER, 0, mVertices.size() * sizeof(TextureVertex), mVertices.data());
+
+	mVertexCount = mVertices.size();
+	mDirty = false;
+}
@@ -0,0 +1,42 @@
+#ifndef TEXT_HPP
+#define TEXT_HPP
+#include "Prerequisites.hpp"
+#include "Vertex.hpp"
+#include "RenderQueue.hpp"
+
+class BitmapFont;
+
+// A string laid out with a BitmapFont into its own vertex buffer. The
+// buffer is only rebuilt when the string or its placement changes.
+class Text
+{
+public:
+	Text(BitmapFont &font, size_t maxLength);
+	~Text();
+	Text(const Text&) = delete;
+	Text& operator=(const Text&) = delete;
+
+	void setString(const std::string &str);
+	void setString(const char *str);
+	void setPosition(float x, float y);
+	void setScale(float scale);
+	const std::string& getString();
+	void draw(RenderQueue &queue, DrawCommand command);
+
+private:
+	BitmapFont &mFont;
+	GLuint mVao;
+	GLuint mVbo;
+	size_t mMaxLength;
+	size_t mVertexCount;
+	std::string mString;
+	std::vector<TextureVertex> mVertices;
+	float mX;
+	float mY;
+	float mScale;
+	bool mDirty;
+
+	void rebuild();
+};
+
+#endif // TEXT_HPP
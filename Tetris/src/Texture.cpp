@@ -1,101 +1,165 @@
 #include "Texture.hpp"
 #include "Image.hpp"
+#include "Trace.hpp"
 
 bool CheckS3TCExt();
 
-Texture::Texture()
+static bool GetPixelFormat(ColorFormat colorFormat, GLint *format,
+	GLint *internalFormat, GLint *dataType)
 {
-	gl::GenTextures(1, &mId);
-}
-
-Texture::~Texture()
-{
-	gl::DeleteTextures(1, &mId);
-}
-
-void Texture::createFromImage(Image &img)
-{
-	GLint format;
-	GLint internalFormat;
-	GLint dataType;
-	
-
-	switch (img.getColorFormat())
+	switch (colorFormat)
 	{
 	case ColorFormat::R8:
-		format = gl::RED;
-		internalFormat = gl::R8;
-		dataType = gl::UNSIGNED_BYTE;
-		break;
+		*format = gl::RED;
+		*internalFormat = gl::R8;
+		*dataType = gl::UNSIGNED_BYTE;
+		return true;
 
 	case ColorFormat::RG8:
-		format = gl::RG;
-		internalFormat = gl::RG8;
-		dataType = gl::UNSIGNED_BYTE;
-		break;
+		*format = gl::RG;
+		*internalFormat = gl::RG8;
+		*dataType = gl::UNSIGNED_BYTE;
+		return true;
 
 	case ColorFormat::RGB8:
-		format = gl::RGB;
-		internalFormat = gl::RGB8;
-		dataType = gl::UNSIGNED_BYTE;
-		break;
+		*format = gl::RGB;
+		*internalFormat = gl::RGB8;
+		*dataType = gl::UNSIGNED_BYTE;
+		return true;
 
 	case ColorFormat::RGBA8:
-		format = gl::RGBA;
-		internalFormat = gl::RGBA8;
-		dataType = gl::UNSIGNED_BYTE;
-		break;
+		*format = gl::RGBA;
+		*internalFormat = gl::RGBA8;
+		*dataType = gl::UNSIGNED_BYTE;
+		return true;
 
 	case ColorFormat::R3G3B2:
-		format = gl::RGB;
-		internalFormat = gl::R3_G3_B2;
-		dataType = gl::UNSIGNED_BYTE_2_3_3_REV;
-		break;
+		*format = gl::RGB;
+		*internalFormat = gl::R3_G3_B2;
+		*dataType = gl::UNSIGNED_BYTE_2_3_3_REV;
+		return true;
 
 	case ColorFormat::R5G6B5:
-		format = gl::RGB;
-		internalFormat = gl::RGB8;
-		dataType = gl::UNSIGNED_SHORT_5_6_5_REV;
-		break;
+		*format = gl::RGB;
+		*internalFormat = gl::RGB8;
+		*dataType = gl::UNSIGNED_SHORT_5_6_5_REV;
+		return true;
 
 	case ColorFormat::RGBA4:
-		format = gl::RGBA;
-		internalFormat = gl::RGBA4;
-		dataType = gl::UNSIGNED_SHORT_4_4_4_4_REV;
-		break;
+		*format = gl::RGBA;
+		*internalFormat = gl::RGBA4;
+		*dataType = gl::UNSIGNED_SHORT_4_4_4_4_REV;
+		return true;
 
 	case ColorFormat::RGB5A1:
-		format = gl::RGBA;
-		internalFormat = gl::RGB5_A1;
-		dataType = gl::UNSIGNED_SHORT_1_5_5_5_REV;
-		break;
+		*format = gl::RGBA;
+		*internalFormat = gl::RGB5_A1;
+		*dataType = gl::UNSIGNED_SHORT_1_5_5_5_REV;
+		return true;
 
 	case ColorFormat::RGB10A2:
-		format = gl::RGBA;
-		internalFormat = gl::RGB10_A2;
-		dataType = gl::UNSIGNED_INT_2_10_10_10_REV;
-		break;
+		*format = gl::RGBA;
+		*internalFormat = gl::RGB10_A2;
+		*dataType = gl::UNSIGNED_INT_2_10_10_10_REV;
+		return true;
 
 	case ColorFormat::SRGB8:
-		format = gl::RGB;
-		internalFormat = gl::SRGB8;
-		dataType = gl::UNSIGNED_BYTE;
-		break;
+		*format = gl::RGB;
+		*internalFormat = gl::SRGB8;
+		*dataType = gl::UNSIGNED_BYTE;
+		return true;
 
 	case ColorFormat::SRGB8A8:
-		format = gl::RGBA;
-		internalFormat = gl::SRGB8_ALPHA8;
-		dataType = gl::UNSIGNED_BYTE;
-		break;
+		*format = gl::RGBA;
+		*internalFormat = gl::SRGB8_ALPHA8;
+		*dataType = gl::UNSIGNED_BYTE;
+		return true;
 
 	default:
-		return createFromCompressedImage(img);
+		return false;
+	}
+}
+
+Texture::Texture() : mWidth(0), mHeight(0)
+{
+	gl::GenTextures(1, &mId);
+}
+
+Texture::~Texture()
+{
+	gl::DeleteTextures(1, &mId);
+}
+
+void Texture::create(unsigned int width, unsigned int height, ColorFormat colorFormat)
+{
+	GLint format;
+	GLint internalFormat;
+	GLint dataType;
+
+	if (GetPixelFormat(colorFormat, &format, &internalFormat, &dataType) == false)
+	{
+		// TODO: Error handling.
+		return;
 	}
+
+	mWidth = width;
+	mHeight = height;
+
+	bind(0);
+	gl::TexParameteri(gl::TEXTURE_2D, gl::TEXTURE_BASE_LEVEL, 0);
+	gl::TexParameteri(gl::TEXTURE_2D, gl::TEXTURE_MAX_LEVEL, 0);
+	gl::TexImage2D(gl::TEXTURE_2D, 0, internalFormat, width, height,
+		0, format, dataType, nullptr);
+	Unbind(0);
+}
+
+void Texture::createFromImage(Image &img)
+{
+	TRACE_SCOPE("Texture::createFromImage");
+	GLint format;
+	GLint internalFormat;
+	GLint dataType;
+
+	if (GetPixelFormat(img.getColorFormat(), &format, &internalFormat, &dataType) == false)
+		return createFromCompressedImage(img);
+
+	mWidth = img.getWidth();
+	mHeight = img.getHeight();
 	
 	bind(0);
+	gl::PixelStorei(gl::UNPACK_ALIGNMENT, 1);
+	gl::TexParameteri(gl::TEXTURE_2D, gl::TEXTURE_BASE_LEVEL, 0);
+	gl::TexParameteri(gl::TEXTURE_2D, gl::TEXTURE_MAX_LEVEL, img.getMaxMipmapLevel());
 	gl::TexImage2D(gl::TEXTURE_2D, 0, internalFormat, img.getWidth(), img.getHeight(),
-		0, format, dataType, img.getBytes().data());
+		0, format, dataType, img.getData());
+
+	for (uint8_t level = 1; level <= img.getMaxMipmapLevel(); ++level)
+	{
+		std::shared_ptr<Image> mipmap = img.getMipmap(level);
+		gl::TexImage2D(gl::TEXTURE_2D, level, internalFormat, mipmap->getWidth(),
+			mipmap->getHeight(), 0, format, dataType, mipmap->getData());
+	}
+
+	Unbind(0);
+}
 
+void Texture::update(unsigned int x, unsigned int y, Image &img)
+{
+	GLint format;
+	GLint internalFormat;
+	GLint dataType;
+
+	if (GetPixelFormat(img.getColorFormat(), &format, &internalFormat, &dataType) == false ||
+		x + img.getWidth() > mWidth || y + img.getHeight() > mHeight)
+	{
+		// TODO: Error handling.
+		return;
+	}
+
+	bind(0);
+	gl::PixelStorei(gl::UNPACK_ALIGNMENT, 1);
+	gl::TexSubImage2D(gl::TEXTURE_2D, 0, x, y, img.getWidth(), img.getHeight(),
+		format, dataType, img.getData());
 	Unbind(0);
 }
 
@@ -166,12 +230,40 @@ void Texture::createFromCompressedImage(Image &img)
 		return;
 	}
 
+	mWidth = img.getWidth();
+	mHeight = img.getHeight();
+
 	bind(0);
+	gl::TexParameteri(gl::TEXTURE_2D, gl::TEXTURE_BASE_LEVEL, 0);
+	gl::TexParameteri(gl::TEXTURE_2D, gl::TEXTURE_MAX_LEVEL, img.getMaxMipmapLevel());
 	gl::CompressedTexImage2D(gl::TEXTURE_2D, 0, internalFormat, img.getWidth(), 
-		img.getHeight(), 0, img.getBytes().size(), img.getBytes().data());
+		img.getHeight(), 0, img.getDataSize(), img.getData());
+
+	for (uint8_t level = 1; level <= img.getMaxMipmapLevel(); ++level)
+	{
+		std::shared_ptr<Image> mipmap = img.getMipmap(level);
+		gl::CompressedTexImage2D(gl::TEXTURE_2D, level, internalFormat, mipmap->getWidth(),
+			mipmap->getHeight(), 0, mipmap->getDataSize(), mipmap->getData());
+	}
+
 	Unbind(0);
 }
 
+GLuint Texture::getId()
+{
+	return mId;
+}
+
+unsigned int Texture::getWidth()
+{
+	return mWidth;
+}
+
+unsigned int Texture::getHeight()
+{
+	return mHeight;
+}
+
 bool CheckS3TCExt()
 {
 	if (gl::exts::var_EXT_texture_compression_s3tc)
@@ -3,6 +3,7 @@
 #include "Prerequisites.hpp"
 
 class Image;
+enum class ColorFormat;
 
 class Texture
 {
@@ -12,12 +13,19 @@ public:
 	Texture(const Texture&) = delete;
 	Texture& operator=(const Texture&) = delete;
 
+	void create(unsigned int width, unsigned int height, ColorFormat format);
 	void createFromImage(Image &img);
+	void update(unsigned int x, unsigned int y, Image &img);
 	void bind(unsigned int slot);
 	static void Unbind(unsigned int slot);
+	GLuint getId();
+	unsigned int getWidth();
+	unsigned int getHeight();
 
 private:
 	GLuint mId;
+	unsigned int mWidth;
+	unsigned int mHeight;
 
 	void createFromCompressedImage(Image &img);
 };
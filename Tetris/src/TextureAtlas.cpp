@@ -0,0 +1,176 @@
+#include "TextureAtlas.hpp"
+#include "Image.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+TextureAtlas::TextureAtlas(unsigned int width, unsigned int height, ColorFormat format,
+	unsigned int padding) : mWidth(width), mHeight(height), mPadding(padding), mFormat(format)
+{
+	mTexture.create(width, height, format);
+
+	// The texture starts out undefined, zero it so unused texels read as
+	// transparent black.
+	if (Image::GetBytesPerPixel(format) != 0)
+	{
+		Image blank(width, height, format);
+		mTexture.update(0, 0, blank);
+	}
+
+	clear();
+}
+
+TextureAtlas::~TextureAtlas()
+{
+}
+
+bool TextureAtlas::insert(Image &img, AtlasRegion *region)
+{
+	if (img.getColorFormat() != mFormat)
+	{
+		// TODO: Error handling.
+		return false;
+	}
+
+	// Padding on the right and bottom keeps linear filtering from bleeding
+	// into the neighbours.
+	unsigned int width = img.getWidth() + mPadding;
+	unsigned int height = img.getHeight() + mPadding;
+	unsigned int bestY = UINT_MAX;
+	unsigned int bestWidth = UINT_MAX;
+	size_t bestIndex = mSkyline.size();
+
+	for (size_t i = 0; i < mSkyline.size(); ++i)
+	{
+		unsigned int y;
+
+		if (fit(i, width, height, &y) == false)
+			continue;
+
+		if (y < bestY || (y == bestY && mSkyline.at(i).width < bestWidth))
+		{
+			bestY = y;
+			bestWidth = mSkyline.at(i).width;
+			bestIndex = i;
+		}
+	}
+
+	if (bestIndex == mSkyline.size())
+		return false;
+
+	unsigned int x = mSkyline.at(bestIndex).x;
+	addNode(bestIndex, x, bestY, width, height);
+
+	size_t bpp = Image::GetBytesPerPixel(mFormat);
+
+	if (mPadding > 0 && bpp != 0 && img.getWidth() != 0 && img.getHeight() != 0)
+	{
+		// Repeat the last column and row into the padding, so filtering at
+		// the region's edge only sees the image's own texels.
+		std::vector<uint8_t> bytes(width * height * bpp);
+		const uint8_t *src = img.getData();
+		size_t srcPitch = img.getWidth() * bpp;
+		size_t dstPitch = width * bpp;
+
+		for (unsigned int i = 0; i < height; ++i)
+		{
+			const uint8_t *srcRow = src + std::min(i, img.getHeight() - 1) * srcPitch;
+			uint8_t *dstRow = bytes.data() + i * dstPitch;
+
+			memcpy(dstRow, srcRow, srcPitch);
+
+			for (unsigned int j = img.getWidth(); j < width; ++j)
+				memcpy(dstRow + j * bpp, srcRow + srcPitch - bpp, bpp);
+		}
+
+		Image padded(width, height, mFormat, bytes);
+		mTexture.update(x, bestY, padded);
+	}
+	else
+		mTexture.update(x, bestY, img);
+
+	region->x = x;
+	region->y = bestY;
+	region->width = img.getWidth();
+	region->height = img.getHeight();
+	region->u0 = static_cast<float>(x) / mWidth;
+	region->v0 = static_cast<float>(bestY) / mHeight;
+	region->u1 = static_cast<float>(x + img.getWidth()) / mWidth;
+	region->v1 = static_cast<float>(bestY + img.getHeight()) / mHeight;
+
+	return true;
+}
+
+void TextureAtlas::clear()
+{
+	mSkyline.clear();
+	mSkyline.push_back(SkylineNode{ 0, 0, mWidth });
+}
+
+Texture& TextureAtlas::getTexture()
+{
+	return mTexture;
+}
+
+bool TextureAtlas::fit(size_t index, unsigned int width, unsigned int height, unsigned int *y)
+{
+	unsigned int x = mSkyline.at(index).x;
+	unsigned int widthLeft = width;
+
+	if (x + width > mWidth)
+		return false;
+
+	*y = 0;
+
+	// The rectangle rests on the highest segment it spans.
+	for (size_t i = index; widthLeft > 0; ++i)
+	{
+		*y = std::max(*y, mSkyline.at(i).y);
+
+		if (*y + height > mHeight)
+			return false;
+
+		widthLeft -= std::min(widthLeft, mSkyline.at(i).width);
+	}
+
+	return true;
+}
+
+void TextureAtlas::addNode(size_t index, unsigned int x, unsigned int y,
+	unsigned int width, unsigned int height)
+{
+	mSkyline.insert(mSkyline.begin() + index, SkylineNode{ x, y + height, width });
+
+	// Shrink or drop the segments now covered by the new one.
+	for (size_t i = index + 1; i < mSkyline.size(); )
+	{
+		SkylineNode &prev = mSkyline.at(i - 1);
+		SkylineNode &node = mSkyline.at(i);
+
+		if (node.x >= prev.x + prev.width)
+			break;
+
+		unsigned int shrink = prev.x + prev.width - node.x;
+
+		if (shrink < node.width)
+		{
+			node.x += shrink;
+			node.width -= shrink;
+			break;
+		}
+
+		mSkyline.erase(mSkyline.begin() + i);
+	}
+
+	// Merge neighbours at the same height.
+	for (size_t i = 0; i + 1 < mSkyline.size(); )
+	{
+		if (mSkyline.at(i).y == mSkyline.at(i + 1).y)
+		{
+			mSkyline.at(i).width += mSkyline.at(i + 1).width;
+			mSkyline.erase(mSkyline.begin() + i + 1);
+		}
+		else
+			++i;
+	}
+}
@@ -0,0 +1,49 @@
+#ifndef TEXTURE_ATLAS_HPP
+#define TEXTURE_ATLAS_HPP
+#include "Prerequisites.hpp"
+#include "Texture.hpp"
+
+class Image;
+
+struct AtlasRegion
+{
+	unsigned int x, y;
+	unsigned int width, height;
+	float u0, v0, u1, v1;
+};
+
+// Packs images into one large texture. Placement uses a skyline: the atlas
+// keeps the top edge of the packed area as a list of horizontal segments
+// and puts every new rectangle where it ends up lowest.
+class TextureAtlas
+{
+public:
+	TextureAtlas(unsigned int width, unsigned int height, ColorFormat format,
+		unsigned int padding = 1);
+	~TextureAtlas();
+	TextureAtlas(const TextureAtlas&) = delete;
+	TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+	bool insert(Image &img, AtlasRegion *region);
+	void clear();
+	Texture& getTexture();
+
+private:
+	struct SkylineNode
+	{
+		unsigned int x, y, width;
+	};
+
+	Texture mTexture;
+	std::vector<SkylineNode> mSkyline;
+	unsigned int mWidth;
+	unsigned int mHeight;
+	unsigned int mPadding;
+	ColorFormat mFormat;
+
+	bool fit(size_t index, unsigned int width, unsigned int height, unsigned int *y);
+	void addNode(size_t index, unsigned int x, unsigned int y,
+		unsigned int width, unsigned int height);
+};
+
+#endif // TEXTURE_ATLAS_HPP
@@ -0,0 +1,154 @@
+#include "Trace.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+
+// Events kept per thread, about 1.5 MB each.
+const size_t TRACE_BUFFER_SIZE = 64 * 1024;
+
+struct TraceEvent
+{
+	const char *name;
+	uint64_t begin;
+	uint64_t end;
+};
+
+struct TraceBuffer
+{
+	unsigned int threadId;
+	const char *name;
+	std::vector<TraceEvent> events;
+	// Total events ever written, only the owning thread stores to it.
+	std::atomic<uint64_t> count;
+};
+
+static std::mutex buffersMutex;
+static std::vector<std::shared_ptr<TraceBuffer>> buffers;
+static thread_local TraceBuffer *threadBuffer = nullptr;
+// Copy of one buffer while it's written out, reserved up front so a dump
+// mid frame doesn't allocate.
+static std::vector<TraceEvent> dumpEvents;
+
+static TraceBuffer* GetThreadBuffer()
+{
+	if (threadBuffer == nullptr)
+	{
+		std::shared_ptr<TraceBuffer> buffer = std::make_shared<TraceBuffer>();
+		buffer->name = "thread";
+		buffer->events.resize(TRACE_BUFFER_SIZE);
+		buffer->count = 0;
+
+		std::lock_guard<std::mutex> lock(buffersMutex);
+		buffer->threadId = static_cast<unsigned int>(buffers.size()) + 1;
+		buffers.push_back(buffer);
+		threadBuffer = buffer.get();
+	}
+
+	return threadBuffer;
+}
+
+namespace Trace
+{
+	std::atomic<bool> enabled(false);
+
+	void SetEnabled(bool enable)
+	{
+		GetTime();
+
+		if (enable)
+		{
+			std::lock_guard<std::mutex> lock(buffersMutex);
+			dumpEvents.reserve(TRACE_BUFFER_SIZE);
+		}
+
+		enabled = enable;
+	}
+
+	bool IsEnabled()
+	{
+		return enabled;
+	}
+
+	uint64_t GetTime()
+	{
+		static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		// Never zero, TraceScope uses zero for disabled.
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - start).count() + 1;
+	}
+
+	void Record(const char *name, uint64_t begin, uint64_t end)
+	{
+		TraceBuffer *buffer = GetThreadBuffer();
+		uint64_t count = buffer->count.load(std::memory_order_relaxed);
+		buffer->events[count % TRACE_BUFFER_SIZE] = TraceEvent{ name, begin, end };
+		buffer->count.store(count + 1, std::memory_order_release);
+	}
+
+	void SetThreadName(const char *name)
+	{
+		// Threads only get a buffer once tracing is on.
+		if (enabled == false)
+			return;
+
+		TraceBuffer *buffer = GetThreadBuffer();
+
+		std::lock_guard<std::mutex> lock(buffersMutex);
+		buffer->name = name;
+	}
+
+	bool WriteChromeJson(const std::string &fileName)
+	{
+		FILE *file = fopen(fileName.c_str(), "w");
+
+		if (file == nullptr)
+		{
+			// TODO: Error handling.
+			return false;
+		}
+
+		std::lock_guard<std::mutex> lock(buffersMutex);
+		std::vector<TraceEvent> &events = dumpEvents;
+		bool first = true;
+
+		fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+		for (auto &buffer : buffers)
+		{
+			uint64_t count = buffer->count.load(std::memory_order_acquire);
+			uint64_t begin = count > TRACE_BUFFER_SIZE ? count - TRACE_BUFFER_SIZE : 0;
+
+			events.clear();
+
+			for (uint64_t i = begin; i < count; ++i)
+				events.push_back(buffer->events[i % TRACE_BUFFER_SIZE]);
+
+			// The owner keeps recording meanwhile, drop the copies whose slot it
+			// has written since, and the one it may be writing right now.
+			std::atomic_thread_fence(std::memory_order_acquire);
+			uint64_t written = buffer->count.load(std::memory_order_relaxed) + 1;
+			uint64_t valid = written > TRACE_BUFFER_SIZE ? written - TRACE_BUFFER_SIZE : 0;
+			size_t skip = static_cast<size_t>(std::min(std::max(valid, begin) - begin,
+				static_cast<uint64_t>(events.size())));
+
+			fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+				"\"args\":{\"name\":\"%s %u\"}}", first ? "" : ",\n", buffer->threadId,
+				buffer->name, buffer->threadId);
+			first = false;
+
+			for (size_t i = skip; i < events.size(); ++i)
+			{
+				const TraceEvent &event = events[i];
+				// Microseconds with nanosecond precision.
+				fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,"
+					"\"ts\":%.3f,\"dur\":%.3f}", event.name, buffer->threadId,
+					event.begin / 1000.0, (event.end - event.begin) / 1000.0);
+			}
+		}
+
+		fprintf(file, "\n]}\n");
+		fclose(file);
+		return true;
+	}
+}
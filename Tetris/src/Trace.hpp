@@ -0,0 +1,54 @@
+#ifndef TRACE_HPP
+#define TRACE_HPP
+#include "Prerequisites.hpp"
+#include <atomic>
+
+// Scoped timing events written to a Chrome trace JSON file, which can be
+// opened in chrome://tracing or Perfetto. Every thread records into its
+// own ring buffer, so tracing takes no locks after the first event of a
+// thread; the oldest events are overwritten when a buffer is full.
+// Names must be string literals, only the pointer is stored.
+
+#define TRACE_CONCAT_IMPL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_IMPL(a, b)
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(traceScope, __LINE__)(name)
+
+namespace Trace
+{
+	void SetEnabled(bool enabled);
+	bool IsEnabled();
+	// Nanoseconds since the first call.
+	uint64_t GetTime();
+	void Record(const char *name, uint64_t begin, uint64_t end);
+	// Shown for the calling thread in the viewer, ignored while disabled.
+	void SetThreadName(const char *name);
+	// Writes what the buffers hold. Events recorded while this runs may
+	// be left out.
+	bool WriteChromeJson(const std::string &fileName);
+
+	extern std::atomic<bool> enabled;
+}
+
+class TraceScope
+{
+public:
+	TraceScope(const char *name) : mName(name),
+		mBegin(Trace::enabled.load(std::memory_order_relaxed) ? Trace::GetTime() : 0)
+	{
+	}
+
+	~TraceScope()
+	{
+		if (mBegin != 0)
+			Trace::Record(mName, mBegin, Trace::GetTime());
+	}
+
+	TraceScope(const TraceScope&) = delete;
+	TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+	const char *mName;
+	uint64_t mBegin;
+};
+
+#endif // TRACE_HPP
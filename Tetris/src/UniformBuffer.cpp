@@ -0,0 +1,33 @@
+#include "UniformBuffer.hpp"
+
+UniformBuffer::UniformBuffer(size_t size, GLuint binding) : mBinding(binding), mSize(size)
+{
+	gl::GenBuffers(1, &mId);
+	gl::BindBuffer(gl::UNIFORM_BUFFER, mId);
+	gl::BufferData(gl::UNIFORM_BUFFER, size, nullptr, gl::DYNAMIC_DRAW);
+	gl::BindBufferBase(gl::UNIFORM_BUFFER, binding, mId);
+}
+
+UniformBuffer::~UniformBuffer()
+{
+	gl::DeleteBuffers(1, &mId);
+}
+
+void UniformBuffer::update(const void *data, size_t size)
+{
+	if (size > mSize)
+	{
+		// TODO: Error handling.
+		return;
+	}
+
+	// Orphan the old contents, the previous frame may still be reading them.
+	gl::BindBuffer(gl::UNIFORM_BUFFER, mId);
+	gl::BufferData(gl::UNIFORM_BUFFER, mSize, nullptr, gl::DYNAMIC_DRAW);
+	gl::BufferSubData(gl::UNIFORM_BUFFER, 0, size, data);
+}
+
+GLuint UniformBuffer::getBinding()
+{
+	return mBinding;
+}
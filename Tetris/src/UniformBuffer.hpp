@@ -0,0 +1,23 @@
+#ifndef UNIFORM_BUFFER_HPP
+#define UNIFORM_BUFFER_HPP
+#include "Prerequisites.hpp"
+
+// Buffer attached to a fixed uniform block binding point for its lifetime.
+class UniformBuffer
+{
+public:
+	UniformBuffer(size_t size, GLuint binding);
+	~UniformBuffer();
+	UniformBuffer(const UniformBuffer&) = delete;
+	UniformBuffer& operator=(const UniformBuffer&) = delete;
+
+	void update(const void *data, size_t size);
+	GLuint getBinding();
+
+private:
+	GLuint mId;
+	GLuint mBinding;
+	size_t mSize;
+};
+
+#endif // UNIFORM_BUFFER_HPP
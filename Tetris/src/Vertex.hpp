@@ -0,0 +1,17 @@
+#ifndef VERTEX_HPP
+#define VERTEX_HPP
+
+#pragma pack(push, 1)
+struct Vertex
+{
+	float x, y;
+	float r, g, b, a;
+};
+
+struct TextureVertex
+{
+	float x, y, u, v;
+};
+#pragma pack(pop)
+
+#endif // VERTEX_HPP
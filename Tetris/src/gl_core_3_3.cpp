@@ -91,1393 +91,2484 @@ namespace gl
 	namespace exts
 	{
 		LoadTest var_EXT_texture_compression_s3tc;
+		LoadTest var_ARB_get_program_binary;
+		LoadTest var_KHR_debug;
+		LoadTest var_ARB_debug_output;
 		
 	} //namespace exts
-	typedef void (CODEGEN_FUNCPTR *PFNBLENDFUNC)(GLenum, GLenum);
-	PFNBLENDFUNC BlendFunc = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCLEAR)(GLbitfield);
-	PFNCLEAR Clear = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCLEARCOLOR)(GLfloat, GLfloat, GLfloat, GLfloat);
-	PFNCLEARCOLOR ClearColor = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCLEARDEPTH)(GLdouble);
-	PFNCLEARDEPTH ClearDepth = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCLEARSTENCIL)(GLint);
-	PFNCLEARSTENCIL ClearStencil = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCOLORMASK)(GLboolean, GLboolean, GLboolean, GLboolean);
-	PFNCOLORMASK ColorMask = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCULLFACE)(GLenum);
-	PFNCULLFACE CullFace = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDEPTHFUNC)(GLenum);
-	PFNDEPTHFUNC DepthFunc = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDEPTHMASK)(GLboolean);
-	PFNDEPTHMASK DepthMask = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDEPTHRANGE)(GLdouble, GLdouble);
-	PFNDEPTHRANGE DepthRange = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDISABLE)(GLenum);
-	PFNDISABLE Disable = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDRAWBUFFER)(GLenum);
-	PFNDRAWBUFFER DrawBuffer = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNENABLE)(GLenum);
-	PFNENABLE Enable = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNFINISH)(void);
-	PFNFINISH Finish = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNFLUSH)(void);
-	PFNFLUSH Flush = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNFRONTFACE)(GLenum);
-	PFNFRONTFACE FrontFace = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETBOOLEANV)(GLenum, GLboolean *);
-	PFNGETBOOLEANV GetBooleanv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETDOUBLEV)(GLenum, GLdouble *);
-	PFNGETDOUBLEV GetDoublev = 0;
-	typedef GLenum (CODEGEN_FUNCPTR *PFNGETERROR)(void);
-	PFNGETERROR GetError = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETFLOATV)(GLenum, GLfloat *);
-	PFNGETFLOATV GetFloatv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETINTEGERV)(GLenum, GLint *);
-	PFNGETINTEGERV GetIntegerv = 0;
-	typedef const GLubyte * (CODEGEN_FUNCPTR *PFNGETSTRING)(GLenum);
-	PFNGETSTRING GetString = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETTEXIMAGE)(GLenum, GLint, GLenum, GLenum, void *);
-	PFNGETTEXIMAGE GetTexImage = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETTEXLEVELPARAMETERFV)(GLenum, GLint, GLenum, GLfloat *);
-	PFNGETTEXLEVELPARAMETERFV GetTexLevelParameterfv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETTEXLEVELPARAMETERIV)(GLenum, GLint, GLenum, GLint *);
-	PFNGETTEXLEVELPARAMETERIV GetTexLevelParameteriv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETTEXPARAMETERFV)(GLenum, GLenum, GLfloat *);
-	PFNGETTEXPARAMETERFV GetTexParameterfv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETTEXPARAMETERIV)(GLenum, GLenum, GLint *);
-	PFNGETTEXPARAMETERIV GetTexParameteriv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNHINT)(GLenum, GLenum);
-	PFNHINT Hint = 0;
-	typedef GLboolean (CODEGEN_FUNCPTR *PFNISENABLED)(GLenum);
-	PFNISENABLED IsEnabled = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNLINEWIDTH)(GLfloat);
-	PFNLINEWIDTH LineWidth = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNLOGICOP)(GLenum);
-	PFNLOGICOP LogicOp = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNPIXELSTOREF)(GLenum, GLfloat);
-	PFNPIXELSTOREF PixelStoref = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNPIXELSTOREI)(GLenum, GLint);
-	PFNPIXELSTOREI PixelStorei = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNPOINTSIZE)(GLfloat);
-	PFNPOINTSIZE PointSize = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNPOLYGONMODE)(GLenum, GLenum);
-	PFNPOLYGONMODE PolygonMode = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNREADBUFFER)(GLenum);
-	PFNREADBUFFER ReadBuffer = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNREADPIXELS)(GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, void *);
-	PFNREADPIXELS ReadPixels = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNSCISSOR)(GLint, GLint, GLsizei, GLsizei);
-	PFNSCISSOR Scissor = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNSTENCILFUNC)(GLenum, GLint, GLuint);
-	PFNSTENCILFUNC StencilFunc = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNSTENCILMASK)(GLuint);
-	PFNSTENCILMASK StencilMask = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNSTENCILOP)(GLenum, GLenum, GLenum);
-	PFNSTENCILOP StencilOp = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNTEXIMAGE1D)(GLenum, GLint, GLint, GLsizei, GLint, GLenum, GLenum, const void *);
-	PFNTEXIMAGE1D TexImage1D = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNTEXIMAGE2D)(GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum, const void *);
-	PFNTEXIMAGE2D TexImage2D = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNTEXPARAMETERF)(GLenum, GLenum, GLfloat);
-	PFNTEXPARAMETERF TexParameterf = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNTEXPARAMETERFV)(GLenum, GLenum, const GLfloat *);
-	PFNTEXPARAMETERFV TexParameterfv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNTEXPARAMETERI)(GLenum, GLenum, GLint);
-	PFNTEXPARAMETERI TexParameteri = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNTEXPARAMETERIV)(GLenum, GLenum, const GLint *);
-	PFNTEXPARAMETERIV TexParameteriv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVIEWPORT)(GLint, GLint, GLsizei, GLsizei);
-	PFNVIEWPORT Viewport = 0;
-	
-	typedef void (CODEGEN_FUNCPTR *PFNBINDTEXTURE)(GLenum, GLuint);
-	PFNBINDTEXTURE BindTexture = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCOPYTEXIMAGE1D)(GLenum, GLint, GLenum, GLint, GLint, GLsizei, GLint);
-	PFNCOPYTEXIMAGE1D CopyTexImage1D = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCOPYTEXIMAGE2D)(GLenum, GLint, GLenum, GLint, GLint, GLsizei, GLsizei, GLint);
-	PFNCOPYTEXIMAGE2D CopyTexImage2D = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCOPYTEXSUBIMAGE1D)(GLenum, GLint, GLint, GLint, GLint, GLsizei);
-	PFNCOPYTEXSUBIMAGE1D CopyTexSubImage1D = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCOPYTEXSUBIMAGE2D)(GLenum, GLint, GLint, GLint, GLint, GLint, GLsizei, GLsizei);
-	PFNCOPYTEXSUBIMAGE2D CopyTexSubImage2D = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDELETETEXTURES)(GLsizei, const GLuint *);
-	PFNDELETETEXTURES DeleteTextures = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDRAWARRAYS)(GLenum, GLint, GLsizei);
-	PFNDRAWARRAYS DrawArrays = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDRAWELEMENTS)(GLenum, GLsizei, GLenum, const void *);
-	PFNDRAWELEMENTS DrawElements = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGENTEXTURES)(GLsizei, GLuint *);
-	PFNGENTEXTURES GenTextures = 0;
-	typedef GLboolean (CODEGEN_FUNCPTR *PFNISTEXTURE)(GLuint);
-	PFNISTEXTURE IsTexture = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNPOLYGONOFFSET)(GLfloat, GLfloat);
-	PFNPOLYGONOFFSET PolygonOffset = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNTEXSUBIMAGE1D)(GLenum, GLint, GLint, GLsizei, GLenum, GLenum, const void *);
-	PFNTEXSUBIMAGE1D TexSubImage1D = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNTEXSUBIMAGE2D)(GLenum, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, const void *);
-	PFNTEXSUBIMAGE2D TexSubImage2D = 0;
-	
-	typedef void (CODEGEN_FUNCPTR *PFNCOPYTEXSUBIMAGE3D)(GLenum, GLint, GLint, GLint, GLint, GLint, GLint, GLsizei, GLsizei);
-	PFNCOPYTEXSUBIMAGE3D CopyTexSubImage3D = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDRAWRANGEELEMENTS)(GLenum, GLuint, GLuint, GLsizei, GLenum, const void *);
-	PFNDRAWRANGEELEMENTS DrawRangeElements = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNTEXIMAGE3D)(GLenum, GLint, GLint, GLsizei, GLsizei, GLsizei, GLint, GLenum, GLenum, const void *);
-	PFNTEXIMAGE3D TexImage3D = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNTEXSUBIMAGE3D)(GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLenum, const void *);
-	PFNTEXSUBIMAGE3D TexSubImage3D = 0;
+	// Extension: ARB_get_program_binary
+	typedef void (CODEGEN_FUNCPTR *PFNGETPROGRAMBINARY)(GLuint, GLsizei, GLsizei *, GLenum *, void *);
+	PFNGETPROGRAMBINARY GetProgramBinary = 0;
+	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMBINARY)(GLuint, GLenum, const void *, GLsizei);
+	PFNPROGRAMBINARY ProgramBinary = 0;
+	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMPARAMETERI)(GLuint, GLenum, GLint);
+	PFNPROGRAMPARAMETERI ProgramParameteri = 0;
 	
-	typedef void (CODEGEN_FUNCPTR *PFNACTIVETEXTURE)(GLenum);
-	PFNACTIVETEXTURE ActiveTexture = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCOMPRESSEDTEXIMAGE1D)(GLenum, GLint, GLenum, GLsizei, GLint, GLsizei, const void *);
-	PFNCOMPRESSEDTEXIMAGE1D CompressedTexImage1D = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCOMPRESSEDTEXIMAGE2D)(GLenum, GLint, GLenum, GLsizei, GLsizei, GLint, GLsizei, const void *);
-	PFNCOMPRESSEDTEXIMAGE2D CompressedTexImage2D = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCOMPRESSEDTEXIMAGE3D)(GLenum, GLint, GLenum, GLsizei, GLsizei, GLsizei, GLint, GLsizei, const void *);
-	PFNCOMPRESSEDTEXIMAGE3D CompressedTexImage3D = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCOMPRESSEDTEXSUBIMAGE1D)(GLenum, GLint, GLint, GLsizei, GLenum, GLsizei, const void *);
-	PFNCOMPRESSEDTEXSUBIMAGE1D CompressedTexSubImage1D = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCOMPRESSEDTEXSUBIMAGE2D)(GLenum, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLsizei, const void *);
-	PFNCOMPRESSEDTEXSUBIMAGE2D CompressedTexSubImage2D = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCOMPRESSEDTEXSUBIMAGE3D)(GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLsizei, const void *);
-	PFNCOMPRESSEDTEXSUBIMAGE3D CompressedTexSubImage3D = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETCOMPRESSEDTEXIMAGE)(GLenum, GLint, void *);
-	PFNGETCOMPRESSEDTEXIMAGE GetCompressedTexImage = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNSAMPLECOVERAGE)(GLfloat, GLboolean);
-	PFNSAMPLECOVERAGE SampleCoverage = 0;
-	
-	typedef void (CODEGEN_FUNCPTR *PFNBLENDFUNCSEPARATE)(GLenum, GLenum, GLenum, GLenum);
-	PFNBLENDFUNCSEPARATE BlendFuncSeparate = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNMULTIDRAWARRAYS)(GLenum, const GLint *, const GLsizei *, GLsizei);
-	PFNMULTIDRAWARRAYS MultiDrawArrays = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNMULTIDRAWELEMENTS)(GLenum, const GLsizei *, GLenum, const void *const*, GLsizei);
-	PFNMULTIDRAWELEMENTS MultiDrawElements = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNPOINTPARAMETERF)(GLenum, GLfloat);
-	PFNPOINTPARAMETERF PointParameterf = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNPOINTPARAMETERFV)(GLenum, const GLfloat *);
-	PFNPOINTPARAMETERFV PointParameterfv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNPOINTPARAMETERI)(GLenum, GLint);
-	PFNPOINTPARAMETERI PointParameteri = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNPOINTPARAMETERIV)(GLenum, const GLint *);
-	PFNPOINTPARAMETERIV PointParameteriv = 0;
-	
-	typedef void (CODEGEN_FUNCPTR *PFNBEGINQUERY)(GLenum, GLuint);
-	PFNBEGINQUERY BeginQuery = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNBINDBUFFER)(GLenum, GLuint);
-	PFNBINDBUFFER BindBuffer = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNBUFFERDATA)(GLenum, GLsizeiptr, const void *, GLenum);
-	PFNBUFFERDATA BufferData = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNBUFFERSUBDATA)(GLenum, GLintptr, GLsizeiptr, const void *);
-	PFNBUFFERSUBDATA BufferSubData = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDELETEBUFFERS)(GLsizei, const GLuint *);
-	PFNDELETEBUFFERS DeleteBuffers = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDELETEQUERIES)(GLsizei, const GLuint *);
-	PFNDELETEQUERIES DeleteQueries = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNENDQUERY)(GLenum);
-	PFNENDQUERY EndQuery = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGENBUFFERS)(GLsizei, GLuint *);
-	PFNGENBUFFERS GenBuffers = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGENQUERIES)(GLsizei, GLuint *);
-	PFNGENQUERIES GenQueries = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETBUFFERPARAMETERIV)(GLenum, GLenum, GLint *);
-	PFNGETBUFFERPARAMETERIV GetBufferParameteriv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETBUFFERPOINTERV)(GLenum, GLenum, void **);
-	PFNGETBUFFERPOINTERV GetBufferPointerv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETBUFFERSUBDATA)(GLenum, GLintptr, GLsizeiptr, void *);
-	PFNGETBUFFERSUBDATA GetBufferSubData = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETQUERYOBJECTIV)(GLuint, GLenum, GLint *);
-	PFNGETQUERYOBJECTIV GetQueryObjectiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETQUERYOBJECTUIV)(GLuint, GLenum, GLuint *);
-	PFNGETQUERYOBJECTUIV GetQueryObjectuiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETQUERYIV)(GLenum, GLenum, GLint *);
-	PFNGETQUERYIV GetQueryiv = 0;
-	typedef GLboolean (CODEGEN_FUNCPTR *PFNISBUFFER)(GLuint);
-	PFNISBUFFER IsBuffer = 0;
-	typedef GLboolean (CODEGEN_FUNCPTR *PFNISQUERY)(GLuint);
-	PFNISQUERY IsQuery = 0;
-	typedef void * (CODEGEN_FUNCPTR *PFNMAPBUFFER)(GLenum, GLenum);
-	PFNMAPBUFFER MapBuffer = 0;
-	typedef GLboolean (CODEGEN_FUNCPTR *PFNUNMAPBUFFER)(GLenum);
-	PFNUNMAPBUFFER UnmapBuffer = 0;
-	
-	typedef void (CODEGEN_FUNCPTR *PFNATTACHSHADER)(GLuint, GLuint);
-	PFNATTACHSHADER AttachShader = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNBINDATTRIBLOCATION)(GLuint, GLuint, const GLchar *);
-	PFNBINDATTRIBLOCATION BindAttribLocation = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNBLENDEQUATIONSEPARATE)(GLenum, GLenum);
-	PFNBLENDEQUATIONSEPARATE BlendEquationSeparate = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCOMPILESHADER)(GLuint);
-	PFNCOMPILESHADER CompileShader = 0;
-	typedef GLuint (CODEGEN_FUNCPTR *PFNCREATEPROGRAM)(void);
-	PFNCREATEPROGRAM CreateProgram = 0;
-	typedef GLuint (CODEGEN_FUNCPTR *PFNCREATESHADER)(GLenum);
-	PFNCREATESHADER CreateShader = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDELETEPROGRAM)(GLuint);
-	PFNDELETEPROGRAM DeleteProgram = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDELETESHADER)(GLuint);
-	PFNDELETESHADER DeleteShader = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDETACHSHADER)(GLuint, GLuint);
-	PFNDETACHSHADER DetachShader = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDISABLEVERTEXATTRIBARRAY)(GLuint);
-	PFNDISABLEVERTEXATTRIBARRAY DisableVertexAttribArray = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDRAWBUFFERS)(GLsizei, const GLenum *);
-	PFNDRAWBUFFERS DrawBuffers = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNENABLEVERTEXATTRIBARRAY)(GLuint);
-	PFNENABLEVERTEXATTRIBARRAY EnableVertexAttribArray = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVEATTRIB)(GLuint, GLuint, GLsizei, GLsizei *, GLint *, GLenum *, GLchar *);
-	PFNGETACTIVEATTRIB GetActiveAttrib = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVEUNIFORM)(GLuint, GLuint, GLsizei, GLsizei *, GLint *, GLenum *, GLchar *);
-	PFNGETACTIVEUNIFORM GetActiveUniform = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETATTACHEDSHADERS)(GLuint, GLsizei, GLsizei *, GLuint *);
-	PFNGETATTACHEDSHADERS GetAttachedShaders = 0;
-	typedef GLint (CODEGEN_FUNCPTR *PFNGETATTRIBLOCATION)(GLuint, const GLchar *);
-	PFNGETATTRIBLOCATION GetAttribLocation = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETPROGRAMINFOLOG)(GLuint, GLsizei, GLsizei *, GLchar *);
-	PFNGETPROGRAMINFOLOG GetProgramInfoLog = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETPROGRAMIV)(GLuint, GLenum, GLint *);
-	PFNGETPROGRAMIV GetProgramiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETSHADERINFOLOG)(GLuint, GLsizei, GLsizei *, GLchar *);
-	PFNGETSHADERINFOLOG GetShaderInfoLog = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETSHADERSOURCE)(GLuint, GLsizei, GLsizei *, GLchar *);
-	PFNGETSHADERSOURCE GetShaderSource = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETSHADERIV)(GLuint, GLenum, GLint *);
-	PFNGETSHADERIV GetShaderiv = 0;
-	typedef GLint (CODEGEN_FUNCPTR *PFNGETUNIFORMLOCATION)(GLuint, const GLchar *);
-	PFNGETUNIFORMLOCATION GetUniformLocation = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETUNIFORMFV)(GLuint, GLint, GLfloat *);
-	PFNGETUNIFORMFV GetUniformfv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETUNIFORMIV)(GLuint, GLint, GLint *);
-	PFNGETUNIFORMIV GetUniformiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETVERTEXATTRIBPOINTERV)(GLuint, GLenum, void **);
-	PFNGETVERTEXATTRIBPOINTERV GetVertexAttribPointerv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETVERTEXATTRIBDV)(GLuint, GLenum, GLdouble *);
-	PFNGETVERTEXATTRIBDV GetVertexAttribdv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETVERTEXATTRIBFV)(GLuint, GLenum, GLfloat *);
-	PFNGETVERTEXATTRIBFV GetVertexAttribfv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETVERTEXATTRIBIV)(GLuint, GLenum, GLint *);
-	PFNGETVERTEXATTRIBIV GetVertexAttribiv = 0;
-	typedef GLboolean (CODEGEN_FUNCPTR *PFNISPROGRAM)(GLuint);
-	PFNISPROGRAM IsProgram = 0;
-	typedef GLboolean (CODEGEN_FUNCPTR *PFNISSHADER)(GLuint);
-	PFNISSHADER IsShader = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNLINKPROGRAM)(GLuint);
-	PFNLINKPROGRAM LinkProgram = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNSHADERSOURCE)(GLuint, GLsizei, const GLchar *const*, const GLint *);
-	PFNSHADERSOURCE ShaderSource = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNSTENCILFUNCSEPARATE)(GLenum, GLenum, GLint, GLuint);
-	PFNSTENCILFUNCSEPARATE StencilFuncSeparate = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNSTENCILMASKSEPARATE)(GLenum, GLuint);
-	PFNSTENCILMASKSEPARATE StencilMaskSeparate = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNSTENCILOPSEPARATE)(GLenum, GLenum, GLenum, GLenum);
-	PFNSTENCILOPSEPARATE StencilOpSeparate = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM1F)(GLint, GLfloat);
-	PFNUNIFORM1F Uniform1f = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM1FV)(GLint, GLsizei, const GLfloat *);
-	PFNUNIFORM1FV Uniform1fv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM1I)(GLint, GLint);
-	PFNUNIFORM1I Uniform1i = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM1IV)(GLint, GLsizei, const GLint *);
-	PFNUNIFORM1IV Uniform1iv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM2F)(GLint, GLfloat, GLfloat);
-	PFNUNIFORM2F Uniform2f = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM2FV)(GLint, GLsizei, const GLfloat *);
-	PFNUNIFORM2FV Uniform2fv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM2I)(GLint, GLint, GLint);
-	PFNUNIFORM2I Uniform2i = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM2IV)(GLint, GLsizei, const GLint *);
-	PFNUNIFORM2IV Uniform2iv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM3F)(GLint, GLfloat, GLfloat, GLfloat);
-	PFNUNIFORM3F Uniform3f = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM3FV)(GLint, GLsizei, const GLfloat *);
-	PFNUNIFORM3FV Uniform3fv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM3I)(GLint, GLint, GLint, GLint);
-	PFNUNIFORM3I Uniform3i = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM3IV)(GLint, GLsizei, const GLint *);
-	PFNUNIFORM3IV Uniform3iv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM4F)(GLint, GLfloat, GLfloat, GLfloat, GLfloat);
-	PFNUNIFORM4F Uniform4f = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM4FV)(GLint, GLsizei, const GLfloat *);
-	PFNUNIFORM4FV Uniform4fv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM4I)(GLint, GLint, GLint, GLint, GLint);
-	PFNUNIFORM4I Uniform4i = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM4IV)(GLint, GLsizei, const GLint *);
-	PFNUNIFORM4IV Uniform4iv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX2FV)(GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNUNIFORMMATRIX2FV UniformMatrix2fv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX3FV)(GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNUNIFORMMATRIX3FV UniformMatrix3fv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX4FV)(GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNUNIFORMMATRIX4FV UniformMatrix4fv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUSEPROGRAM)(GLuint);
-	PFNUSEPROGRAM UseProgram = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVALIDATEPROGRAM)(GLuint);
-	PFNVALIDATEPROGRAM ValidateProgram = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB1D)(GLuint, GLdouble);
-	PFNVERTEXATTRIB1D VertexAttrib1d = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB1DV)(GLuint, const GLdouble *);
-	PFNVERTEXATTRIB1DV VertexAttrib1dv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB1F)(GLuint, GLfloat);
-	PFNVERTEXATTRIB1F VertexAttrib1f = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB1FV)(GLuint, const GLfloat *);
-	PFNVERTEXATTRIB1FV VertexAttrib1fv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB1S)(GLuint, GLshort);
-	PFNVERTEXATTRIB1S VertexAttrib1s = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB1SV)(GLuint, const GLshort *);
-	PFNVERTEXATTRIB1SV VertexAttrib1sv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB2D)(GLuint, GLdouble, GLdouble);
-	PFNVERTEXATTRIB2D VertexAttrib2d = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB2DV)(GLuint, const GLdouble *);
-	PFNVERTEXATTRIB2DV VertexAttrib2dv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB2F)(GLuint, GLfloat, GLfloat);
-	PFNVERTEXATTRIB2F VertexAttrib2f = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB2FV)(GLuint, const GLfloat *);
-	PFNVERTEXATTRIB2FV VertexAttrib2fv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB2S)(GLuint, GLshort, GLshort);
-	PFNVERTEXATTRIB2S VertexAttrib2s = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB2SV)(GLuint, const GLshort *);
-	PFNVERTEXATTRIB2SV VertexAttrib2sv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB3D)(GLuint, GLdouble, GLdouble, GLdouble);
-	PFNVERTEXATTRIB3D VertexAttrib3d = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB3DV)(GLuint, const GLdouble *);
-	PFNVERTEXATTRIB3DV VertexAttrib3dv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB3F)(GLuint, GLfloat, GLfloat, GLfloat);
-	PFNVERTEXATTRIB3F VertexAttrib3f = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB3FV)(GLuint, const GLfloat *);
-	PFNVERTEXATTRIB3FV VertexAttrib3fv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB3S)(GLuint, GLshort, GLshort, GLshort);
-	PFNVERTEXATTRIB3S VertexAttrib3s = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB3SV)(GLuint, const GLshort *);
-	PFNVERTEXATTRIB3SV VertexAttrib3sv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4NBV)(GLuint, const GLbyte *);
-	PFNVERTEXATTRIB4NBV VertexAttrib4Nbv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4NIV)(GLuint, const GLint *);
-	PFNVERTEXATTRIB4NIV VertexAttrib4Niv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4NSV)(GLuint, const GLshort *);
-	PFNVERTEXATTRIB4NSV VertexAttrib4Nsv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4NUB)(GLuint, GLubyte, GLubyte, GLubyte, GLubyte);
-	PFNVERTEXATTRIB4NUB VertexAttrib4Nub = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4NUBV)(GLuint, const GLubyte *);
-	PFNVERTEXATTRIB4NUBV VertexAttrib4Nubv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4NUIV)(GLuint, const GLuint *);
-	PFNVERTEXATTRIB4NUIV VertexAttrib4Nuiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4NUSV)(GLuint, const GLushort *);
-	PFNVERTEXATTRIB4NUSV VertexAttrib4Nusv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4BV)(GLuint, const GLbyte *);
-	PFNVERTEXATTRIB4BV VertexAttrib4bv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4D)(GLuint, GLdouble, GLdouble, GLdouble, GLdouble);
-	PFNVERTEXATTRIB4D VertexAttrib4d = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4DV)(GLuint, const GLdouble *);
-	PFNVERTEXATTRIB4DV VertexAttrib4dv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4F)(GLuint, GLfloat, GLfloat, GLfloat, GLfloat);
-	PFNVERTEXATTRIB4F VertexAttrib4f = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4FV)(GLuint, const GLfloat *);
-	PFNVERTEXATTRIB4FV VertexAttrib4fv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4IV)(GLuint, const GLint *);
-	PFNVERTEXATTRIB4IV VertexAttrib4iv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4S)(GLuint, GLshort, GLshort, GLshort, GLshort);
-	PFNVERTEXATTRIB4S VertexAttrib4s = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4SV)(GLuint, const GLshort *);
-	PFNVERTEXATTRIB4SV VertexAttrib4sv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4UBV)(GLuint, const GLubyte *);
-	PFNVERTEXATTRIB4UBV VertexAttrib4ubv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4UIV)(GLuint, const GLuint *);
-	PFNVERTEXATTRIB4UIV VertexAttrib4uiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4USV)(GLuint, const GLushort *);
-	PFNVERTEXATTRIB4USV VertexAttrib4usv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBPOINTER)(GLuint, GLint, GLenum, GLboolean, GLsizei, const void *);
-	PFNVERTEXATTRIBPOINTER VertexAttribPointer = 0;
-	
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX2X3FV)(GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNUNIFORMMATRIX2X3FV UniformMatrix2x3fv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX2X4FV)(GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNUNIFORMMATRIX2X4FV UniformMatrix2x4fv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX3X2FV)(GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNUNIFORMMATRIX3X2FV UniformMatrix3x2fv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX3X4FV)(GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNUNIFORMMATRIX3X4FV UniformMatrix3x4fv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX4X2FV)(GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNUNIFORMMATRIX4X2FV UniformMatrix4x2fv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX4X3FV)(GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNUNIFORMMATRIX4X3FV UniformMatrix4x3fv = 0;
-	
-	typedef void (CODEGEN_FUNCPTR *PFNBEGINCONDITIONALRENDER)(GLuint, GLenum);
-	PFNBEGINCONDITIONALRENDER BeginConditionalRender = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNBEGINTRANSFORMFEEDBACK)(GLenum);
-	PFNBEGINTRANSFORMFEEDBACK BeginTransformFeedback = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNBINDBUFFERBASE)(GLenum, GLuint, GLuint);
-	PFNBINDBUFFERBASE BindBufferBase = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNBINDBUFFERRANGE)(GLenum, GLuint, GLuint, GLintptr, GLsizeiptr);
-	PFNBINDBUFFERRANGE BindBufferRange = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNBINDFRAGDATALOCATION)(GLuint, GLuint, const GLchar *);
-	PFNBINDFRAGDATALOCATION BindFragDataLocation = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNBINDFRAMEBUFFER)(GLenum, GLuint);
-	PFNBINDFRAMEBUFFER BindFramebuffer = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNBINDRENDERBUFFER)(GLenum, GLuint);
-	PFNBINDRENDERBUFFER BindRenderbuffer = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNBINDVERTEXARRAY)(GLuint);
-	PFNBINDVERTEXARRAY BindVertexArray = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNBLITFRAMEBUFFER)(GLint, GLint, GLint, GLint, GLint, GLint, GLint, GLint, GLbitfield, GLenum);
-	PFNBLITFRAMEBUFFER BlitFramebuffer = 0;
-	typedef GLenum (CODEGEN_FUNCPTR *PFNCHECKFRAMEBUFFERSTATUS)(GLenum);
-	PFNCHECKFRAMEBUFFERSTATUS CheckFramebufferStatus = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCLAMPCOLOR)(GLenum, GLenum);
-	PFNCLAMPCOLOR ClampColor = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCLEARBUFFERFI)(GLenum, GLint, GLfloat, GLint);
-	PFNCLEARBUFFERFI ClearBufferfi = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCLEARBUFFERFV)(GLenum, GLint, const GLfloat *);
-	PFNCLEARBUFFERFV ClearBufferfv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCLEARBUFFERIV)(GLenum, GLint, const GLint *);
-	PFNCLEARBUFFERIV ClearBufferiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCLEARBUFFERUIV)(GLenum, GLint, const GLuint *);
-	PFNCLEARBUFFERUIV ClearBufferuiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNCOLORMASKI)(GLuint, GLboolean, GLboolean, GLboolean, GLboolean);
-	PFNCOLORMASKI ColorMaski = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDELETEFRAMEBUFFERS)(GLsizei, const GLuint *);
-	PFNDELETEFRAMEBUFFERS DeleteFramebuffers = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDELETERENDERBUFFERS)(GLsizei, const GLuint *);
-	PFNDELETERENDERBUFFERS DeleteRenderbuffers = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDELETEVERTEXARRAYS)(GLsizei, const GLuint *);
-	PFNDELETEVERTEXARRAYS DeleteVertexArrays = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDISABLEI)(GLenum, GLuint);
-	PFNDISABLEI Disablei = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNENABLEI)(GLenum, GLuint);
-	PFNENABLEI Enablei = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNENDCONDITIONALRENDER)(void);
-	PFNENDCONDITIONALRENDER EndConditionalRender = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNENDTRANSFORMFEEDBACK)(void);
-	PFNENDTRANSFORMFEEDBACK EndTransformFeedback = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNFLUSHMAPPEDBUFFERRANGE)(GLenum, GLintptr, GLsizeiptr);
-	PFNFLUSHMAPPEDBUFFERRANGE FlushMappedBufferRange = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNFRAMEBUFFERRENDERBUFFER)(GLenum, GLenum, GLenum, GLuint);
-	PFNFRAMEBUFFERRENDERBUFFER FramebufferRenderbuffer = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNFRAMEBUFFERTEXTURE1D)(GLenum, GLenum, GLenum, GLuint, GLint);
-	PFNFRAMEBUFFERTEXTURE1D FramebufferTexture1D = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNFRAMEBUFFERTEXTURE2D)(GLenum, GLenum, GLenum, GLuint, GLint);
-	PFNFRAMEBUFFERTEXTURE2D FramebufferTexture2D = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNFRAMEBUFFERTEXTURE3D)(GLenum, GLenum, GLenum, GLuint, GLint, GLint);
-	PFNFRAMEBUFFERTEXTURE3D FramebufferTexture3D = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNFRAMEBUFFERTEXTURELAYER)(GLenum, GLenum, GLuint, GLint, GLint);
-	PFNFRAMEBUFFERTEXTURELAYER FramebufferTextureLayer = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGENFRAMEBUFFERS)(GLsizei, GLuint *);
-	PFNGENFRAMEBUFFERS GenFramebuffers = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGENRENDERBUFFERS)(GLsizei, GLuint *);
-	PFNGENRENDERBUFFERS GenRenderbuffers = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGENVERTEXARRAYS)(GLsizei, GLuint *);
-	PFNGENVERTEXARRAYS GenVertexArrays = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGENERATEMIPMAP)(GLenum);
-	PFNGENERATEMIPMAP GenerateMipmap = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETBOOLEANI_V)(GLenum, GLuint, GLboolean *);
-	PFNGETBOOLEANI_V GetBooleani_v = 0;
-	typedef GLint (CODEGEN_FUNCPTR *PFNGETFRAGDATALOCATION)(GLuint, const GLchar *);
-	PFNGETFRAGDATALOCATION GetFragDataLocation = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETFRAMEBUFFERATTACHMENTPARAMETERIV)(GLenum, GLenum, GLenum, GLint *);
-	PFNGETFRAMEBUFFERATTACHMENTPARAMETERIV GetFramebufferAttachmentParameteriv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETINTEGERI_V)(GLenum, GLuint, GLint *);
-	PFNGETINTEGERI_V GetIntegeri_v = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETRENDERBUFFERPARAMETERIV)(GLenum, GLenum, GLint *);
-	PFNGETRENDERBUFFERPARAMETERIV GetRenderbufferParameteriv = 0;
-	typedef const GLubyte * (CODEGEN_FUNCPTR *PFNGETSTRINGI)(GLenum, GLuint);
-	PFNGETSTRINGI GetStringi = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETTEXPARAMETERIIV)(GLenum, GLenum, GLint *);
-	PFNGETTEXPARAMETERIIV GetTexParameterIiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETTEXPARAMETERIUIV)(GLenum, GLenum, GLuint *);
-	PFNGETTEXPARAMETERIUIV GetTexParameterIuiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETTRANSFORMFEEDBACKVARYING)(GLuint, GLuint, GLsizei, GLsizei *, GLsizei *, GLenum *, GLchar *);
-	PFNGETTRANSFORMFEEDBACKVARYING GetTransformFeedbackVarying = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETUNIFORMUIV)(GLuint, GLint, GLuint *);
-	PFNGETUNIFORMUIV GetUniformuiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETVERTEXATTRIBIIV)(GLuint, GLenum, GLint *);
-	PFNGETVERTEXATTRIBIIV GetVertexAttribIiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETVERTEXATTRIBIUIV)(GLuint, GLenum, GLuint *);
-	PFNGETVERTEXATTRIBIUIV GetVertexAttribIuiv = 0;
-	typedef GLboolean (CODEGEN_FUNCPTR *PFNISENABLEDI)(GLenum, GLuint);
-	PFNISENABLEDI IsEnabledi = 0;
-	typedef GLboolean (CODEGEN_FUNCPTR *PFNISFRAMEBUFFER)(GLuint);
-	PFNISFRAMEBUFFER IsFramebuffer = 0;
-	typedef GLboolean (CODEGEN_FUNCPTR *PFNISRENDERBUFFER)(GLuint);
-	PFNISRENDERBUFFER IsRenderbuffer = 0;
-	typedef GLboolean (CODEGEN_FUNCPTR *PFNISVERTEXARRAY)(GLuint);
-	PFNISVERTEXARRAY IsVertexArray = 0;
-	typedef void * (CODEGEN_FUNCPTR *PFNMAPBUFFERRANGE)(GLenum, GLintptr, GLsizeiptr, GLbitfield);
-	PFNMAPBUFFERRANGE MapBufferRange = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNRENDERBUFFERSTORAGE)(GLenum, GLenum, GLsizei, GLsizei);
-	PFNRENDERBUFFERSTORAGE RenderbufferStorage = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNRENDERBUFFERSTORAGEMULTISAMPLE)(GLenum, GLsizei, GLenum, GLsizei, GLsizei);
-	PFNRENDERBUFFERSTORAGEMULTISAMPLE RenderbufferStorageMultisample = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNTEXPARAMETERIIV)(GLenum, GLenum, const GLint *);
-	PFNTEXPARAMETERIIV TexParameterIiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNTEXPARAMETERIUIV)(GLenum, GLenum, const GLuint *);
-	PFNTEXPARAMETERIUIV TexParameterIuiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNTRANSFORMFEEDBACKVARYINGS)(GLuint, GLsizei, const GLchar *const*, GLenum);
-	PFNTRANSFORMFEEDBACKVARYINGS TransformFeedbackVaryings = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM1UI)(GLint, GLuint);
-	PFNUNIFORM1UI Uniform1ui = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM1UIV)(GLint, GLsizei, const GLuint *);
-	PFNUNIFORM1UIV Uniform1uiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM2UI)(GLint, GLuint, GLuint);
-	PFNUNIFORM2UI Uniform2ui = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM2UIV)(GLint, GLsizei, const GLuint *);
-	PFNUNIFORM2UIV Uniform2uiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM3UI)(GLint, GLuint, GLuint, GLuint);
-	PFNUNIFORM3UI Uniform3ui = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM3UIV)(GLint, GLsizei, const GLuint *);
-	PFNUNIFORM3UIV Uniform3uiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM4UI)(GLint, GLuint, GLuint, GLuint, GLuint);
-	PFNUNIFORM4UI Uniform4ui = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM4UIV)(GLint, GLsizei, const GLuint *);
-	PFNUNIFORM4UIV Uniform4uiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI1I)(GLuint, GLint);
-	PFNVERTEXATTRIBI1I VertexAttribI1i = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI1IV)(GLuint, const GLint *);
-	PFNVERTEXATTRIBI1IV VertexAttribI1iv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI1UI)(GLuint, GLuint);
-	PFNVERTEXATTRIBI1UI VertexAttribI1ui = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI1UIV)(GLuint, const GLuint *);
-	PFNVERTEXATTRIBI1UIV VertexAttribI1uiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI2I)(GLuint, GLint, GLint);
-	PFNVERTEXATTRIBI2I VertexAttribI2i = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI2IV)(GLuint, const GLint *);
-	PFNVERTEXATTRIBI2IV VertexAttribI2iv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI2UI)(GLuint, GLuint, GLuint);
-	PFNVERTEXATTRIBI2UI VertexAttribI2ui = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI2UIV)(GLuint, const GLuint *);
-	PFNVERTEXATTRIBI2UIV VertexAttribI2uiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI3I)(GLuint, GLint, GLint, GLint);
-	PFNVERTEXATTRIBI3I VertexAttribI3i = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI3IV)(GLuint, const GLint *);
-	PFNVERTEXATTRIBI3IV VertexAttribI3iv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI3UI)(GLuint, GLuint, GLuint, GLuint);
-	PFNVERTEXATTRIBI3UI VertexAttribI3ui = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI3UIV)(GLuint, const GLuint *);
-	PFNVERTEXATTRIBI3UIV VertexAttribI3uiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4BV)(GLuint, const GLbyte *);
-	PFNVERTEXATTRIBI4BV VertexAttribI4bv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4I)(GLuint, GLint, GLint, GLint, GLint);
-	PFNVERTEXATTRIBI4I VertexAttribI4i = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4IV)(GLuint, const GLint *);
-	PFNVERTEXATTRIBI4IV VertexAttribI4iv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4SV)(GLuint, const GLshort *);
-	PFNVERTEXATTRIBI4SV VertexAttribI4sv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4UBV)(GLuint, const GLubyte *);
-	PFNVERTEXATTRIBI4UBV VertexAttribI4ubv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4UI)(GLuint, GLuint, GLuint, GLuint, GLuint);
-	PFNVERTEXATTRIBI4UI VertexAttribI4ui = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4UIV)(GLuint, const GLuint *);
-	PFNVERTEXATTRIBI4UIV VertexAttribI4uiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4USV)(GLuint, const GLushort *);
-	PFNVERTEXATTRIBI4USV VertexAttribI4usv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBIPOINTER)(GLuint, GLint, GLenum, GLsizei, const void *);
-	PFNVERTEXATTRIBIPOINTER VertexAttribIPointer = 0;
+	static int Load_ARB_get_program_binary()
+	{
+		int numFailed = 0;
+		GetProgramBinary = reinterpret_cast<PFNGETPROGRAMBINARY>(IntGetProcAddress("glGetProgramBinary"));
+		if(!GetProgramBinary) ++numFailed;
+		ProgramBinary = reinterpret_cast<PFNPROGRAMBINARY>(IntGetProcAddress("glProgramBinary"));
+		if(!ProgramBinary) ++numFailed;
+		ProgramParameteri = reinterpret_cast<PFNPROGRAMPARAMETERI>(IntGetProcAddress("glProgramParameteri"));
+		if(!ProgramParameteri) ++numFailed;
+		return numFailed;
+	}
 	
-	typedef void (CODEGEN_FUNCPTR *PFNCOPYBUFFERSUBDATA)(GLenum, GLenum, GLintptr, GLintptr, GLsizeiptr);
-	PFNCOPYBUFFERSUBDATA CopyBufferSubData = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDRAWARRAYSINSTANCED)(GLenum, GLint, GLsizei, GLsizei);
-	PFNDRAWARRAYSINSTANCED DrawArraysInstanced = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDRAWELEMENTSINSTANCED)(GLenum, GLsizei, GLenum, const void *, GLsizei);
-	PFNDRAWELEMENTSINSTANCED DrawElementsInstanced = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVEUNIFORMBLOCKNAME)(GLuint, GLuint, GLsizei, GLsizei *, GLchar *);
-	PFNGETACTIVEUNIFORMBLOCKNAME GetActiveUniformBlockName = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVEUNIFORMBLOCKIV)(GLuint, GLuint, GLenum, GLint *);
-	PFNGETACTIVEUNIFORMBLOCKIV GetActiveUniformBlockiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVEUNIFORMNAME)(GLuint, GLuint, GLsizei, GLsizei *, GLchar *);
-	PFNGETACTIVEUNIFORMNAME GetActiveUniformName = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVEUNIFORMSIV)(GLuint, GLsizei, const GLuint *, GLenum, GLint *);
-	PFNGETACTIVEUNIFORMSIV GetActiveUniformsiv = 0;
-	typedef GLuint (CODEGEN_FUNCPTR *PFNGETUNIFORMBLOCKINDEX)(GLuint, const GLchar *);
-	PFNGETUNIFORMBLOCKINDEX GetUniformBlockIndex = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETUNIFORMINDICES)(GLuint, GLsizei, const GLchar *const*, GLuint *);
-	PFNGETUNIFORMINDICES GetUniformIndices = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNPRIMITIVERESTARTINDEX)(GLuint);
-	PFNPRIMITIVERESTARTINDEX PrimitiveRestartIndex = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNTEXBUFFER)(GLenum, GLenum, GLuint);
-	PFNTEXBUFFER TexBuffer = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMBLOCKBINDING)(GLuint, GLuint, GLuint);
-	PFNUNIFORMBLOCKBINDING UniformBlockBinding = 0;
+	// Extension: KHR_debug
+	typedef void (CODEGEN_FUNCPTR *PFNDEBUGMESSAGECALLBACK)(GLDEBUGPROC, const void *);
+	PFNDEBUGMESSAGECALLBACK DebugMessageCallback = 0;
+	typedef void (CODEGEN_FUNCPTR *PFNDEBUGMESSAGECONTROL)(GLenum, GLenum, GLenum, GLsizei, const GLuint *, GLboolean);
+	PFNDEBUGMESSAGECONTROL DebugMessageControl = 0;
+	typedef void (CODEGEN_FUNCPTR *PFNDEBUGMESSAGEINSERT)(GLenum, GLenum, GLuint, GLenum, GLsizei, const GLchar *);
+	PFNDEBUGMESSAGEINSERT DebugMessageInsert = 0;
+	typedef void (CODEGEN_FUNCPTR *PFNPOPDEBUGGROUP)(void);
+	PFNPOPDEBUGGROUP PopDebugGroup = 0;
+	typedef void (CODEGEN_FUNCPTR *PFNPUSHDEBUGGROUP)(GLenum, GLuint, GLsizei, const GLchar *);
+	PFNPUSHDEBUGGROUP PushDebugGroup = 0;
 	
-	typedef GLenum (CODEGEN_FUNCPTR *PFNCLIENTWAITSYNC)(GLsync, GLbitfield, GLuint64);
-	PFNCLIENTWAITSYNC ClientWaitSync = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDELETESYNC)(GLsync);
-	PFNDELETESYNC DeleteSync = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDRAWELEMENTSBASEVERTEX)(GLenum, GLsizei, GLenum, const void *, GLint);
-	PFNDRAWELEMENTSBASEVERTEX DrawElementsBaseVertex = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDRAWELEMENTSINSTANCEDBASEVERTEX)(GLenum, GLsizei, GLenum, const void *, GLsizei, GLint);
-	PFNDRAWELEMENTSINSTANCEDBASEVERTEX DrawElementsInstancedBaseVertex = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDRAWRANGEELEMENTSBASEVERTEX)(GLenum, GLuint, GLuint, GLsizei, GLenum, const void *, GLint);
-	PFNDRAWRANGEELEMENTSBASEVERTEX DrawRangeElementsBaseVertex = 0;
-	typedef GLsync (CODEGEN_FUNCPTR *PFNFENCESYNC)(GLenum, GLbitfield);
-	PFNFENCESYNC FenceSync = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNFRAMEBUFFERTEXTURE)(GLenum, GLenum, GLuint, GLint);
-	PFNFRAMEBUFFERTEXTURE FramebufferTexture = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETBUFFERPARAMETERI64V)(GLenum, GLenum, GLint64 *);
-	PFNGETBUFFERPARAMETERI64V GetBufferParameteri64v = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETINTEGER64I_V)(GLenum, GLuint, GLint64 *);
-	PFNGETINTEGER64I_V GetInteger64i_v = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETINTEGER64V)(GLenum, GLint64 *);
-	PFNGETINTEGER64V GetInteger64v = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETMULTISAMPLEFV)(GLenum, GLuint, GLfloat *);
-	PFNGETMULTISAMPLEFV GetMultisamplefv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETSYNCIV)(GLsync, GLenum, GLsizei, GLsizei *, GLint *);
-	PFNGETSYNCIV GetSynciv = 0;
-	typedef GLboolean (CODEGEN_FUNCPTR *PFNISSYNC)(GLsync);
-	PFNISSYNC IsSync = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNMULTIDRAWELEMENTSBASEVERTEX)(GLenum, const GLsizei *, GLenum, const void *const*, GLsizei, const GLint *);
-	PFNMULTIDRAWELEMENTSBASEVERTEX MultiDrawElementsBaseVertex = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNPROVOKINGVERTEX)(GLenum);
-	PFNPROVOKINGVERTEX ProvokingVertex = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNSAMPLEMASKI)(GLuint, GLbitfield);
-	PFNSAMPLEMASKI SampleMaski = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNTEXIMAGE2DMULTISAMPLE)(GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLboolean);
-	PFNTEXIMAGE2DMULTISAMPLE TexImage2DMultisample = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNTEXIMAGE3DMULTISAMPLE)(GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLsizei, GLboolean);
-	PFNTEXIMAGE3DMULTISAMPLE TexImage3DMultisample = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNWAITSYNC)(GLsync, GLbitfield, GLuint64);
-	PFNWAITSYNC WaitSync = 0;
+	static int Load_KHR_debug()
+	{
+		int numFailed = 0;
+		DebugMessageCallback = reinterpret_cast<PFNDEBUGMESSAGECALLBACK>(IntGetProcAddress("glDebugMessageCallback"));
+		if(!DebugMessageCallback) ++numFailed;
+		DebugMessageControl = reinterpret_cast<PFNDEBUGMESSAGECONTROL>(IntGetProcAddress("glDebugMessageControl"));
+		if(!DebugMessageControl) ++numFailed;
+		DebugMessageInsert = reinterpret_cast<PFNDEBUGMESSAGEINSERT>(IntGetProcAddress("glDebugMessageInsert"));
+		if(!DebugMessageInsert) ++numFailed;
+		PopDebugGroup = reinterpret_cast<PFNPOPDEBUGGROUP>(IntGetProcAddress("glPopDebugGroup"));
+		if(!PopDebugGroup) ++numFailed;
+		PushDebugGroup = reinterpret_cast<PFNPUSHDEBUGGROUP>(IntGetProcAddress("glPushDebugGroup"));
+		if(!PushDebugGroup) ++numFailed;
+		return numFailed;
+	}
 	
-	typedef void (CODEGEN_FUNCPTR *PFNBINDFRAGDATALOCATIONINDEXED)(GLuint, GLuint, GLuint, const GLchar *);
-	PFNBINDFRAGDATALOCATIONINDEXED BindFragDataLocationIndexed = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNBINDSAMPLER)(GLuint, GLuint);
-	PFNBINDSAMPLER BindSampler = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNDELETESAMPLERS)(GLsizei, const GLuint *);
-	PFNDELETESAMPLERS DeleteSamplers = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGENSAMPLERS)(GLsizei, GLuint *);
-	PFNGENSAMPLERS GenSamplers = 0;
-	typedef GLint (CODEGEN_FUNCPTR *PFNGETFRAGDATAINDEX)(GLuint, const GLchar *);
-	PFNGETFRAGDATAINDEX GetFragDataIndex = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETQUERYOBJECTI64V)(GLuint, GLenum, GLint64 *);
-	PFNGETQUERYOBJECTI64V GetQueryObjecti64v = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETQUERYOBJECTUI64V)(GLuint, GLenum, GLuint64 *);
-	PFNGETQUERYOBJECTUI64V GetQueryObjectui64v = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETSAMPLERPARAMETERIIV)(GLuint, GLenum, GLint *);
-	PFNGETSAMPLERPARAMETERIIV GetSamplerParameterIiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETSAMPLERPARAMETERIUIV)(GLuint, GLenum, GLuint *);
-	PFNGETSAMPLERPARAMETERIUIV GetSamplerParameterIuiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETSAMPLERPARAMETERFV)(GLuint, GLenum, GLfloat *);
-	PFNGETSAMPLERPARAMETERFV GetSamplerParameterfv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNGETSAMPLERPARAMETERIV)(GLuint, GLenum, GLint *);
-	PFNGETSAMPLERPARAMETERIV GetSamplerParameteriv = 0;
-	typedef GLboolean (CODEGEN_FUNCPTR *PFNISSAMPLER)(GLuint);
-	PFNISSAMPLER IsSampler = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNQUERYCOUNTER)(GLuint, GLenum);
-	PFNQUERYCOUNTER QueryCounter = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNSAMPLERPARAMETERIIV)(GLuint, GLenum, const GLint *);
-	PFNSAMPLERPARAMETERIIV SamplerParameterIiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNSAMPLERPARAMETERIUIV)(GLuint, GLenum, const GLuint *);
-	PFNSAMPLERPARAMETERIUIV SamplerParameterIuiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNSAMPLERPARAMETERF)(GLuint, GLenum, GLfloat);
-	PFNSAMPLERPARAMETERF SamplerParameterf = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNSAMPLERPARAMETERFV)(GLuint, GLenum, const GLfloat *);
-	PFNSAMPLERPARAMETERFV SamplerParameterfv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNSAMPLERPARAMETERI)(GLuint, GLenum, GLint);
-	PFNSAMPLERPARAMETERI SamplerParameteri = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNSAMPLERPARAMETERIV)(GLuint, GLenum, const GLint *);
-	PFNSAMPLERPARAMETERIV SamplerParameteriv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBDIVISOR)(GLuint, GLuint);
-	PFNVERTEXATTRIBDIVISOR VertexAttribDivisor = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP1UI)(GLuint, GLenum, GLboolean, GLuint);
-	PFNVERTEXATTRIBP1UI VertexAttribP1ui = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP1UIV)(GLuint, GLenum, GLboolean, const GLuint *);
-	PFNVERTEXATTRIBP1UIV VertexAttribP1uiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP2UI)(GLuint, GLenum, GLboolean, GLuint);
-	PFNVERTEXATTRIBP2UI VertexAttribP2ui = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP2UIV)(GLuint, GLenum, GLboolean, const GLuint *);
-	PFNVERTEXATTRIBP2UIV VertexAttribP2uiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP3UI)(GLuint, GLenum, GLboolean, GLuint);
-	PFNVERTEXATTRIBP3UI VertexAttribP3ui = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP3UIV)(GLuint, GLenum, GLboolean, const GLuint *);
-	PFNVERTEXATTRIBP3UIV VertexAttribP3uiv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP4UI)(GLuint, GLenum, GLboolean, GLuint);
-	PFNVERTEXATTRIBP4UI VertexAttribP4ui = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP4UIV)(GLuint, GLenum, GLboolean, const GLuint *);
-	PFNVERTEXATTRIBP4UIV VertexAttribP4uiv = 0;
+	// Extension: ARB_debug_output
+	typedef void (CODEGEN_FUNCPTR *PFNDEBUGMESSAGECALLBACKARB)(GLDEBUGPROCARB, const void *);
+	PFNDEBUGMESSAGECALLBACKARB DebugMessageCallbackARB = 0;
+	typedef void (CODEGEN_FUNCPTR *PFNDEBUGMESSAGECONTROLARB)(GLenum, GLenum, GLenum, GLsizei, const GLuint *, GLboolean);
+	PFNDEBUGMESSAGECONTROLARB DebugMessageControlARB = 0;
+	typedef void (CODEGEN_FUNCPTR *PFNDEBUGMESSAGEINSERTARB)(GLenum, GLenum, GLuint, GLenum, GLsizei, const GLchar *);
+	PFNDEBUGMESSAGEINSERTARB DebugMessageInsertARB = 0;
 	
-	static int LoadCoreFunctions()
+	static int Load_ARB_debug_output()
 	{
 		int numFailed = 0;
+		DebugMessageCallbackARB = reinterpret_cast<PFNDEBUGMESSAGECALLBACKARB>(IntGetProcAddress("glDebugMessageCallbackARB"));
+		if(!DebugMessageCallbackARB) ++numFailed;
+		DebugMessageControlARB = reinterpret_cast<PFNDEBUGMESSAGECONTROLARB>(IntGetProcAddress("glDebugMessageControlARB"));
+		if(!DebugMessageControlARB) ++numFailed;
+		DebugMessageInsertARB = reinterpret_cast<PFNDEBUGMESSAGEINSERTARB>(IntGetProcAddress("glDebugMessageInsertARB"));
+		if(!DebugMessageInsertARB) ++numFailed;
+		return numFailed;
+	}
+	
+	typedef void (CODEGEN_FUNCPTR *PFNBLENDFUNC)(GLenum, GLenum);
+	static void CODEGEN_FUNCPTR Switch_BlendFunc(GLenum a0, GLenum a1)
+	{
 		BlendFunc = reinterpret_cast<PFNBLENDFUNC>(IntGetProcAddress("glBlendFunc"));
-		if(!BlendFunc) ++numFailed;
+		return BlendFunc(a0, a1);
+	}
+	PFNBLENDFUNC BlendFunc = Switch_BlendFunc;
+	typedef void (CODEGEN_FUNCPTR *PFNCLEAR)(GLbitfield);
+	static void CODEGEN_FUNCPTR Switch_Clear(GLbitfield a0)
+	{
 		Clear = reinterpret_cast<PFNCLEAR>(IntGetProcAddress("glClear"));
-		if(!Clear) ++numFailed;
+		return Clear(a0);
+	}
+	PFNCLEAR Clear = Switch_Clear;
+	typedef void (CODEGEN_FUNCPTR *PFNCLEARCOLOR)(GLfloat, GLfloat, GLfloat, GLfloat);
+	static void CODEGEN_FUNCPTR Switch_ClearColor(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3)
+	{
 		ClearColor = reinterpret_cast<PFNCLEARCOLOR>(IntGetProcAddress("glClearColor"));
-		if(!ClearColor) ++numFailed;
+		return ClearColor(a0, a1, a2, a3);
+	}
+	PFNCLEARCOLOR ClearColor = Switch_ClearColor;
+	typedef void (CODEGEN_FUNCPTR *PFNCLEARDEPTH)(GLdouble);
+	static void CODEGEN_FUNCPTR Switch_ClearDepth(GLdouble a0)
+	{
 		ClearDepth = reinterpret_cast<PFNCLEARDEPTH>(IntGetProcAddress("glClearDepth"));
-		if(!ClearDepth) ++numFailed;
+		return ClearDepth(a0);
+	}
+	PFNCLEARDEPTH ClearDepth = Switch_ClearDepth;
+	typedef void (CODEGEN_FUNCPTR *PFNCLEARSTENCIL)(GLint);
+	static void CODEGEN_FUNCPTR Switch_ClearStencil(GLint a0)
+	{
 		ClearStencil = reinterpret_cast<PFNCLEARSTENCIL>(IntGetProcAddress("glClearStencil"));
-		if(!ClearStencil) ++numFailed;
+		return ClearStencil(a0);
+	}
+	PFNCLEARSTENCIL ClearStencil = Switch_ClearStencil;
+	typedef void (CODEGEN_FUNCPTR *PFNCOLORMASK)(GLboolean, GLboolean, GLboolean, GLboolean);
+	static void CODEGEN_FUNCPTR Switch_ColorMask(GLboolean a0, GLboolean a1, GLboolean a2, GLboolean a3)
+	{
 		ColorMask = reinterpret_cast<PFNCOLORMASK>(IntGetProcAddress("glColorMask"));
-		if(!ColorMask) ++numFailed;
+		return ColorMask(a0, a1, a2, a3);
+	}
+	PFNCOLORMASK ColorMask = Switch_ColorMask;
+	typedef void (CODEGEN_FUNCPTR *PFNCULLFACE)(GLenum);
+	static void CODEGEN_FUNCPTR Switch_CullFace(GLenum a0)
+	{
 		CullFace = reinterpret_cast<PFNCULLFACE>(IntGetProcAddress("glCullFace"));
-		if(!CullFace) ++numFailed;
+		return CullFace(a0);
+	}
+	PFNCULLFACE CullFace = Switch_CullFace;
+	typedef void (CODEGEN_FUNCPTR *PFNDEPTHFUNC)(GLenum);
+	static void CODEGEN_FUNCPTR Switch_DepthFunc(GLenum a0)
+	{
 		DepthFunc = reinterpret_cast<PFNDEPTHFUNC>(IntGetProcAddress("glDepthFunc"));
-		if(!DepthFunc) ++numFailed;
+		return DepthFunc(a0);
+	}
+	PFNDEPTHFUNC DepthFunc = Switch_DepthFunc;
+	typedef void (CODEGEN_FUNCPTR *PFNDEPTHMASK)(GLboolean);
+	static void CODEGEN_FUNCPTR Switch_DepthMask(GLboolean a0)
+	{
 		DepthMask = reinterpret_cast<PFNDEPTHMASK>(IntGetProcAddress("glDepthMask"));
-		if(!DepthMask) ++numFailed;
+		return DepthMask(a0);
+	}
+	PFNDEPTHMASK DepthMask = Switch_DepthMask;
+	typedef void (CODEGEN_FUNCPTR *PFNDEPTHRANGE)(GLdouble, GLdouble);
+	static void CODEGEN_FUNCPTR Switch_DepthRange(GLdouble a0, GLdouble a1)
+	{
 		DepthRange = reinterpret_cast<PFNDEPTHRANGE>(IntGetProcAddress("glDepthRange"));
-		if(!DepthRange) ++numFailed;
+		return DepthRange(a0, a1);
+	}
+	PFNDEPTHRANGE DepthRange = Switch_DepthRange;
+	typedef void (CODEGEN_FUNCPTR *PFNDISABLE)(GLenum);
+	static void CODEGEN_FUNCPTR Switch_Disable(GLenum a0)
+	{
 		Disable = reinterpret_cast<PFNDISABLE>(IntGetProcAddress("glDisable"));
-		if(!Disable) ++numFailed;
+		return Disable(a0);
+	}
+	PFNDISABLE Disable = Switch_Disable;
+	typedef void (CODEGEN_FUNCPTR *PFNDRAWBUFFER)(GLenum);
+	static void CODEGEN_FUNCPTR Switch_DrawBuffer(GLenum a0)
+	{
 		DrawBuffer = reinterpret_cast<PFNDRAWBUFFER>(IntGetProcAddress("glDrawBuffer"));
-		if(!DrawBuffer) ++numFailed;
+		return DrawBuffer(a0);
+	}
+	PFNDRAWBUFFER DrawBuffer = Switch_DrawBuffer;
+	typedef void (CODEGEN_FUNCPTR *PFNENABLE)(GLenum);
+	static void CODEGEN_FUNCPTR Switch_Enable(GLenum a0)
+	{
 		Enable = reinterpret_cast<PFNENABLE>(IntGetProcAddress("glEnable"));
-		if(!Enable) ++numFailed;
+		return Enable(a0);
+	}
+	PFNENABLE Enable = Switch_Enable;
+	typedef void (CODEGEN_FUNCPTR *PFNFINISH)(void);
+	static void CODEGEN_FUNCPTR Switch_Finish(void)
+	{
 		Finish = reinterpret_cast<PFNFINISH>(IntGetProcAddress("glFinish"));
-		if(!Finish) ++numFailed;
+		return Finish();
+	}
+	PFNFINISH Finish = Switch_Finish;
+	typedef void (CODEGEN_FUNCPTR *PFNFLUSH)(void);
+	static void CODEGEN_FUNCPTR Switch_Flush(void)
+	{
 		Flush = reinterpret_cast<PFNFLUSH>(IntGetProcAddress("glFlush"));
-		if(!Flush) ++numFailed;
+		return Flush();
+	}
+	PFNFLUSH Flush = Switch_Flush;
+	typedef void (CODEGEN_FUNCPTR *PFNFRONTFACE)(GLenum);
+	static void CODEGEN_FUNCPTR Switch_FrontFace(GLenum a0)
+	{
 		FrontFace = reinterpret_cast<PFNFRONTFACE>(IntGetProcAddress("glFrontFace"));
-		if(!FrontFace) ++numFailed;
+		return FrontFace(a0);
+	}
+	PFNFRONTFACE FrontFace = Switch_FrontFace;
+	typedef void (CODEGEN_FUNCPTR *PFNGETBOOLEANV)(GLenum, GLboolean *);
+	static void CODEGEN_FUNCPTR Switch_GetBooleanv(GLenum a0, GLboolean *a1)
+	{
 		GetBooleanv = reinterpret_cast<PFNGETBOOLEANV>(IntGetProcAddress("glGetBooleanv"));
-		if(!GetBooleanv) ++numFailed;
+		return GetBooleanv(a0, a1);
+	}
+	PFNGETBOOLEANV GetBooleanv = Switch_GetBooleanv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETDOUBLEV)(GLenum, GLdouble *);
+	static void CODEGEN_FUNCPTR Switch_GetDoublev(GLenum a0, GLdouble *a1)
+	{
 		GetDoublev = reinterpret_cast<PFNGETDOUBLEV>(IntGetProcAddress("glGetDoublev"));
-		if(!GetDoublev) ++numFailed;
+		return GetDoublev(a0, a1);
+	}
+	PFNGETDOUBLEV GetDoublev = Switch_GetDoublev;
+	typedef GLenum (CODEGEN_FUNCPTR *PFNGETERROR)(void);
+	static GLenum CODEGEN_FUNCPTR Switch_GetError(void)
+	{
 		GetError = reinterpret_cast<PFNGETERROR>(IntGetProcAddress("glGetError"));
-		if(!GetError) ++numFailed;
+		return GetError();
+	}
+	PFNGETERROR GetError = Switch_GetError;
+	typedef void (CODEGEN_FUNCPTR *PFNGETFLOATV)(GLenum, GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_GetFloatv(GLenum a0, GLfloat *a1)
+	{
 		GetFloatv = reinterpret_cast<PFNGETFLOATV>(IntGetProcAddress("glGetFloatv"));
-		if(!GetFloatv) ++numFailed;
+		return GetFloatv(a0, a1);
+	}
+	PFNGETFLOATV GetFloatv = Switch_GetFloatv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETINTEGERV)(GLenum, GLint *);
+	static void CODEGEN_FUNCPTR Switch_GetIntegerv(GLenum a0, GLint *a1)
+	{
 		GetIntegerv = reinterpret_cast<PFNGETINTEGERV>(IntGetProcAddress("glGetIntegerv"));
-		if(!GetIntegerv) ++numFailed;
+		return GetIntegerv(a0, a1);
+	}
+	PFNGETINTEGERV GetIntegerv = Switch_GetIntegerv;
+	typedef const GLubyte * (CODEGEN_FUNCPTR *PFNGETSTRING)(GLenum);
+	static const GLubyte * CODEGEN_FUNCPTR Switch_GetString(GLenum a0)
+	{
 		GetString = reinterpret_cast<PFNGETSTRING>(IntGetProcAddress("glGetString"));
-		if(!GetString) ++numFailed;
+		return GetString(a0);
+	}
+	PFNGETSTRING GetString = Switch_GetString;
+	typedef void (CODEGEN_FUNCPTR *PFNGETTEXIMAGE)(GLenum, GLint, GLenum, GLenum, void *);
+	static void CODEGEN_FUNCPTR Switch_GetTexImage(GLenum a0, GLint a1, GLenum a2, GLenum a3, void *a4)
+	{
 		GetTexImage = reinterpret_cast<PFNGETTEXIMAGE>(IntGetProcAddress("glGetTexImage"));
-		if(!GetTexImage) ++numFailed;
+		return GetTexImage(a0, a1, a2, a3, a4);
+	}
+	PFNGETTEXIMAGE GetTexImage = Switch_GetTexImage;
+	typedef void (CODEGEN_FUNCPTR *PFNGETTEXLEVELPARAMETERFV)(GLenum, GLint, GLenum, GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_GetTexLevelParameterfv(GLenum a0, GLint a1, GLenum a2, GLfloat *a3)
+	{
 		GetTexLevelParameterfv = reinterpret_cast<PFNGETTEXLEVELPARAMETERFV>(IntGetProcAddress("glGetTexLevelParameterfv"));
-		if(!GetTexLevelParameterfv) ++numFailed;
+		return GetTexLevelParameterfv(a0, a1, a2, a3);
+	}
+	PFNGETTEXLEVELPARAMETERFV GetTexLevelParameterfv = Switch_GetTexLevelParameterfv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETTEXLEVELPARAMETERIV)(GLenum, GLint, GLenum, GLint *);
+	static void CODEGEN_FUNCPTR Switch_GetTexLevelParameteriv(GLenum a0, GLint a1, GLenum a2, GLint *a3)
+	{
 		GetTexLevelParameteriv = reinterpret_cast<PFNGETTEXLEVELPARAMETERIV>(IntGetProcAddress("glGetTexLevelParameteriv"));
-		if(!GetTexLevelParameteriv) ++numFailed;
+		return GetTexLevelParameteriv(a0, a1, a2, a3);
+	}
+	PFNGETTEXLEVELPARAMETERIV GetTexLevelParameteriv = Switch_GetTexLevelParameteriv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETTEXPARAMETERFV)(GLenum, GLenum, GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_GetTexParameterfv(GLenum a0, GLenum a1, GLfloat *a2)
+	{
 		GetTexParameterfv = reinterpret_cast<PFNGETTEXPARAMETERFV>(IntGetProcAddress("glGetTexParameterfv"));
-		if(!GetTexParameterfv) ++numFailed;
+		return GetTexParameterfv(a0, a1, a2);
+	}
+	PFNGETTEXPARAMETERFV GetTexParameterfv = Switch_GetTexParameterfv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETTEXPARAMETERIV)(GLenum, GLenum, GLint *);
+	static void CODEGEN_FUNCPTR Switch_GetTexParameteriv(GLenum a0, GLenum a1, GLint *a2)
+	{
 		GetTexParameteriv = reinterpret_cast<PFNGETTEXPARAMETERIV>(IntGetProcAddress("glGetTexParameteriv"));
-		if(!GetTexParameteriv) ++numFailed;
+		return GetTexParameteriv(a0, a1, a2);
+	}
+	PFNGETTEXPARAMETERIV GetTexParameteriv = Switch_GetTexParameteriv;
+	typedef void (CODEGEN_FUNCPTR *PFNHINT)(GLenum, GLenum);
+	static void CODEGEN_FUNCPTR Switch_Hint(GLenum a0, GLenum a1)
+	{
 		Hint = reinterpret_cast<PFNHINT>(IntGetProcAddress("glHint"));
-		if(!Hint) ++numFailed;
+		return Hint(a0, a1);
+	}
+	PFNHINT Hint = Switch_Hint;
+	typedef GLboolean (CODEGEN_FUNCPTR *PFNISENABLED)(GLenum);
+	static GLboolean CODEGEN_FUNCPTR Switch_IsEnabled(GLenum a0)
+	{
 		IsEnabled = reinterpret_cast<PFNISENABLED>(IntGetProcAddress("glIsEnabled"));
-		if(!IsEnabled) ++numFailed;
+		return IsEnabled(a0);
+	}
+	PFNISENABLED IsEnabled = Switch_IsEnabled;
+	typedef void (CODEGEN_FUNCPTR *PFNLINEWIDTH)(GLfloat);
+	static void CODEGEN_FUNCPTR Switch_LineWidth(GLfloat a0)
+	{
 		LineWidth = reinterpret_cast<PFNLINEWIDTH>(IntGetProcAddress("glLineWidth"));
-		if(!LineWidth) ++numFailed;
+		return LineWidth(a0);
+	}
+	PFNLINEWIDTH LineWidth = Switch_LineWidth;
+	typedef void (CODEGEN_FUNCPTR *PFNLOGICOP)(GLenum);
+	static void CODEGEN_FUNCPTR Switch_LogicOp(GLenum a0)
+	{
 		LogicOp = reinterpret_cast<PFNLOGICOP>(IntGetProcAddress("glLogicOp"));
-		if(!LogicOp) ++numFailed;
+		return LogicOp(a0);
+	}
+	PFNLOGICOP LogicOp = Switch_LogicOp;
+	typedef void (CODEGEN_FUNCPTR *PFNPIXELSTOREF)(GLenum, GLfloat);
+	static void CODEGEN_FUNCPTR Switch_PixelStoref(GLenum a0, GLfloat a1)
+	{
 		PixelStoref = reinterpret_cast<PFNPIXELSTOREF>(IntGetProcAddress("glPixelStoref"));
-		if(!PixelStoref) ++numFailed;
+		return PixelStoref(a0, a1);
+	}
+	PFNPIXELSTOREF PixelStoref = Switch_PixelStoref;
+	typedef void (CODEGEN_FUNCPTR *PFNPIXELSTOREI)(GLenum, GLint);
+	static void CODEGEN_FUNCPTR Switch_PixelStorei(GLenum a0, GLint a1)
+	{
 		PixelStorei = reinterpret_cast<PFNPIXELSTOREI>(IntGetProcAddress("glPixelStorei"));
-		if(!PixelStorei) ++numFailed;
+		return PixelStorei(a0, a1);
+	}
+	PFNPIXELSTOREI PixelStorei = Switch_PixelStorei;
+	typedef void (CODEGEN_FUNCPTR *PFNPOINTSIZE)(GLfloat);
+	static void CODEGEN_FUNCPTR Switch_PointSize(GLfloat a0)
+	{
 		PointSize = reinterpret_cast<PFNPOINTSIZE>(IntGetProcAddress("glPointSize"));
-		if(!PointSize) ++numFailed;
+		return PointSize(a0);
+	}
+	PFNPOINTSIZE PointSize = Switch_PointSize;
+	typedef void (CODEGEN_FUNCPTR *PFNPOLYGONMODE)(GLenum, GLenum);
+	static void CODEGEN_FUNCPTR Switch_PolygonMode(GLenum a0, GLenum a1)
+	{
 		PolygonMode = reinterpret_cast<PFNPOLYGONMODE>(IntGetProcAddress("glPolygonMode"));
-		if(!PolygonMode) ++numFailed;
+		return PolygonMode(a0, a1);
+	}
+	PFNPOLYGONMODE PolygonMode = Switch_PolygonMode;
+	typedef void (CODEGEN_FUNCPTR *PFNREADBUFFER)(GLenum);
+	static void CODEGEN_FUNCPTR Switch_ReadBuffer(GLenum a0)
+	{
 		ReadBuffer = reinterpret_cast<PFNREADBUFFER>(IntGetProcAddress("glReadBuffer"));
-		if(!ReadBuffer) ++numFailed;
+		return ReadBuffer(a0);
+	}
+	PFNREADBUFFER ReadBuffer = Switch_ReadBuffer;
+	typedef void (CODEGEN_FUNCPTR *PFNREADPIXELS)(GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, void *);
+	static void CODEGEN_FUNCPTR Switch_ReadPixels(GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, void *a6)
+	{
 		ReadPixels = reinterpret_cast<PFNREADPIXELS>(IntGetProcAddress("glReadPixels"));
-		if(!ReadPixels) ++numFailed;
+		return ReadPixels(a0, a1, a2, a3, a4, a5, a6);
+	}
+	PFNREADPIXELS ReadPixels = Switch_ReadPixels;
+	typedef void (CODEGEN_FUNCPTR *PFNSCISSOR)(GLint, GLint, GLsizei, GLsizei);
+	static void CODEGEN_FUNCPTR Switch_Scissor(GLint a0, GLint a1, GLsizei a2, GLsizei a3)
+	{
 		Scissor = reinterpret_cast<PFNSCISSOR>(IntGetProcAddress("glScissor"));
-		if(!Scissor) ++numFailed;
+		return Scissor(a0, a1, a2, a3);
+	}
+	PFNSCISSOR Scissor = Switch_Scissor;
+	typedef void (CODEGEN_FUNCPTR *PFNSTENCILFUNC)(GLenum, GLint, GLuint);
+	static void CODEGEN_FUNCPTR Switch_StencilFunc(GLenum a0, GLint a1, GLuint a2)
+	{
 		StencilFunc = reinterpret_cast<PFNSTENCILFUNC>(IntGetProcAddress("glStencilFunc"));
-		if(!StencilFunc) ++numFailed;
+		return StencilFunc(a0, a1, a2);
+	}
+	PFNSTENCILFUNC StencilFunc = Switch_StencilFunc;
+	typedef void (CODEGEN_FUNCPTR *PFNSTENCILMASK)(GLuint);
+	static void CODEGEN_FUNCPTR Switch_StencilMask(GLuint a0)
+	{
 		StencilMask = reinterpret_cast<PFNSTENCILMASK>(IntGetProcAddress("glStencilMask"));
-		if(!StencilMask) ++numFailed;
+		return StencilMask(a0);
+	}
+	PFNSTENCILMASK StencilMask = Switch_StencilMask;
+	typedef void (CODEGEN_FUNCPTR *PFNSTENCILOP)(GLenum, GLenum, GLenum);
+	static void CODEGEN_FUNCPTR Switch_StencilOp(GLenum a0, GLenum a1, GLenum a2)
+	{
 		StencilOp = reinterpret_cast<PFNSTENCILOP>(IntGetProcAddress("glStencilOp"));
-		if(!StencilOp) ++numFailed;
+		return StencilOp(a0, a1, a2);
+	}
+	PFNSTENCILOP StencilOp = Switch_StencilOp;
+	typedef void (CODEGEN_FUNCPTR *PFNTEXIMAGE1D)(GLenum, GLint, GLint, GLsizei, GLint, GLenum, GLenum, const void *);
+	static void CODEGEN_FUNCPTR Switch_TexImage1D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLint a4, GLenum a5, GLenum a6, const void *a7)
+	{
 		TexImage1D = reinterpret_cast<PFNTEXIMAGE1D>(IntGetProcAddress("glTexImage1D"));
-		if(!TexImage1D) ++numFailed;
+		return TexImage1D(a0, a1, a2, a3, a4, a5, a6, a7);
+	}
+	PFNTEXIMAGE1D TexImage1D = Switch_TexImage1D;
+	typedef void (CODEGEN_FUNCPTR *PFNTEXIMAGE2D)(GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum, const void *);
+	static void CODEGEN_FUNCPTR Switch_TexImage2D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4, GLint a5, GLenum a6, GLenum a7, const void *a8)
+	{
 		TexImage2D = reinterpret_cast<PFNTEXIMAGE2D>(IntGetProcAddress("glTexImage2D"));
-		if(!TexImage2D) ++numFailed;
+		return TexImage2D(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+	}
+	PFNTEXIMAGE2D TexImage2D = Switch_TexImage2D;
+	typedef void (CODEGEN_FUNCPTR *PFNTEXPARAMETERF)(GLenum, GLenum, GLfloat);
+	static void CODEGEN_FUNCPTR Switch_TexParameterf(GLenum a0, GLenum a1, GLfloat a2)
+	{
 		TexParameterf = reinterpret_cast<PFNTEXPARAMETERF>(IntGetProcAddress("glTexParameterf"));
-		if(!TexParameterf) ++numFailed;
+		return TexParameterf(a0, a1, a2);
+	}
+	PFNTEXPARAMETERF TexParameterf = Switch_TexParameterf;
+	typedef void (CODEGEN_FUNCPTR *PFNTEXPARAMETERFV)(GLenum, GLenum, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_TexParameterfv(GLenum a0, GLenum a1, const GLfloat *a2)
+	{
 		TexParameterfv = reinterpret_cast<PFNTEXPARAMETERFV>(IntGetProcAddress("glTexParameterfv"));
-		if(!TexParameterfv) ++numFailed;
+		return TexParameterfv(a0, a1, a2);
+	}
+	PFNTEXPARAMETERFV TexParameterfv = Switch_TexParameterfv;
+	typedef void (CODEGEN_FUNCPTR *PFNTEXPARAMETERI)(GLenum, GLenum, GLint);
+	static void CODEGEN_FUNCPTR Switch_TexParameteri(GLenum a0, GLenum a1, GLint a2)
+	{
 		TexParameteri = reinterpret_cast<PFNTEXPARAMETERI>(IntGetProcAddress("glTexParameteri"));
-		if(!TexParameteri) ++numFailed;
+		return TexParameteri(a0, a1, a2);
+	}
+	PFNTEXPARAMETERI TexParameteri = Switch_TexParameteri;
+	typedef void (CODEGEN_FUNCPTR *PFNTEXPARAMETERIV)(GLenum, GLenum, const GLint *);
+	static void CODEGEN_FUNCPTR Switch_TexParameteriv(GLenum a0, GLenum a1, const GLint *a2)
+	{
 		TexParameteriv = reinterpret_cast<PFNTEXPARAMETERIV>(IntGetProcAddress("glTexParameteriv"));
-		if(!TexParameteriv) ++numFailed;
+		return TexParameteriv(a0, a1, a2);
+	}
+	PFNTEXPARAMETERIV TexParameteriv = Switch_TexParameteriv;
+	typedef void (CODEGEN_FUNCPTR *PFNVIEWPORT)(GLint, GLint, GLsizei, GLsizei);
+	static void CODEGEN_FUNCPTR Switch_Viewport(GLint a0, GLint a1, GLsizei a2, GLsizei a3)
+	{
 		Viewport = reinterpret_cast<PFNVIEWPORT>(IntGetProcAddress("glViewport"));
-		if(!Viewport) ++numFailed;
+		return Viewport(a0, a1, a2, a3);
+	}
+	PFNVIEWPORT Viewport = Switch_Viewport;
+	
+	typedef void (CODEGEN_FUNCPTR *PFNBINDTEXTURE)(GLenum, GLuint);
+	static void CODEGEN_FUNCPTR Switch_BindTexture(GLenum a0, GLuint a1)
+	{
 		BindTexture = reinterpret_cast<PFNBINDTEXTURE>(IntGetProcAddress("glBindTexture"));
-		if(!BindTexture) ++numFailed;
+		return BindTexture(a0, a1);
+	}
+	PFNBINDTEXTURE BindTexture = Switch_BindTexture;
+	typedef void (CODEGEN_FUNCPTR *PFNCOPYTEXIMAGE1D)(GLenum, GLint, GLenum, GLint, GLint, GLsizei, GLint);
+	static void CODEGEN_FUNCPTR Switch_CopyTexImage1D(GLenum a0, GLint a1, GLenum a2, GLint a3, GLint a4, GLsizei a5, GLint a6)
+	{
 		CopyTexImage1D = reinterpret_cast<PFNCOPYTEXIMAGE1D>(IntGetProcAddress("glCopyTexImage1D"));
-		if(!CopyTexImage1D) ++numFailed;
+		return CopyTexImage1D(a0, a1, a2, a3, a4, a5, a6);
+	}
+	PFNCOPYTEXIMAGE1D CopyTexImage1D = Switch_CopyTexImage1D;
+	typedef void (CODEGEN_FUNCPTR *PFNCOPYTEXIMAGE2D)(GLenum, GLint, GLenum, GLint, GLint, GLsizei, GLsizei, GLint);
+	static void CODEGEN_FUNCPTR Switch_CopyTexImage2D(GLenum a0, GLint a1, GLenum a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLint a7)
+	{
 		CopyTexImage2D = reinterpret_cast<PFNCOPYTEXIMAGE2D>(IntGetProcAddress("glCopyTexImage2D"));
-		if(!CopyTexImage2D) ++numFailed;
+		return CopyTexImage2D(a0, a1, a2, a3, a4, a5, a6, a7);
+	}
+	PFNCOPYTEXIMAGE2D CopyTexImage2D = Switch_CopyTexImage2D;
+	typedef void (CODEGEN_FUNCPTR *PFNCOPYTEXSUBIMAGE1D)(GLenum, GLint, GLint, GLint, GLint, GLsizei);
+	static void CODEGEN_FUNCPTR Switch_CopyTexSubImage1D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5)
+	{
 		CopyTexSubImage1D = reinterpret_cast<PFNCOPYTEXSUBIMAGE1D>(IntGetProcAddress("glCopyTexSubImage1D"));
-		if(!CopyTexSubImage1D) ++numFailed;
+		return CopyTexSubImage1D(a0, a1, a2, a3, a4, a5);
+	}
+	PFNCOPYTEXSUBIMAGE1D CopyTexSubImage1D = Switch_CopyTexSubImage1D;
+	typedef void (CODEGEN_FUNCPTR *PFNCOPYTEXSUBIMAGE2D)(GLenum, GLint, GLint, GLint, GLint, GLint, GLsizei, GLsizei);
+	static void CODEGEN_FUNCPTR Switch_CopyTexSubImage2D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7)
+	{
 		CopyTexSubImage2D = reinterpret_cast<PFNCOPYTEXSUBIMAGE2D>(IntGetProcAddress("glCopyTexSubImage2D"));
-		if(!CopyTexSubImage2D) ++numFailed;
+		return CopyTexSubImage2D(a0, a1, a2, a3, a4, a5, a6, a7);
+	}
+	PFNCOPYTEXSUBIMAGE2D CopyTexSubImage2D = Switch_CopyTexSubImage2D;
+	typedef void (CODEGEN_FUNCPTR *PFNDELETETEXTURES)(GLsizei, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_DeleteTextures(GLsizei a0, const GLuint *a1)
+	{
 		DeleteTextures = reinterpret_cast<PFNDELETETEXTURES>(IntGetProcAddress("glDeleteTextures"));
-		if(!DeleteTextures) ++numFailed;
+		return DeleteTextures(a0, a1);
+	}
+	PFNDELETETEXTURES DeleteTextures = Switch_DeleteTextures;
+	typedef void (CODEGEN_FUNCPTR *PFNDRAWARRAYS)(GLenum, GLint, GLsizei);
+	static void CODEGEN_FUNCPTR Switch_DrawArrays(GLenum a0, GLint a1, GLsizei a2)
+	{
 		DrawArrays = reinterpret_cast<PFNDRAWARRAYS>(IntGetProcAddress("glDrawArrays"));
-		if(!DrawArrays) ++numFailed;
+		return DrawArrays(a0, a1, a2);
+	}
+	PFNDRAWARRAYS DrawArrays = Switch_DrawArrays;
+	typedef void (CODEGEN_FUNCPTR *PFNDRAWELEMENTS)(GLenum, GLsizei, GLenum, const void *);
+	static void CODEGEN_FUNCPTR Switch_DrawElements(GLenum a0, GLsizei a1, GLenum a2, const void *a3)
+	{
 		DrawElements = reinterpret_cast<PFNDRAWELEMENTS>(IntGetProcAddress("glDrawElements"));
-		if(!DrawElements) ++numFailed;
+		return DrawElements(a0, a1, a2, a3);
+	}
+	PFNDRAWELEMENTS DrawElements = Switch_DrawElements;
+	typedef void (CODEGEN_FUNCPTR *PFNGENTEXTURES)(GLsizei, GLuint *);
+	static void CODEGEN_FUNCPTR Switch_GenTextures(GLsizei a0, GLuint *a1)
+	{
 		GenTextures = reinterpret_cast<PFNGENTEXTURES>(IntGetProcAddress("glGenTextures"));
-		if(!GenTextures) ++numFailed;
+		return GenTextures(a0, a1);
+	}
+	PFNGENTEXTURES GenTextures = Switch_GenTextures;
+	typedef GLboolean (CODEGEN_FUNCPTR *PFNISTEXTURE)(GLuint);
+	static GLboolean CODEGEN_FUNCPTR Switch_IsTexture(GLuint a0)
+	{
 		IsTexture = reinterpret_cast<PFNISTEXTURE>(IntGetProcAddress("glIsTexture"));
-		if(!IsTexture) ++numFailed;
+		return IsTexture(a0);
+	}
+	PFNISTEXTURE IsTexture = Switch_IsTexture;
+	typedef void (CODEGEN_FUNCPTR *PFNPOLYGONOFFSET)(GLfloat, GLfloat);
+	static void CODEGEN_FUNCPTR Switch_PolygonOffset(GLfloat a0, GLfloat a1)
+	{
 		PolygonOffset = reinterpret_cast<PFNPOLYGONOFFSET>(IntGetProcAddress("glPolygonOffset"));
-		if(!PolygonOffset) ++numFailed;
+		return PolygonOffset(a0, a1);
+	}
+	PFNPOLYGONOFFSET PolygonOffset = Switch_PolygonOffset;
+	typedef void (CODEGEN_FUNCPTR *PFNTEXSUBIMAGE1D)(GLenum, GLint, GLint, GLsizei, GLenum, GLenum, const void *);
+	static void CODEGEN_FUNCPTR Switch_TexSubImage1D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLenum a5, const void *a6)
+	{
 		TexSubImage1D = reinterpret_cast<PFNTEXSUBIMAGE1D>(IntGetProcAddress("glTexSubImage1D"));
-		if(!TexSubImage1D) ++numFailed;
+		return TexSubImage1D(a0, a1, a2, a3, a4, a5, a6);
+	}
+	PFNTEXSUBIMAGE1D TexSubImage1D = Switch_TexSubImage1D;
+	typedef void (CODEGEN_FUNCPTR *PFNTEXSUBIMAGE2D)(GLenum, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, const void *);
+	static void CODEGEN_FUNCPTR Switch_TexSubImage2D(GLenum a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLenum a7, const void *a8)
+	{
 		TexSubImage2D = reinterpret_cast<PFNTEXSUBIMAGE2D>(IntGetProcAddress("glTexSubImage2D"));
-		if(!TexSubImage2D) ++numFailed;
+		return TexSubImage2D(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+	}
+	PFNTEXSUBIMAGE2D TexSubImage2D = Switch_TexSubImage2D;
+	
+	typedef void (CODEGEN_FUNCPTR *PFNCOPYTEXSUBIMAGE3D)(GLenum, GLint, GLint, GLint, GLint, GLint, GLint, GLsizei, GLsizei);
+	static void CODEGEN_FUNCPTR Switch_CopyTexSubImage3D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8)
+	{
 		CopyTexSubImage3D = reinterpret_cast<PFNCOPYTEXSUBIMAGE3D>(IntGetProcAddress("glCopyTexSubImage3D"));
-		if(!CopyTexSubImage3D) ++numFailed;
+		return CopyTexSubImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+	}
+	PFNCOPYTEXSUBIMAGE3D CopyTexSubImage3D = Switch_CopyTexSubImage3D;
+	typedef void (CODEGEN_FUNCPTR *PFNDRAWRANGEELEMENTS)(GLenum, GLuint, GLuint, GLsizei, GLenum, const void *);
+	static void CODEGEN_FUNCPTR Switch_DrawRangeElements(GLenum a0, GLuint a1, GLuint a2, GLsizei a3, GLenum a4, const void *a5)
+	{
 		DrawRangeElements = reinterpret_cast<PFNDRAWRANGEELEMENTS>(IntGetProcAddress("glDrawRangeElements"));
-		if(!DrawRangeElements) ++numFailed;
+		return DrawRangeElements(a0, a1, a2, a3, a4, a5);
+	}
+	PFNDRAWRANGEELEMENTS DrawRangeElements = Switch_DrawRangeElements;
+	typedef void (CODEGEN_FUNCPTR *PFNTEXIMAGE3D)(GLenum, GLint, GLint, GLsizei, GLsizei, GLsizei, GLint, GLenum, GLenum, const void *);
+	static void CODEGEN_FUNCPTR Switch_TexImage3D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLenum a7, GLenum a8, const void *a9)
+	{
 		TexImage3D = reinterpret_cast<PFNTEXIMAGE3D>(IntGetProcAddress("glTexImage3D"));
-		if(!TexImage3D) ++numFailed;
+		return TexImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+	}
+	PFNTEXIMAGE3D TexImage3D = Switch_TexImage3D;
+	typedef void (CODEGEN_FUNCPTR *PFNTEXSUBIMAGE3D)(GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLenum, const void *);
+	static void CODEGEN_FUNCPTR Switch_TexSubImage3D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void *a10)
+	{
 		TexSubImage3D = reinterpret_cast<PFNTEXSUBIMAGE3D>(IntGetProcAddress("glTexSubImage3D"));
-		if(!TexSubImage3D) ++numFailed;
+		return TexSubImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+	}
+	PFNTEXSUBIMAGE3D TexSubImage3D = Switch_TexSubImage3D;
+	
+	typedef void (CODEGEN_FUNCPTR *PFNACTIVETEXTURE)(GLenum);
+	static void CODEGEN_FUNCPTR Switch_ActiveTexture(GLenum a0)
+	{
 		ActiveTexture = reinterpret_cast<PFNACTIVETEXTURE>(IntGetProcAddress("glActiveTexture"));
-		if(!ActiveTexture) ++numFailed;
+		return ActiveTexture(a0);
+	}
+	PFNACTIVETEXTURE ActiveTexture = Switch_ActiveTexture;
+	typedef void (CODEGEN_FUNCPTR *PFNCOMPRESSEDTEXIMAGE1D)(GLenum, GLint, GLenum, GLsizei, GLint, GLsizei, const void *);
+	static void CODEGEN_FUNCPTR Switch_CompressedTexImage1D(GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLint a4, GLsizei a5, const void *a6)
+	{
 		CompressedTexImage1D = reinterpret_cast<PFNCOMPRESSEDTEXIMAGE1D>(IntGetProcAddress("glCompressedTexImage1D"));
-		if(!CompressedTexImage1D) ++numFailed;
+		return CompressedTexImage1D(a0, a1, a2, a3, a4, a5, a6);
+	}
+	PFNCOMPRESSEDTEXIMAGE1D CompressedTexImage1D = Switch_CompressedTexImage1D;
+	typedef void (CODEGEN_FUNCPTR *PFNCOMPRESSEDTEXIMAGE2D)(GLenum, GLint, GLenum, GLsizei, GLsizei, GLint, GLsizei, const void *);
+	static void CODEGEN_FUNCPTR Switch_CompressedTexImage2D(GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLint a5, GLsizei a6, const void *a7)
+	{
 		CompressedTexImage2D = reinterpret_cast<PFNCOMPRESSEDTEXIMAGE2D>(IntGetProcAddress("glCompressedTexImage2D"));
-		if(!CompressedTexImage2D) ++numFailed;
+		return CompressedTexImage2D(a0, a1, a2, a3, a4, a5, a6, a7);
+	}
+	PFNCOMPRESSEDTEXIMAGE2D CompressedTexImage2D = Switch_CompressedTexImage2D;
+	typedef void (CODEGEN_FUNCPTR *PFNCOMPRESSEDTEXIMAGE3D)(GLenum, GLint, GLenum, GLsizei, GLsizei, GLsizei, GLint, GLsizei, const void *);
+	static void CODEGEN_FUNCPTR Switch_CompressedTexImage3D(GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLsizei a7, const void *a8)
+	{
 		CompressedTexImage3D = reinterpret_cast<PFNCOMPRESSEDTEXIMAGE3D>(IntGetProcAddress("glCompressedTexImage3D"));
-		if(!CompressedTexImage3D) ++numFailed;
+		return CompressedTexImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+	}
+	PFNCOMPRESSEDTEXIMAGE3D CompressedTexImage3D = Switch_CompressedTexImage3D;
+	typedef void (CODEGEN_FUNCPTR *PFNCOMPRESSEDTEXSUBIMAGE1D)(GLenum, GLint, GLint, GLsizei, GLenum, GLsizei, const void *);
+	static void CODEGEN_FUNCPTR Switch_CompressedTexSubImage1D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLsizei a5, const void *a6)
+	{
 		CompressedTexSubImage1D = reinterpret_cast<PFNCOMPRESSEDTEXSUBIMAGE1D>(IntGetProcAddress("glCompressedTexSubImage1D"));
-		if(!CompressedTexSubImage1D) ++numFailed;
+		return CompressedTexSubImage1D(a0, a1, a2, a3, a4, a5, a6);
+	}
+	PFNCOMPRESSEDTEXSUBIMAGE1D CompressedTexSubImage1D = Switch_CompressedTexSubImage1D;
+	typedef void (CODEGEN_FUNCPTR *PFNCOMPRESSEDTEXSUBIMAGE2D)(GLenum, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLsizei, const void *);
+	static void CODEGEN_FUNCPTR Switch_CompressedTexSubImage2D(GLenum a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLsizei a7, const void *a8)
+	{
 		CompressedTexSubImage2D = reinterpret_cast<PFNCOMPRESSEDTEXSUBIMAGE2D>(IntGetProcAddress("glCompressedTexSubImage2D"));
-		if(!CompressedTexSubImage2D) ++numFailed;
+		return CompressedTexSubImage2D(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+	}
+	PFNCOMPRESSEDTEXSUBIMAGE2D CompressedTexSubImage2D = Switch_CompressedTexSubImage2D;
+	typedef void (CODEGEN_FUNCPTR *PFNCOMPRESSEDTEXSUBIMAGE3D)(GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLsizei, const void *);
+	static void CODEGEN_FUNCPTR Switch_CompressedTexSubImage3D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLsizei a9, const void *a10)
+	{
 		CompressedTexSubImage3D = reinterpret_cast<PFNCOMPRESSEDTEXSUBIMAGE3D>(IntGetProcAddress("glCompressedTexSubImage3D"));
-		if(!CompressedTexSubImage3D) ++numFailed;
+		return CompressedTexSubImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+	}
+	PFNCOMPRESSEDTEXSUBIMAGE3D CompressedTexSubImage3D = Switch_CompressedTexSubImage3D;
+	typedef void (CODEGEN_FUNCPTR *PFNGETCOMPRESSEDTEXIMAGE)(GLenum, GLint, void *);
+	static void CODEGEN_FUNCPTR Switch_GetCompressedTexImage(GLenum a0, GLint a1, void *a2)
+	{
 		GetCompressedTexImage = reinterpret_cast<PFNGETCOMPRESSEDTEXIMAGE>(IntGetProcAddress("glGetCompressedTexImage"));
-		if(!GetCompressedTexImage) ++numFailed;
+		return GetCompressedTexImage(a0, a1, a2);
+	}
+	PFNGETCOMPRESSEDTEXIMAGE GetCompressedTexImage = Switch_GetCompressedTexImage;
+	typedef void (CODEGEN_FUNCPTR *PFNSAMPLECOVERAGE)(GLfloat, GLboolean);
+	static void CODEGEN_FUNCPTR Switch_SampleCoverage(GLfloat a0, GLboolean a1)
+	{
 		SampleCoverage = reinterpret_cast<PFNSAMPLECOVERAGE>(IntGetProcAddress("glSampleCoverage"));
-		if(!SampleCoverage) ++numFailed;
+		return SampleCoverage(a0, a1);
+	}
+	PFNSAMPLECOVERAGE SampleCoverage = Switch_SampleCoverage;
+	
+	typedef void (CODEGEN_FUNCPTR *PFNBLENDFUNCSEPARATE)(GLenum, GLenum, GLenum, GLenum);
+	static void CODEGEN_FUNCPTR Switch_BlendFuncSeparate(GLenum a0, GLenum a1, GLenum a2, GLenum a3)
+	{
 		BlendFuncSeparate = reinterpret_cast<PFNBLENDFUNCSEPARATE>(IntGetProcAddress("glBlendFuncSeparate"));
-		if(!BlendFuncSeparate) ++numFailed;
+		return BlendFuncSeparate(a0, a1, a2, a3);
+	}
+	PFNBLENDFUNCSEPARATE BlendFuncSeparate = Switch_BlendFuncSeparate;
+	typedef void (CODEGEN_FUNCPTR *PFNMULTIDRAWARRAYS)(GLenum, const GLint *, const GLsizei *, GLsizei);
+	static void CODEGEN_FUNCPTR Switch_MultiDrawArrays(GLenum a0, const GLint *a1, const GLsizei *a2, GLsizei a3)
+	{
 		MultiDrawArrays = reinterpret_cast<PFNMULTIDRAWARRAYS>(IntGetProcAddress("glMultiDrawArrays"));
-		if(!MultiDrawArrays) ++numFailed;
+		return MultiDrawArrays(a0, a1, a2, a3);
+	}
+	PFNMULTIDRAWARRAYS MultiDrawArrays = Switch_MultiDrawArrays;
+	typedef void (CODEGEN_FUNCPTR *PFNMULTIDRAWELEMENTS)(GLenum, const GLsizei *, GLenum, const void *const*, GLsizei);
+	static void CODEGEN_FUNCPTR Switch_MultiDrawElements(GLenum a0, const GLsizei *a1, GLenum a2, const void *const*a3, GLsizei a4)
+	{
 		MultiDrawElements = reinterpret_cast<PFNMULTIDRAWELEMENTS>(IntGetProcAddress("glMultiDrawElements"));
-		if(!MultiDrawElements) ++numFailed;
+		return MultiDrawElements(a0, a1, a2, a3, a4);
+	}
+	PFNMULTIDRAWELEMENTS MultiDrawElements = Switch_MultiDrawElements;
+	typedef void (CODEGEN_FUNCPTR *PFNPOINTPARAMETERF)(GLenum, GLfloat);
+	static void CODEGEN_FUNCPTR Switch_PointParameterf(GLenum a0, GLfloat a1)
+	{
 		PointParameterf = reinterpret_cast<PFNPOINTPARAMETERF>(IntGetProcAddress("glPointParameterf"));
-		if(!PointParameterf) ++numFailed;
+		return PointParameterf(a0, a1);
+	}
+	PFNPOINTPARAMETERF PointParameterf = Switch_PointParameterf;
+	typedef void (CODEGEN_FUNCPTR *PFNPOINTPARAMETERFV)(GLenum, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_PointParameterfv(GLenum a0, const GLfloat *a1)
+	{
 		PointParameterfv = reinterpret_cast<PFNPOINTPARAMETERFV>(IntGetProcAddress("glPointParameterfv"));
-		if(!PointParameterfv) ++numFailed;
+		return PointParameterfv(a0, a1);
+	}
+	PFNPOINTPARAMETERFV PointParameterfv = Switch_PointParameterfv;
+	typedef void (CODEGEN_FUNCPTR *PFNPOINTPARAMETERI)(GLenum, GLint);
+	static void CODEGEN_FUNCPTR Switch_PointParameteri(GLenum a0, GLint a1)
+	{
 		PointParameteri = reinterpret_cast<PFNPOINTPARAMETERI>(IntGetProcAddress("glPointParameteri"));
-		if(!PointParameteri) ++numFailed;
+		return PointParameteri(a0, a1);
+	}
+	PFNPOINTPARAMETERI PointParameteri = Switch_PointParameteri;
+	typedef void (CODEGEN_FUNCPTR *PFNPOINTPARAMETERIV)(GLenum, const GLint *);
+	static void CODEGEN_FUNCPTR Switch_PointParameteriv(GLenum a0, const GLint *a1)
+	{
 		PointParameteriv = reinterpret_cast<PFNPOINTPARAMETERIV>(IntGetProcAddress("glPointParameteriv"));
-		if(!PointParameteriv) ++numFailed;
+		return PointParameteriv(a0, a1);
+	}
+	PFNPOINTPARAMETERIV PointParameteriv = Switch_PointParameteriv;
+	
+	typedef void (CODEGEN_FUNCPTR *PFNBEGINQUERY)(GLenum, GLuint);
+	static void CODEGEN_FUNCPTR Switch_BeginQuery(GLenum a0, GLuint a1)
+	{
 		BeginQuery = reinterpret_cast<PFNBEGINQUERY>(IntGetProcAddress("glBeginQuery"));
-		if(!BeginQuery) ++numFailed;
+		return BeginQuery(a0, a1);
+	}
+	PFNBEGINQUERY BeginQuery = Switch_BeginQuery;
+	typedef void (CODEGEN_FUNCPTR *PFNBINDBUFFER)(GLenum, GLuint);
+	static void CODEGEN_FUNCPTR Switch_BindBuffer(GLenum a0, GLuint a1)
+	{
 		BindBuffer = reinterpret_cast<PFNBINDBUFFER>(IntGetProcAddress("glBindBuffer"));
-		if(!BindBuffer) ++numFailed;
+		return BindBuffer(a0, a1);
+	}
+	PFNBINDBUFFER BindBuffer = Switch_BindBuffer;
+	typedef void (CODEGEN_FUNCPTR *PFNBUFFERDATA)(GLenum, GLsizeiptr, const void *, GLenum);
+	static void CODEGEN_FUNCPTR Switch_BufferData(GLenum a0, GLsizeiptr a1, const void *a2, GLenum a3)
+	{
 		BufferData = reinterpret_cast<PFNBUFFERDATA>(IntGetProcAddress("glBufferData"));
-		if(!BufferData) ++numFailed;
+		return BufferData(a0, a1, a2, a3);
+	}
+	PFNBUFFERDATA BufferData = Switch_BufferData;
+	typedef void (CODEGEN_FUNCPTR *PFNBUFFERSUBDATA)(GLenum, GLintptr, GLsizeiptr, const void *);
+	static void CODEGEN_FUNCPTR Switch_BufferSubData(GLenum a0, GLintptr a1, GLsizeiptr a2, const void *a3)
+	{
 		BufferSubData = reinterpret_cast<PFNBUFFERSUBDATA>(IntGetProcAddress("glBufferSubData"));
-		if(!BufferSubData) ++numFailed;
+		return BufferSubData(a0, a1, a2, a3);
+	}
+	PFNBUFFERSUBDATA BufferSubData = Switch_BufferSubData;
+	typedef void (CODEGEN_FUNCPTR *PFNDELETEBUFFERS)(GLsizei, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_DeleteBuffers(GLsizei a0, const GLuint *a1)
+	{
 		DeleteBuffers = reinterpret_cast<PFNDELETEBUFFERS>(IntGetProcAddress("glDeleteBuffers"));
-		if(!DeleteBuffers) ++numFailed;
+		return DeleteBuffers(a0, a1);
+	}
+	PFNDELETEBUFFERS DeleteBuffers = Switch_DeleteBuffers;
+	typedef void (CODEGEN_FUNCPTR *PFNDELETEQUERIES)(GLsizei, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_DeleteQueries(GLsizei a0, const GLuint *a1)
+	{
 		DeleteQueries = reinterpret_cast<PFNDELETEQUERIES>(IntGetProcAddress("glDeleteQueries"));
-		if(!DeleteQueries) ++numFailed;
+		return DeleteQueries(a0, a1);
+	}
+	PFNDELETEQUERIES DeleteQueries = Switch_DeleteQueries;
+	typedef void (CODEGEN_FUNCPTR *PFNENDQUERY)(GLenum);
+	static void CODEGEN_FUNCPTR Switch_EndQuery(GLenum a0)
+	{
 		EndQuery = reinterpret_cast<PFNENDQUERY>(IntGetProcAddress("glEndQuery"));
-		if(!EndQuery) ++numFailed;
+		return EndQuery(a0);
+	}
+	PFNENDQUERY EndQuery = Switch_EndQuery;
+	typedef void (CODEGEN_FUNCPTR *PFNGENBUFFERS)(GLsizei, GLuint *);
+	static void CODEGEN_FUNCPTR Switch_GenBuffers(GLsizei a0, GLuint *a1)
+	{
 		GenBuffers = reinterpret_cast<PFNGENBUFFERS>(IntGetProcAddress("glGenBuffers"));
-		if(!GenBuffers) ++numFailed;
+		return GenBuffers(a0, a1);
+	}
+	PFNGENBUFFERS GenBuffers = Switch_GenBuffers;
+	typedef void (CODEGEN_FUNCPTR *PFNGENQUERIES)(GLsizei, GLuint *);
+	static void CODEGEN_FUNCPTR Switch_GenQueries(GLsizei a0, GLuint *a1)
+	{
 		GenQueries = reinterpret_cast<PFNGENQUERIES>(IntGetProcAddress("glGenQueries"));
-		if(!GenQueries) ++numFailed;
+		return GenQueries(a0, a1);
+	}
+	PFNGENQUERIES GenQueries = Switch_GenQueries;
+	typedef void (CODEGEN_FUNCPTR *PFNGETBUFFERPARAMETERIV)(GLenum, GLenum, GLint *);
+	static void CODEGEN_FUNCPTR Switch_GetBufferParameteriv(GLenum a0, GLenum a1, GLint *a2)
+	{
 		GetBufferParameteriv = reinterpret_cast<PFNGETBUFFERPARAMETERIV>(IntGetProcAddress("glGetBufferParameteriv"));
-		if(!GetBufferParameteriv) ++numFailed;
+		return GetBufferParameteriv(a0, a1, a2);
+	}
+	PFNGETBUFFERPARAMETERIV GetBufferParameteriv = Switch_GetBufferParameteriv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETBUFFERPOINTERV)(GLenum, GLenum, void **);
+	static void CODEGEN_FUNCPTR Switch_GetBufferPointerv(GLenum a0, GLenum a1, void **a2)
+	{
 		GetBufferPointerv = reinterpret_cast<PFNGETBUFFERPOINTERV>(IntGetProcAddress("glGetBufferPointerv"));
-		if(!GetBufferPointerv) ++numFailed;
+		return GetBufferPointerv(a0, a1, a2);
+	}
+	PFNGETBUFFERPOINTERV GetBufferPointerv = Switch_GetBufferPointerv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETBUFFERSUBDATA)(GLenum, GLintptr, GLsizeiptr, void *);
+	static void CODEGEN_FUNCPTR Switch_GetBufferSubData(GLenum a0, GLintptr a1, GLsizeiptr a2, void *a3)
+	{
 		GetBufferSubData = reinterpret_cast<PFNGETBUFFERSUBDATA>(IntGetProcAddress("glGetBufferSubData"));
-		if(!GetBufferSubData) ++numFailed;
+		return GetBufferSubData(a0, a1, a2, a3);
+	}
+	PFNGETBUFFERSUBDATA GetBufferSubData = Switch_GetBufferSubData;
+	typedef void (CODEGEN_FUNCPTR *PFNGETQUERYOBJECTIV)(GLuint, GLenum, GLint *);
+	static void CODEGEN_FUNCPTR Switch_GetQueryObjectiv(GLuint a0, GLenum a1, GLint *a2)
+	{
 		GetQueryObjectiv = reinterpret_cast<PFNGETQUERYOBJECTIV>(IntGetProcAddress("glGetQueryObjectiv"));
-		if(!GetQueryObjectiv) ++numFailed;
+		return GetQueryObjectiv(a0, a1, a2);
+	}
+	PFNGETQUERYOBJECTIV GetQueryObjectiv = Switch_GetQueryObjectiv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETQUERYOBJECTUIV)(GLuint, GLenum, GLuint *);
+	static void CODEGEN_FUNCPTR Switch_GetQueryObjectuiv(GLuint a0, GLenum a1, GLuint *a2)
+	{
 		GetQueryObjectuiv = reinterpret_cast<PFNGETQUERYOBJECTUIV>(IntGetProcAddress("glGetQueryObjectuiv"));
-		if(!GetQueryObjectuiv) ++numFailed;
+		return GetQueryObjectuiv(a0, a1, a2);
+	}
+	PFNGETQUERYOBJECTUIV GetQueryObjectuiv = Switch_GetQueryObjectuiv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETQUERYIV)(GLenum, GLenum, GLint *);
+	static void CODEGEN_FUNCPTR Switch_GetQueryiv(GLenum a0, GLenum a1, GLint *a2)
+	{
 		GetQueryiv = reinterpret_cast<PFNGETQUERYIV>(IntGetProcAddress("glGetQueryiv"));
-		if(!GetQueryiv) ++numFailed;
+		return GetQueryiv(a0, a1, a2);
+	}
+	PFNGETQUERYIV GetQueryiv = Switch_GetQueryiv;
+	typedef GLboolean (CODEGEN_FUNCPTR *PFNISBUFFER)(GLuint);
+	static GLboolean CODEGEN_FUNCPTR Switch_IsBuffer(GLuint a0)
+	{
 		IsBuffer = reinterpret_cast<PFNISBUFFER>(IntGetProcAddress("glIsBuffer"));
-		if(!IsBuffer) ++numFailed;
+		return IsBuffer(a0);
+	}
+	PFNISBUFFER IsBuffer = Switch_IsBuffer;
+	typedef GLboolean (CODEGEN_FUNCPTR *PFNISQUERY)(GLuint);
+	static GLboolean CODEGEN_FUNCPTR Switch_IsQuery(GLuint a0)
+	{
 		IsQuery = reinterpret_cast<PFNISQUERY>(IntGetProcAddress("glIsQuery"));
-		if(!IsQuery) ++numFailed;
+		return IsQuery(a0);
+	}
+	PFNISQUERY IsQuery = Switch_IsQuery;
+	typedef void * (CODEGEN_FUNCPTR *PFNMAPBUFFER)(GLenum, GLenum);
+	static void * CODEGEN_FUNCPTR Switch_MapBuffer(GLenum a0, GLenum a1)
+	{
 		MapBuffer = reinterpret_cast<PFNMAPBUFFER>(IntGetProcAddress("glMapBuffer"));
-		if(!MapBuffer) ++numFailed;
+		return MapBuffer(a0, a1);
+	}
+	PFNMAPBUFFER MapBuffer = Switch_MapBuffer;
+	typedef GLboolean (CODEGEN_FUNCPTR *PFNUNMAPBUFFER)(GLenum);
+	static GLboolean CODEGEN_FUNCPTR Switch_UnmapBuffer(GLenum a0)
+	{
 		UnmapBuffer = reinterpret_cast<PFNUNMAPBUFFER>(IntGetProcAddress("glUnmapBuffer"));
-		if(!UnmapBuffer) ++numFailed;
+		return UnmapBuffer(a0);
+	}
+	PFNUNMAPBUFFER UnmapBuffer = Switch_UnmapBuffer;
+	
+	typedef void (CODEGEN_FUNCPTR *PFNATTACHSHADER)(GLuint, GLuint);
+	static void CODEGEN_FUNCPTR Switch_AttachShader(GLuint a0, GLuint a1)
+	{
 		AttachShader = reinterpret_cast<PFNATTACHSHADER>(IntGetProcAddress("glAttachShader"));
-		if(!AttachShader) ++numFailed;
+		return AttachShader(a0, a1);
+	}
+	PFNATTACHSHADER AttachShader = Switch_AttachShader;
+	typedef void (CODEGEN_FUNCPTR *PFNBINDATTRIBLOCATION)(GLuint, GLuint, const GLchar *);
+	static void CODEGEN_FUNCPTR Switch_BindAttribLocation(GLuint a0, GLuint a1, const GLchar *a2)
+	{
 		BindAttribLocation = reinterpret_cast<PFNBINDATTRIBLOCATION>(IntGetProcAddress("glBindAttribLocation"));
-		if(!BindAttribLocation) ++numFailed;
+		return BindAttribLocation(a0, a1, a2);
+	}
+	PFNBINDATTRIBLOCATION BindAttribLocation = Switch_BindAttribLocation;
+	typedef void (CODEGEN_FUNCPTR *PFNBLENDEQUATIONSEPARATE)(GLenum, GLenum);
+	static void CODEGEN_FUNCPTR Switch_BlendEquationSeparate(GLenum a0, GLenum a1)
+	{
 		BlendEquationSeparate = reinterpret_cast<PFNBLENDEQUATIONSEPARATE>(IntGetProcAddress("glBlendEquationSeparate"));
-		if(!BlendEquationSeparate) ++numFailed;
+		return BlendEquationSeparate(a0, a1);
+	}
+	PFNBLENDEQUATIONSEPARATE BlendEquationSeparate = Switch_BlendEquationSeparate;
+	typedef void (CODEGEN_FUNCPTR *PFNCOMPILESHADER)(GLuint);
+	static void CODEGEN_FUNCPTR Switch_CompileShader(GLuint a0)
+	{
 		CompileShader = reinterpret_cast<PFNCOMPILESHADER>(IntGetProcAddress("glCompileShader"));
-		if(!CompileShader) ++numFailed;
+		return CompileShader(a0);
+	}
+	PFNCOMPILESHADER CompileShader = Switch_CompileShader;
+	typedef GLuint (CODEGEN_FUNCPTR *PFNCREATEPROGRAM)(void);
+	static GLuint CODEGEN_FUNCPTR Switch_CreateProgram(void)
+	{
 		CreateProgram = reinterpret_cast<PFNCREATEPROGRAM>(IntGetProcAddress("glCreateProgram"));
-		if(!CreateProgram) ++numFailed;
+		return CreateProgram();
+	}
+	PFNCREATEPROGRAM CreateProgram = Switch_CreateProgram;
+	typedef GLuint (CODEGEN_FUNCPTR *PFNCREATESHADER)(GLenum);
+	static GLuint CODEGEN_FUNCPTR Switch_CreateShader(GLenum a0)
+	{
 		CreateShader = reinterpret_cast<PFNCREATESHADER>(IntGetProcAddress("glCreateShader"));
-		if(!CreateShader) ++numFailed;
+		return CreateShader(a0);
+	}
+	PFNCREATESHADER CreateShader = Switch_CreateShader;
+	typedef void (CODEGEN_FUNCPTR *PFNDELETEPROGRAM)(GLuint);
+	static void CODEGEN_FUNCPTR Switch_DeleteProgram(GLuint a0)
+	{
 		DeleteProgram = reinterpret_cast<PFNDELETEPROGRAM>(IntGetProcAddress("glDeleteProgram"));
-		if(!DeleteProgram) ++numFailed;
+		return DeleteProgram(a0);
+	}
+	PFNDELETEPROGRAM DeleteProgram = Switch_DeleteProgram;
+	typedef void (CODEGEN_FUNCPTR *PFNDELETESHADER)(GLuint);
+	static void CODEGEN_FUNCPTR Switch_DeleteShader(GLuint a0)
+	{
 		DeleteShader = reinterpret_cast<PFNDELETESHADER>(IntGetProcAddress("glDeleteShader"));
-		if(!DeleteShader) ++numFailed;
+		return DeleteShader(a0);
+	}
+	PFNDELETESHADER DeleteShader = Switch_DeleteShader;
+	typedef void (CODEGEN_FUNCPTR *PFNDETACHSHADER)(GLuint, GLuint);
+	static void CODEGEN_FUNCPTR Switch_DetachShader(GLuint a0, GLuint a1)
+	{
 		DetachShader = reinterpret_cast<PFNDETACHSHADER>(IntGetProcAddress("glDetachShader"));
-		if(!DetachShader) ++numFailed;
+		return DetachShader(a0, a1);
+	}
+	PFNDETACHSHADER DetachShader = Switch_DetachShader;
+	typedef void (CODEGEN_FUNCPTR *PFNDISABLEVERTEXATTRIBARRAY)(GLuint);
+	static void CODEGEN_FUNCPTR Switch_DisableVertexAttribArray(GLuint a0)
+	{
 		DisableVertexAttribArray = reinterpret_cast<PFNDISABLEVERTEXATTRIBARRAY>(IntGetProcAddress("glDisableVertexAttribArray"));
-		if(!DisableVertexAttribArray) ++numFailed;
+		return DisableVertexAttribArray(a0);
+	}
+	PFNDISABLEVERTEXATTRIBARRAY DisableVertexAttribArray = Switch_DisableVertexAttribArray;
+	typedef void (CODEGEN_FUNCPTR *PFNDRAWBUFFERS)(GLsizei, const GLenum *);
+	static void CODEGEN_FUNCPTR Switch_DrawBuffers(GLsizei a0, const GLenum *a1)
+	{
 		DrawBuffers = reinterpret_cast<PFNDRAWBUFFERS>(IntGetProcAddress("glDrawBuffers"));
-		if(!DrawBuffers) ++numFailed;
+		return DrawBuffers(a0, a1);
+	}
+	PFNDRAWBUFFERS DrawBuffers = Switch_DrawBuffers;
+	typedef void (CODEGEN_FUNCPTR *PFNENABLEVERTEXATTRIBARRAY)(GLuint);
+	static void CODEGEN_FUNCPTR Switch_EnableVertexAttribArray(GLuint a0)
+	{
 		EnableVertexAttribArray = reinterpret_cast<PFNENABLEVERTEXATTRIBARRAY>(IntGetProcAddress("glEnableVertexAttribArray"));
-		if(!EnableVertexAttribArray) ++numFailed;
+		return EnableVertexAttribArray(a0);
+	}
+	PFNENABLEVERTEXATTRIBARRAY EnableVertexAttribArray = Switch_EnableVertexAttribArray;
+	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVEATTRIB)(GLuint, GLuint, GLsizei, GLsizei *, GLint *, GLenum *, GLchar *);
+	static void CODEGEN_FUNCPTR Switch_GetActiveAttrib(GLuint a0, GLuint a1, GLsizei a2, GLsizei *a3, GLint *a4, GLenum *a5, GLchar *a6)
+	{
 		GetActiveAttrib = reinterpret_cast<PFNGETACTIVEATTRIB>(IntGetProcAddress("glGetActiveAttrib"));
-		if(!GetActiveAttrib) ++numFailed;
+		return GetActiveAttrib(a0, a1, a2, a3, a4, a5, a6);
+	}
+	PFNGETACTIVEATTRIB GetActiveAttrib = Switch_GetActiveAttrib;
+	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVEUNIFORM)(GLuint, GLuint, GLsizei, GLsizei *, GLint *, GLenum *, GLchar *);
+	static void CODEGEN_FUNCPTR Switch_GetActiveUniform(GLuint a0, GLuint a1, GLsizei a2, GLsizei *a3, GLint *a4, GLenum *a5, GLchar *a6)
+	{
 		GetActiveUniform = reinterpret_cast<PFNGETACTIVEUNIFORM>(IntGetProcAddress("glGetActiveUniform"));
-		if(!GetActiveUniform) ++numFailed;
+		return GetActiveUniform(a0, a1, a2, a3, a4, a5, a6);
+	}
+	PFNGETACTIVEUNIFORM GetActiveUniform = Switch_GetActiveUniform;
+	typedef void (CODEGEN_FUNCPTR *PFNGETATTACHEDSHADERS)(GLuint, GLsizei, GLsizei *, GLuint *);
+	static void CODEGEN_FUNCPTR Switch_GetAttachedShaders(GLuint a0, GLsizei a1, GLsizei *a2, GLuint *a3)
+	{
 		GetAttachedShaders = reinterpret_cast<PFNGETATTACHEDSHADERS>(IntGetProcAddress("glGetAttachedShaders"));
-		if(!GetAttachedShaders) ++numFailed;
+		return GetAttachedShaders(a0, a1, a2, a3);
+	}
+	PFNGETATTACHEDSHADERS GetAttachedShaders = Switch_GetAttachedShaders;
+	typedef GLint (CODEGEN_FUNCPTR *PFNGETATTRIBLOCATION)(GLuint, const GLchar *);
+	static GLint CODEGEN_FUNCPTR Switch_GetAttribLocation(GLuint a0, const GLchar *a1)
+	{
 		GetAttribLocation = reinterpret_cast<PFNGETATTRIBLOCATION>(IntGetProcAddress("glGetAttribLocation"));
-		if(!GetAttribLocation) ++numFailed;
+		return GetAttribLocation(a0, a1);
+	}
+	PFNGETATTRIBLOCATION GetAttribLocation = Switch_GetAttribLocation;
+	typedef void (CODEGEN_FUNCPTR *PFNGETPROGRAMINFOLOG)(GLuint, GLsizei, GLsizei *, GLchar *);
+	static void CODEGEN_FUNCPTR Switch_GetProgramInfoLog(GLuint a0, GLsizei a1, GLsizei *a2, GLchar *a3)
+	{
 		GetProgramInfoLog = reinterpret_cast<PFNGETPROGRAMINFOLOG>(IntGetProcAddress("glGetProgramInfoLog"));
-		if(!GetProgramInfoLog) ++numFailed;
+		return GetProgramInfoLog(a0, a1, a2, a3);
+	}
+	PFNGETPROGRAMINFOLOG GetProgramInfoLog = Switch_GetProgramInfoLog;
+	typedef void (CODEGEN_FUNCPTR *PFNGETPROGRAMIV)(GLuint, GLenum, GLint *);
+	static void CODEGEN_FUNCPTR Switch_GetProgramiv(GLuint a0, GLenum a1, GLint *a2)
+	{
 		GetProgramiv = reinterpret_cast<PFNGETPROGRAMIV>(IntGetProcAddress("glGetProgramiv"));
-		if(!GetProgramiv) ++numFailed;
+		return GetProgramiv(a0, a1, a2);
+	}
+	PFNGETPROGRAMIV GetProgramiv = Switch_GetProgramiv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETSHADERINFOLOG)(GLuint, GLsizei, GLsizei *, GLchar *);
+	static void CODEGEN_FUNCPTR Switch_GetShaderInfoLog(GLuint a0, GLsizei a1, GLsizei *a2, GLchar *a3)
+	{
 		GetShaderInfoLog = reinterpret_cast<PFNGETSHADERINFOLOG>(IntGetProcAddress("glGetShaderInfoLog"));
-		if(!GetShaderInfoLog) ++numFailed;
+		return GetShaderInfoLog(a0, a1, a2, a3);
+	}
+	PFNGETSHADERINFOLOG GetShaderInfoLog = Switch_GetShaderInfoLog;
+	typedef void (CODEGEN_FUNCPTR *PFNGETSHADERSOURCE)(GLuint, GLsizei, GLsizei *, GLchar *);
+	static void CODEGEN_FUNCPTR Switch_GetShaderSource(GLuint a0, GLsizei a1, GLsizei *a2, GLchar *a3)
+	{
 		GetShaderSource = reinterpret_cast<PFNGETSHADERSOURCE>(IntGetProcAddress("glGetShaderSource"));
-		if(!GetShaderSource) ++numFailed;
+		return GetShaderSource(a0, a1, a2, a3);
+	}
+	PFNGETSHADERSOURCE GetShaderSource = Switch_GetShaderSource;
+	typedef void (CODEGEN_FUNCPTR *PFNGETSHADERIV)(GLuint, GLenum, GLint *);
+	static void CODEGEN_FUNCPTR Switch_GetShaderiv(GLuint a0, GLenum a1, GLint *a2)
+	{
 		GetShaderiv = reinterpret_cast<PFNGETSHADERIV>(IntGetProcAddress("glGetShaderiv"));
-		if(!GetShaderiv) ++numFailed;
+		return GetShaderiv(a0, a1, a2);
+	}
+	PFNGETSHADERIV GetShaderiv = Switch_GetShaderiv;
+	typedef GLint (CODEGEN_FUNCPTR *PFNGETUNIFORMLOCATION)(GLuint, const GLchar *);
+	static GLint CODEGEN_FUNCPTR Switch_GetUniformLocation(GLuint a0, const GLchar *a1)
+	{
 		GetUniformLocation = reinterpret_cast<PFNGETUNIFORMLOCATION>(IntGetProcAddress("glGetUniformLocation"));
-		if(!GetUniformLocation) ++numFailed;
+		return GetUniformLocation(a0, a1);
+	}
+	PFNGETUNIFORMLOCATION GetUniformLocation = Switch_GetUniformLocation;
+	typedef void (CODEGEN_FUNCPTR *PFNGETUNIFORMFV)(GLuint, GLint, GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_GetUniformfv(GLuint a0, GLint a1, GLfloat *a2)
+	{
 		GetUniformfv = reinterpret_cast<PFNGETUNIFORMFV>(IntGetProcAddress("glGetUniformfv"));
-		if(!GetUniformfv) ++numFailed;
+		return GetUniformfv(a0, a1, a2);
+	}
+	PFNGETUNIFORMFV GetUniformfv = Switch_GetUniformfv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETUNIFORMIV)(GLuint, GLint, GLint *);
+	static void CODEGEN_FUNCPTR Switch_GetUniformiv(GLuint a0, GLint a1, GLint *a2)
+	{
 		GetUniformiv = reinterpret_cast<PFNGETUNIFORMIV>(IntGetProcAddress("glGetUniformiv"));
-		if(!GetUniformiv) ++numFailed;
+		return GetUniformiv(a0, a1, a2);
+	}
+	PFNGETUNIFORMIV GetUniformiv = Switch_GetUniformiv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETVERTEXATTRIBPOINTERV)(GLuint, GLenum, void **);
+	static void CODEGEN_FUNCPTR Switch_GetVertexAttribPointerv(GLuint a0, GLenum a1, void **a2)
+	{
 		GetVertexAttribPointerv = reinterpret_cast<PFNGETVERTEXATTRIBPOINTERV>(IntGetProcAddress("glGetVertexAttribPointerv"));
-		if(!GetVertexAttribPointerv) ++numFailed;
+		return GetVertexAttribPointerv(a0, a1, a2);
+	}
+	PFNGETVERTEXATTRIBPOINTERV GetVertexAttribPointerv = Switch_GetVertexAttribPointerv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETVERTEXATTRIBDV)(GLuint, GLenum, GLdouble *);
+	static void CODEGEN_FUNCPTR Switch_GetVertexAttribdv(GLuint a0, GLenum a1, GLdouble *a2)
+	{
 		GetVertexAttribdv = reinterpret_cast<PFNGETVERTEXATTRIBDV>(IntGetProcAddress("glGetVertexAttribdv"));
-		if(!GetVertexAttribdv) ++numFailed;
+		return GetVertexAttribdv(a0, a1, a2);
+	}
+	PFNGETVERTEXATTRIBDV GetVertexAttribdv = Switch_GetVertexAttribdv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETVERTEXATTRIBFV)(GLuint, GLenum, GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_GetVertexAttribfv(GLuint a0, GLenum a1, GLfloat *a2)
+	{
 		GetVertexAttribfv = reinterpret_cast<PFNGETVERTEXATTRIBFV>(IntGetProcAddress("glGetVertexAttribfv"));
-		if(!GetVertexAttribfv) ++numFailed;
+		return GetVertexAttribfv(a0, a1, a2);
+	}
+	PFNGETVERTEXATTRIBFV GetVertexAttribfv = Switch_GetVertexAttribfv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETVERTEXATTRIBIV)(GLuint, GLenum, GLint *);
+	static void CODEGEN_FUNCPTR Switch_GetVertexAttribiv(GLuint a0, GLenum a1, GLint *a2)
+	{
 		GetVertexAttribiv = reinterpret_cast<PFNGETVERTEXATTRIBIV>(IntGetProcAddress("glGetVertexAttribiv"));
-		if(!GetVertexAttribiv) ++numFailed;
+		return GetVertexAttribiv(a0, a1, a2);
+	}
+	PFNGETVERTEXATTRIBIV GetVertexAttribiv = Switch_GetVertexAttribiv;
+	typedef GLboolean (CODEGEN_FUNCPTR *PFNISPROGRAM)(GLuint);
+	static GLboolean CODEGEN_FUNCPTR Switch_IsProgram(GLuint a0)
+	{
 		IsProgram = reinterpret_cast<PFNISPROGRAM>(IntGetProcAddress("glIsProgram"));
-		if(!IsProgram) ++numFailed;
+		return IsProgram(a0);
+	}
+	PFNISPROGRAM IsProgram = Switch_IsProgram;
+	typedef GLboolean (CODEGEN_FUNCPTR *PFNISSHADER)(GLuint);
+	static GLboolean CODEGEN_FUNCPTR Switch_IsShader(GLuint a0)
+	{
 		IsShader = reinterpret_cast<PFNISSHADER>(IntGetProcAddress("glIsShader"));
-		if(!IsShader) ++numFailed;
+		return IsShader(a0);
+	}
+	PFNISSHADER IsShader = Switch_IsShader;
+	typedef void (CODEGEN_FUNCPTR *PFNLINKPROGRAM)(GLuint);
+	static void CODEGEN_FUNCPTR Switch_LinkProgram(GLuint a0)
+	{
 		LinkProgram = reinterpret_cast<PFNLINKPROGRAM>(IntGetProcAddress("glLinkProgram"));
-		if(!LinkProgram) ++numFailed;
+		return LinkProgram(a0);
+	}
+	PFNLINKPROGRAM LinkProgram = Switch_LinkProgram;
+	typedef void (CODEGEN_FUNCPTR *PFNSHADERSOURCE)(GLuint, GLsizei, const GLchar *const*, const GLint *);
+	static void CODEGEN_FUNCPTR Switch_ShaderSource(GLuint a0, GLsizei a1, const GLchar *const*a2, const GLint *a3)
+	{
 		ShaderSource = reinterpret_cast<PFNSHADERSOURCE>(IntGetProcAddress("glShaderSource"));
-		if(!ShaderSource) ++numFailed;
+		return ShaderSource(a0, a1, a2, a3);
+	}
+	PFNSHADERSOURCE ShaderSource = Switch_ShaderSource;
+	typedef void (CODEGEN_FUNCPTR *PFNSTENCILFUNCSEPARATE)(GLenum, GLenum, GLint, GLuint);
+	static void CODEGEN_FUNCPTR Switch_StencilFuncSeparate(GLenum a0, GLenum a1, GLint a2, GLuint a3)
+	{
 		StencilFuncSeparate = reinterpret_cast<PFNSTENCILFUNCSEPARATE>(IntGetProcAddress("glStencilFuncSeparate"));
-		if(!StencilFuncSeparate) ++numFailed;
+		return StencilFuncSeparate(a0, a1, a2, a3);
+	}
+	PFNSTENCILFUNCSEPARATE StencilFuncSeparate = Switch_StencilFuncSeparate;
+	typedef void (CODEGEN_FUNCPTR *PFNSTENCILMASKSEPARATE)(GLenum, GLuint);
+	static void CODEGEN_FUNCPTR Switch_StencilMaskSeparate(GLenum a0, GLuint a1)
+	{
 		StencilMaskSeparate = reinterpret_cast<PFNSTENCILMASKSEPARATE>(IntGetProcAddress("glStencilMaskSeparate"));
-		if(!StencilMaskSeparate) ++numFailed;
+		return StencilMaskSeparate(a0, a1);
+	}
+	PFNSTENCILMASKSEPARATE StencilMaskSeparate = Switch_StencilMaskSeparate;
+	typedef void (CODEGEN_FUNCPTR *PFNSTENCILOPSEPARATE)(GLenum, GLenum, GLenum, GLenum);
+	static void CODEGEN_FUNCPTR Switch_StencilOpSeparate(GLenum a0, GLenum a1, GLenum a2, GLenum a3)
+	{
 		StencilOpSeparate = reinterpret_cast<PFNSTENCILOPSEPARATE>(IntGetProcAddress("glStencilOpSeparate"));
-		if(!StencilOpSeparate) ++numFailed;
+		return StencilOpSeparate(a0, a1, a2, a3);
+	}
+	PFNSTENCILOPSEPARATE StencilOpSeparate = Switch_StencilOpSeparate;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM1F)(GLint, GLfloat);
+	static void CODEGEN_FUNCPTR Switch_Uniform1f(GLint a0, GLfloat a1)
+	{
 		Uniform1f = reinterpret_cast<PFNUNIFORM1F>(IntGetProcAddress("glUniform1f"));
-		if(!Uniform1f) ++numFailed;
+		return Uniform1f(a0, a1);
+	}
+	PFNUNIFORM1F Uniform1f = Switch_Uniform1f;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM1FV)(GLint, GLsizei, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_Uniform1fv(GLint a0, GLsizei a1, const GLfloat *a2)
+	{
 		Uniform1fv = reinterpret_cast<PFNUNIFORM1FV>(IntGetProcAddress("glUniform1fv"));
-		if(!Uniform1fv) ++numFailed;
+		return Uniform1fv(a0, a1, a2);
+	}
+	PFNUNIFORM1FV Uniform1fv = Switch_Uniform1fv;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM1I)(GLint, GLint);
+	static void CODEGEN_FUNCPTR Switch_Uniform1i(GLint a0, GLint a1)
+	{
 		Uniform1i = reinterpret_cast<PFNUNIFORM1I>(IntGetProcAddress("glUniform1i"));
-		if(!Uniform1i) ++numFailed;
+		return Uniform1i(a0, a1);
+	}
+	PFNUNIFORM1I Uniform1i = Switch_Uniform1i;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM1IV)(GLint, GLsizei, const GLint *);
+	static void CODEGEN_FUNCPTR Switch_Uniform1iv(GLint a0, GLsizei a1, const GLint *a2)
+	{
 		Uniform1iv = reinterpret_cast<PFNUNIFORM1IV>(IntGetProcAddress("glUniform1iv"));
-		if(!Uniform1iv) ++numFailed;
+		return Uniform1iv(a0, a1, a2);
+	}
+	PFNUNIFORM1IV Uniform1iv = Switch_Uniform1iv;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM2F)(GLint, GLfloat, GLfloat);
+	static void CODEGEN_FUNCPTR Switch_Uniform2f(GLint a0, GLfloat a1, GLfloat a2)
+	{
 		Uniform2f = reinterpret_cast<PFNUNIFORM2F>(IntGetProcAddress("glUniform2f"));
-		if(!Uniform2f) ++numFailed;
+		return Uniform2f(a0, a1, a2);
+	}
+	PFNUNIFORM2F Uniform2f = Switch_Uniform2f;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM2FV)(GLint, GLsizei, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_Uniform2fv(GLint a0, GLsizei a1, const GLfloat *a2)
+	{
 		Uniform2fv = reinterpret_cast<PFNUNIFORM2FV>(IntGetProcAddress("glUniform2fv"));
-		if(!Uniform2fv) ++numFailed;
+		return Uniform2fv(a0, a1, a2);
+	}
+	PFNUNIFORM2FV Uniform2fv = Switch_Uniform2fv;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM2I)(GLint, GLint, GLint);
+	static void CODEGEN_FUNCPTR Switch_Uniform2i(GLint a0, GLint a1, GLint a2)
+	{
 		Uniform2i = reinterpret_cast<PFNUNIFORM2I>(IntGetProcAddress("glUniform2i"));
-		if(!Uniform2i) ++numFailed;
+		return Uniform2i(a0, a1, a2);
+	}
+	PFNUNIFORM2I Uniform2i = Switch_Uniform2i;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM2IV)(GLint, GLsizei, const GLint *);
+	static void CODEGEN_FUNCPTR Switch_Uniform2iv(GLint a0, GLsizei a1, const GLint *a2)
+	{
 		Uniform2iv = reinterpret_cast<PFNUNIFORM2IV>(IntGetProcAddress("glUniform2iv"));
-		if(!Uniform2iv) ++numFailed;
+		return Uniform2iv(a0, a1, a2);
+	}
+	PFNUNIFORM2IV Uniform2iv = Switch_Uniform2iv;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM3F)(GLint, GLfloat, GLfloat, GLfloat);
+	static void CODEGEN_FUNCPTR Switch_Uniform3f(GLint a0, GLfloat a1, GLfloat a2, GLfloat a3)
+	{
 		Uniform3f = reinterpret_cast<PFNUNIFORM3F>(IntGetProcAddress("glUniform3f"));
-		if(!Uniform3f) ++numFailed;
+		return Uniform3f(a0, a1, a2, a3);
+	}
+	PFNUNIFORM3F Uniform3f = Switch_Uniform3f;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM3FV)(GLint, GLsizei, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_Uniform3fv(GLint a0, GLsizei a1, const GLfloat *a2)
+	{
 		Uniform3fv = reinterpret_cast<PFNUNIFORM3FV>(IntGetProcAddress("glUniform3fv"));
-		if(!Uniform3fv) ++numFailed;
+		return Uniform3fv(a0, a1, a2);
+	}
+	PFNUNIFORM3FV Uniform3fv = Switch_Uniform3fv;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM3I)(GLint, GLint, GLint, GLint);
+	static void CODEGEN_FUNCPTR Switch_Uniform3i(GLint a0, GLint a1, GLint a2, GLint a3)
+	{
 		Uniform3i = reinterpret_cast<PFNUNIFORM3I>(IntGetProcAddress("glUniform3i"));
-		if(!Uniform3i) ++numFailed;
+		return Uniform3i(a0, a1, a2, a3);
+	}
+	PFNUNIFORM3I Uniform3i = Switch_Uniform3i;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM3IV)(GLint, GLsizei, const GLint *);
+	static void CODEGEN_FUNCPTR Switch_Uniform3iv(GLint a0, GLsizei a1, const GLint *a2)
+	{
 		Uniform3iv = reinterpret_cast<PFNUNIFORM3IV>(IntGetProcAddress("glUniform3iv"));
-		if(!Uniform3iv) ++numFailed;
+		return Uniform3iv(a0, a1, a2);
+	}
+	PFNUNIFORM3IV Uniform3iv = Switch_Uniform3iv;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM4F)(GLint, GLfloat, GLfloat, GLfloat, GLfloat);
+	static void CODEGEN_FUNCPTR Switch_Uniform4f(GLint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+	{
 		Uniform4f = reinterpret_cast<PFNUNIFORM4F>(IntGetProcAddress("glUniform4f"));
-		if(!Uniform4f) ++numFailed;
+		return Uniform4f(a0, a1, a2, a3, a4);
+	}
+	PFNUNIFORM4F Uniform4f = Switch_Uniform4f;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM4FV)(GLint, GLsizei, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_Uniform4fv(GLint a0, GLsizei a1, const GLfloat *a2)
+	{
 		Uniform4fv = reinterpret_cast<PFNUNIFORM4FV>(IntGetProcAddress("glUniform4fv"));
-		if(!Uniform4fv) ++numFailed;
+		return Uniform4fv(a0, a1, a2);
+	}
+	PFNUNIFORM4FV Uniform4fv = Switch_Uniform4fv;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM4I)(GLint, GLint, GLint, GLint, GLint);
+	static void CODEGEN_FUNCPTR Switch_Uniform4i(GLint a0, GLint a1, GLint a2, GLint a3, GLint a4)
+	{
 		Uniform4i = reinterpret_cast<PFNUNIFORM4I>(IntGetProcAddress("glUniform4i"));
-		if(!Uniform4i) ++numFailed;
+		return Uniform4i(a0, a1, a2, a3, a4);
+	}
+	PFNUNIFORM4I Uniform4i = Switch_Uniform4i;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM4IV)(GLint, GLsizei, const GLint *);
+	static void CODEGEN_FUNCPTR Switch_Uniform4iv(GLint a0, GLsizei a1, const GLint *a2)
+	{
 		Uniform4iv = reinterpret_cast<PFNUNIFORM4IV>(IntGetProcAddress("glUniform4iv"));
-		if(!Uniform4iv) ++numFailed;
+		return Uniform4iv(a0, a1, a2);
+	}
+	PFNUNIFORM4IV Uniform4iv = Switch_Uniform4iv;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX2FV)(GLint, GLsizei, GLboolean, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix2fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat *a3)
+	{
 		UniformMatrix2fv = reinterpret_cast<PFNUNIFORMMATRIX2FV>(IntGetProcAddress("glUniformMatrix2fv"));
-		if(!UniformMatrix2fv) ++numFailed;
+		return UniformMatrix2fv(a0, a1, a2, a3);
+	}
+	PFNUNIFORMMATRIX2FV UniformMatrix2fv = Switch_UniformMatrix2fv;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX3FV)(GLint, GLsizei, GLboolean, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix3fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat *a3)
+	{
 		UniformMatrix3fv = reinterpret_cast<PFNUNIFORMMATRIX3FV>(IntGetProcAddress("glUniformMatrix3fv"));
-		if(!UniformMatrix3fv) ++numFailed;
+		return UniformMatrix3fv(a0, a1, a2, a3);
+	}
+	PFNUNIFORMMATRIX3FV UniformMatrix3fv = Switch_UniformMatrix3fv;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX4FV)(GLint, GLsizei, GLboolean, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix4fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat *a3)
+	{
 		UniformMatrix4fv = reinterpret_cast<PFNUNIFORMMATRIX4FV>(IntGetProcAddress("glUniformMatrix4fv"));
-		if(!UniformMatrix4fv) ++numFailed;
+		return UniformMatrix4fv(a0, a1, a2, a3);
+	}
+	PFNUNIFORMMATRIX4FV UniformMatrix4fv = Switch_UniformMatrix4fv;
+	typedef void (CODEGEN_FUNCPTR *PFNUSEPROGRAM)(GLuint);
+	static void CODEGEN_FUNCPTR Switch_UseProgram(GLuint a0)
+	{
 		UseProgram = reinterpret_cast<PFNUSEPROGRAM>(IntGetProcAddress("glUseProgram"));
-		if(!UseProgram) ++numFailed;
+		return UseProgram(a0);
+	}
+	PFNUSEPROGRAM UseProgram = Switch_UseProgram;
+	typedef void (CODEGEN_FUNCPTR *PFNVALIDATEPROGRAM)(GLuint);
+	static void CODEGEN_FUNCPTR Switch_ValidateProgram(GLuint a0)
+	{
 		ValidateProgram = reinterpret_cast<PFNVALIDATEPROGRAM>(IntGetProcAddress("glValidateProgram"));
-		if(!ValidateProgram) ++numFailed;
+		return ValidateProgram(a0);
+	}
+	PFNVALIDATEPROGRAM ValidateProgram = Switch_ValidateProgram;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB1D)(GLuint, GLdouble);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib1d(GLuint a0, GLdouble a1)
+	{
 		VertexAttrib1d = reinterpret_cast<PFNVERTEXATTRIB1D>(IntGetProcAddress("glVertexAttrib1d"));
-		if(!VertexAttrib1d) ++numFailed;
+		return VertexAttrib1d(a0, a1);
+	}
+	PFNVERTEXATTRIB1D VertexAttrib1d = Switch_VertexAttrib1d;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB1DV)(GLuint, const GLdouble *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib1dv(GLuint a0, const GLdouble *a1)
+	{
 		VertexAttrib1dv = reinterpret_cast<PFNVERTEXATTRIB1DV>(IntGetProcAddress("glVertexAttrib1dv"));
-		if(!VertexAttrib1dv) ++numFailed;
+		return VertexAttrib1dv(a0, a1);
+	}
+	PFNVERTEXATTRIB1DV VertexAttrib1dv = Switch_VertexAttrib1dv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB1F)(GLuint, GLfloat);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib1f(GLuint a0, GLfloat a1)
+	{
 		VertexAttrib1f = reinterpret_cast<PFNVERTEXATTRIB1F>(IntGetProcAddress("glVertexAttrib1f"));
-		if(!VertexAttrib1f) ++numFailed;
+		return VertexAttrib1f(a0, a1);
+	}
+	PFNVERTEXATTRIB1F VertexAttrib1f = Switch_VertexAttrib1f;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB1FV)(GLuint, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib1fv(GLuint a0, const GLfloat *a1)
+	{
 		VertexAttrib1fv = reinterpret_cast<PFNVERTEXATTRIB1FV>(IntGetProcAddress("glVertexAttrib1fv"));
-		if(!VertexAttrib1fv) ++numFailed;
+		return VertexAttrib1fv(a0, a1);
+	}
+	PFNVERTEXATTRIB1FV VertexAttrib1fv = Switch_VertexAttrib1fv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB1S)(GLuint, GLshort);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib1s(GLuint a0, GLshort a1)
+	{
 		VertexAttrib1s = reinterpret_cast<PFNVERTEXATTRIB1S>(IntGetProcAddress("glVertexAttrib1s"));
-		if(!VertexAttrib1s) ++numFailed;
+		return VertexAttrib1s(a0, a1);
+	}
+	PFNVERTEXATTRIB1S VertexAttrib1s = Switch_VertexAttrib1s;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB1SV)(GLuint, const GLshort *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib1sv(GLuint a0, const GLshort *a1)
+	{
 		VertexAttrib1sv = reinterpret_cast<PFNVERTEXATTRIB1SV>(IntGetProcAddress("glVertexAttrib1sv"));
-		if(!VertexAttrib1sv) ++numFailed;
+		return VertexAttrib1sv(a0, a1);
+	}
+	PFNVERTEXATTRIB1SV VertexAttrib1sv = Switch_VertexAttrib1sv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB2D)(GLuint, GLdouble, GLdouble);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib2d(GLuint a0, GLdouble a1, GLdouble a2)
+	{
 		VertexAttrib2d = reinterpret_cast<PFNVERTEXATTRIB2D>(IntGetProcAddress("glVertexAttrib2d"));
-		if(!VertexAttrib2d) ++numFailed;
+		return VertexAttrib2d(a0, a1, a2);
+	}
+	PFNVERTEXATTRIB2D VertexAttrib2d = Switch_VertexAttrib2d;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB2DV)(GLuint, const GLdouble *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib2dv(GLuint a0, const GLdouble *a1)
+	{
 		VertexAttrib2dv = reinterpret_cast<PFNVERTEXATTRIB2DV>(IntGetProcAddress("glVertexAttrib2dv"));
-		if(!VertexAttrib2dv) ++numFailed;
+		return VertexAttrib2dv(a0, a1);
+	}
+	PFNVERTEXATTRIB2DV VertexAttrib2dv = Switch_VertexAttrib2dv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB2F)(GLuint, GLfloat, GLfloat);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib2f(GLuint a0, GLfloat a1, GLfloat a2)
+	{
 		VertexAttrib2f = reinterpret_cast<PFNVERTEXATTRIB2F>(IntGetProcAddress("glVertexAttrib2f"));
-		if(!VertexAttrib2f) ++numFailed;
+		return VertexAttrib2f(a0, a1, a2);
+	}
+	PFNVERTEXATTRIB2F VertexAttrib2f = Switch_VertexAttrib2f;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB2FV)(GLuint, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib2fv(GLuint a0, const GLfloat *a1)
+	{
 		VertexAttrib2fv = reinterpret_cast<PFNVERTEXATTRIB2FV>(IntGetProcAddress("glVertexAttrib2fv"));
-		if(!VertexAttrib2fv) ++numFailed;
+		return VertexAttrib2fv(a0, a1);
+	}
+	PFNVERTEXATTRIB2FV VertexAttrib2fv = Switch_VertexAttrib2fv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB2S)(GLuint, GLshort, GLshort);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib2s(GLuint a0, GLshort a1, GLshort a2)
+	{
 		VertexAttrib2s = reinterpret_cast<PFNVERTEXATTRIB2S>(IntGetProcAddress("glVertexAttrib2s"));
-		if(!VertexAttrib2s) ++numFailed;
+		return VertexAttrib2s(a0, a1, a2);
+	}
+	PFNVERTEXATTRIB2S VertexAttrib2s = Switch_VertexAttrib2s;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB2SV)(GLuint, const GLshort *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib2sv(GLuint a0, const GLshort *a1)
+	{
 		VertexAttrib2sv = reinterpret_cast<PFNVERTEXATTRIB2SV>(IntGetProcAddress("glVertexAttrib2sv"));
-		if(!VertexAttrib2sv) ++numFailed;
+		return VertexAttrib2sv(a0, a1);
+	}
+	PFNVERTEXATTRIB2SV VertexAttrib2sv = Switch_VertexAttrib2sv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB3D)(GLuint, GLdouble, GLdouble, GLdouble);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib3d(GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3)
+	{
 		VertexAttrib3d = reinterpret_cast<PFNVERTEXATTRIB3D>(IntGetProcAddress("glVertexAttrib3d"));
-		if(!VertexAttrib3d) ++numFailed;
+		return VertexAttrib3d(a0, a1, a2, a3);
+	}
+	PFNVERTEXATTRIB3D VertexAttrib3d = Switch_VertexAttrib3d;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB3DV)(GLuint, const GLdouble *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib3dv(GLuint a0, const GLdouble *a1)
+	{
 		VertexAttrib3dv = reinterpret_cast<PFNVERTEXATTRIB3DV>(IntGetProcAddress("glVertexAttrib3dv"));
-		if(!VertexAttrib3dv) ++numFailed;
+		return VertexAttrib3dv(a0, a1);
+	}
+	PFNVERTEXATTRIB3DV VertexAttrib3dv = Switch_VertexAttrib3dv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB3F)(GLuint, GLfloat, GLfloat, GLfloat);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib3f(GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3)
+	{
 		VertexAttrib3f = reinterpret_cast<PFNVERTEXATTRIB3F>(IntGetProcAddress("glVertexAttrib3f"));
-		if(!VertexAttrib3f) ++numFailed;
+		return VertexAttrib3f(a0, a1, a2, a3);
+	}
+	PFNVERTEXATTRIB3F VertexAttrib3f = Switch_VertexAttrib3f;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB3FV)(GLuint, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib3fv(GLuint a0, const GLfloat *a1)
+	{
 		VertexAttrib3fv = reinterpret_cast<PFNVERTEXATTRIB3FV>(IntGetProcAddress("glVertexAttrib3fv"));
-		if(!VertexAttrib3fv) ++numFailed;
+		return VertexAttrib3fv(a0, a1);
+	}
+	PFNVERTEXATTRIB3FV VertexAttrib3fv = Switch_VertexAttrib3fv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB3S)(GLuint, GLshort, GLshort, GLshort);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib3s(GLuint a0, GLshort a1, GLshort a2, GLshort a3)
+	{
 		VertexAttrib3s = reinterpret_cast<PFNVERTEXATTRIB3S>(IntGetProcAddress("glVertexAttrib3s"));
-		if(!VertexAttrib3s) ++numFailed;
+		return VertexAttrib3s(a0, a1, a2, a3);
+	}
+	PFNVERTEXATTRIB3S VertexAttrib3s = Switch_VertexAttrib3s;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB3SV)(GLuint, const GLshort *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib3sv(GLuint a0, const GLshort *a1)
+	{
 		VertexAttrib3sv = reinterpret_cast<PFNVERTEXATTRIB3SV>(IntGetProcAddress("glVertexAttrib3sv"));
-		if(!VertexAttrib3sv) ++numFailed;
+		return VertexAttrib3sv(a0, a1);
+	}
+	PFNVERTEXATTRIB3SV VertexAttrib3sv = Switch_VertexAttrib3sv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4NBV)(GLuint, const GLbyte *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4Nbv(GLuint a0, const GLbyte *a1)
+	{
 		VertexAttrib4Nbv = reinterpret_cast<PFNVERTEXATTRIB4NBV>(IntGetProcAddress("glVertexAttrib4Nbv"));
-		if(!VertexAttrib4Nbv) ++numFailed;
+		return VertexAttrib4Nbv(a0, a1);
+	}
+	PFNVERTEXATTRIB4NBV VertexAttrib4Nbv = Switch_VertexAttrib4Nbv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4NIV)(GLuint, const GLint *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4Niv(GLuint a0, const GLint *a1)
+	{
 		VertexAttrib4Niv = reinterpret_cast<PFNVERTEXATTRIB4NIV>(IntGetProcAddress("glVertexAttrib4Niv"));
-		if(!VertexAttrib4Niv) ++numFailed;
+		return VertexAttrib4Niv(a0, a1);
+	}
+	PFNVERTEXATTRIB4NIV VertexAttrib4Niv = Switch_VertexAttrib4Niv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4NSV)(GLuint, const GLshort *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4Nsv(GLuint a0, const GLshort *a1)
+	{
 		VertexAttrib4Nsv = reinterpret_cast<PFNVERTEXATTRIB4NSV>(IntGetProcAddress("glVertexAttrib4Nsv"));
-		if(!VertexAttrib4Nsv) ++numFailed;
+		return VertexAttrib4Nsv(a0, a1);
+	}
+	PFNVERTEXATTRIB4NSV VertexAttrib4Nsv = Switch_VertexAttrib4Nsv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4NUB)(GLuint, GLubyte, GLubyte, GLubyte, GLubyte);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4Nub(GLuint a0, GLubyte a1, GLubyte a2, GLubyte a3, GLubyte a4)
+	{
 		VertexAttrib4Nub = reinterpret_cast<PFNVERTEXATTRIB4NUB>(IntGetProcAddress("glVertexAttrib4Nub"));
-		if(!VertexAttrib4Nub) ++numFailed;
+		return VertexAttrib4Nub(a0, a1, a2, a3, a4);
+	}
+	PFNVERTEXATTRIB4NUB VertexAttrib4Nub = Switch_VertexAttrib4Nub;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4NUBV)(GLuint, const GLubyte *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4Nubv(GLuint a0, const GLubyte *a1)
+	{
 		VertexAttrib4Nubv = reinterpret_cast<PFNVERTEXATTRIB4NUBV>(IntGetProcAddress("glVertexAttrib4Nubv"));
-		if(!VertexAttrib4Nubv) ++numFailed;
+		return VertexAttrib4Nubv(a0, a1);
+	}
+	PFNVERTEXATTRIB4NUBV VertexAttrib4Nubv = Switch_VertexAttrib4Nubv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4NUIV)(GLuint, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4Nuiv(GLuint a0, const GLuint *a1)
+	{
 		VertexAttrib4Nuiv = reinterpret_cast<PFNVERTEXATTRIB4NUIV>(IntGetProcAddress("glVertexAttrib4Nuiv"));
-		if(!VertexAttrib4Nuiv) ++numFailed;
+		return VertexAttrib4Nuiv(a0, a1);
+	}
+	PFNVERTEXATTRIB4NUIV VertexAttrib4Nuiv = Switch_VertexAttrib4Nuiv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4NUSV)(GLuint, const GLushort *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4Nusv(GLuint a0, const GLushort *a1)
+	{
 		VertexAttrib4Nusv = reinterpret_cast<PFNVERTEXATTRIB4NUSV>(IntGetProcAddress("glVertexAttrib4Nusv"));
-		if(!VertexAttrib4Nusv) ++numFailed;
+		return VertexAttrib4Nusv(a0, a1);
+	}
+	PFNVERTEXATTRIB4NUSV VertexAttrib4Nusv = Switch_VertexAttrib4Nusv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4BV)(GLuint, const GLbyte *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4bv(GLuint a0, const GLbyte *a1)
+	{
 		VertexAttrib4bv = reinterpret_cast<PFNVERTEXATTRIB4BV>(IntGetProcAddress("glVertexAttrib4bv"));
-		if(!VertexAttrib4bv) ++numFailed;
+		return VertexAttrib4bv(a0, a1);
+	}
+	PFNVERTEXATTRIB4BV VertexAttrib4bv = Switch_VertexAttrib4bv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4D)(GLuint, GLdouble, GLdouble, GLdouble, GLdouble);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4d(GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+	{
 		VertexAttrib4d = reinterpret_cast<PFNVERTEXATTRIB4D>(IntGetProcAddress("glVertexAttrib4d"));
-		if(!VertexAttrib4d) ++numFailed;
+		return VertexAttrib4d(a0, a1, a2, a3, a4);
+	}
+	PFNVERTEXATTRIB4D VertexAttrib4d = Switch_VertexAttrib4d;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4DV)(GLuint, const GLdouble *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4dv(GLuint a0, const GLdouble *a1)
+	{
 		VertexAttrib4dv = reinterpret_cast<PFNVERTEXATTRIB4DV>(IntGetProcAddress("glVertexAttrib4dv"));
-		if(!VertexAttrib4dv) ++numFailed;
+		return VertexAttrib4dv(a0, a1);
+	}
+	PFNVERTEXATTRIB4DV VertexAttrib4dv = Switch_VertexAttrib4dv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4F)(GLuint, GLfloat, GLfloat, GLfloat, GLfloat);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4f(GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+	{
 		VertexAttrib4f = reinterpret_cast<PFNVERTEXATTRIB4F>(IntGetProcAddress("glVertexAttrib4f"));
-		if(!VertexAttrib4f) ++numFailed;
+		return VertexAttrib4f(a0, a1, a2, a3, a4);
+	}
+	PFNVERTEXATTRIB4F VertexAttrib4f = Switch_VertexAttrib4f;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4FV)(GLuint, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4fv(GLuint a0, const GLfloat *a1)
+	{
 		VertexAttrib4fv = reinterpret_cast<PFNVERTEXATTRIB4FV>(IntGetProcAddress("glVertexAttrib4fv"));
-		if(!VertexAttrib4fv) ++numFailed;
+		return VertexAttrib4fv(a0, a1);
+	}
+	PFNVERTEXATTRIB4FV VertexAttrib4fv = Switch_VertexAttrib4fv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4IV)(GLuint, const GLint *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4iv(GLuint a0, const GLint *a1)
+	{
 		VertexAttrib4iv = reinterpret_cast<PFNVERTEXATTRIB4IV>(IntGetProcAddress("glVertexAttrib4iv"));
-		if(!VertexAttrib4iv) ++numFailed;
+		return VertexAttrib4iv(a0, a1);
+	}
+	PFNVERTEXATTRIB4IV VertexAttrib4iv = Switch_VertexAttrib4iv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4S)(GLuint, GLshort, GLshort, GLshort, GLshort);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4s(GLuint a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4)
+	{
 		VertexAttrib4s = reinterpret_cast<PFNVERTEXATTRIB4S>(IntGetProcAddress("glVertexAttrib4s"));
-		if(!VertexAttrib4s) ++numFailed;
+		return VertexAttrib4s(a0, a1, a2, a3, a4);
+	}
+	PFNVERTEXATTRIB4S VertexAttrib4s = Switch_VertexAttrib4s;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4SV)(GLuint, const GLshort *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4sv(GLuint a0, const GLshort *a1)
+	{
 		VertexAttrib4sv = reinterpret_cast<PFNVERTEXATTRIB4SV>(IntGetProcAddress("glVertexAttrib4sv"));
-		if(!VertexAttrib4sv) ++numFailed;
+		return VertexAttrib4sv(a0, a1);
+	}
+	PFNVERTEXATTRIB4SV VertexAttrib4sv = Switch_VertexAttrib4sv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4UBV)(GLuint, const GLubyte *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4ubv(GLuint a0, const GLubyte *a1)
+	{
 		VertexAttrib4ubv = reinterpret_cast<PFNVERTEXATTRIB4UBV>(IntGetProcAddress("glVertexAttrib4ubv"));
-		if(!VertexAttrib4ubv) ++numFailed;
+		return VertexAttrib4ubv(a0, a1);
+	}
+	PFNVERTEXATTRIB4UBV VertexAttrib4ubv = Switch_VertexAttrib4ubv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4UIV)(GLuint, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4uiv(GLuint a0, const GLuint *a1)
+	{
 		VertexAttrib4uiv = reinterpret_cast<PFNVERTEXATTRIB4UIV>(IntGetProcAddress("glVertexAttrib4uiv"));
-		if(!VertexAttrib4uiv) ++numFailed;
+		return VertexAttrib4uiv(a0, a1);
+	}
+	PFNVERTEXATTRIB4UIV VertexAttrib4uiv = Switch_VertexAttrib4uiv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4USV)(GLuint, const GLushort *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4usv(GLuint a0, const GLushort *a1)
+	{
 		VertexAttrib4usv = reinterpret_cast<PFNVERTEXATTRIB4USV>(IntGetProcAddress("glVertexAttrib4usv"));
-		if(!VertexAttrib4usv) ++numFailed;
+		return VertexAttrib4usv(a0, a1);
+	}
+	PFNVERTEXATTRIB4USV VertexAttrib4usv = Switch_VertexAttrib4usv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBPOINTER)(GLuint, GLint, GLenum, GLboolean, GLsizei, const void *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribPointer(GLuint a0, GLint a1, GLenum a2, GLboolean a3, GLsizei a4, const void *a5)
+	{
 		VertexAttribPointer = reinterpret_cast<PFNVERTEXATTRIBPOINTER>(IntGetProcAddress("glVertexAttribPointer"));
-		if(!VertexAttribPointer) ++numFailed;
+		return VertexAttribPointer(a0, a1, a2, a3, a4, a5);
+	}
+	PFNVERTEXATTRIBPOINTER VertexAttribPointer = Switch_VertexAttribPointer;
+	
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX2X3FV)(GLint, GLsizei, GLboolean, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix2x3fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat *a3)
+	{
 		UniformMatrix2x3fv = reinterpret_cast<PFNUNIFORMMATRIX2X3FV>(IntGetProcAddress("glUniformMatrix2x3fv"));
-		if(!UniformMatrix2x3fv) ++numFailed;
+		return UniformMatrix2x3fv(a0, a1, a2, a3);
+	}
+	PFNUNIFORMMATRIX2X3FV UniformMatrix2x3fv = Switch_UniformMatrix2x3fv;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX2X4FV)(GLint, GLsizei, GLboolean, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix2x4fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat *a3)
+	{
 		UniformMatrix2x4fv = reinterpret_cast<PFNUNIFORMMATRIX2X4FV>(IntGetProcAddress("glUniformMatrix2x4fv"));
-		if(!UniformMatrix2x4fv) ++numFailed;
+		return UniformMatrix2x4fv(a0, a1, a2, a3);
+	}
+	PFNUNIFORMMATRIX2X4FV UniformMatrix2x4fv = Switch_UniformMatrix2x4fv;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX3X2FV)(GLint, GLsizei, GLboolean, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix3x2fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat *a3)
+	{
 		UniformMatrix3x2fv = reinterpret_cast<PFNUNIFORMMATRIX3X2FV>(IntGetProcAddress("glUniformMatrix3x2fv"));
-		if(!UniformMatrix3x2fv) ++numFailed;
+		return UniformMatrix3x2fv(a0, a1, a2, a3);
+	}
+	PFNUNIFORMMATRIX3X2FV UniformMatrix3x2fv = Switch_UniformMatrix3x2fv;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX3X4FV)(GLint, GLsizei, GLboolean, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix3x4fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat *a3)
+	{
 		UniformMatrix3x4fv = reinterpret_cast<PFNUNIFORMMATRIX3X4FV>(IntGetProcAddress("glUniformMatrix3x4fv"));
-		if(!UniformMatrix3x4fv) ++numFailed;
+		return UniformMatrix3x4fv(a0, a1, a2, a3);
+	}
+	PFNUNIFORMMATRIX3X4FV UniformMatrix3x4fv = Switch_UniformMatrix3x4fv;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX4X2FV)(GLint, GLsizei, GLboolean, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix4x2fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat *a3)
+	{
 		UniformMatrix4x2fv = reinterpret_cast<PFNUNIFORMMATRIX4X2FV>(IntGetProcAddress("glUniformMatrix4x2fv"));
-		if(!UniformMatrix4x2fv) ++numFailed;
+		return UniformMatrix4x2fv(a0, a1, a2, a3);
+	}
+	PFNUNIFORMMATRIX4X2FV UniformMatrix4x2fv = Switch_UniformMatrix4x2fv;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX4X3FV)(GLint, GLsizei, GLboolean, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix4x3fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat *a3)
+	{
 		UniformMatrix4x3fv = reinterpret_cast<PFNUNIFORMMATRIX4X3FV>(IntGetProcAddress("glUniformMatrix4x3fv"));
-		if(!UniformMatrix4x3fv) ++numFailed;
+		return UniformMatrix4x3fv(a0, a1, a2, a3);
+	}
+	PFNUNIFORMMATRIX4X3FV UniformMatrix4x3fv = Switch_UniformMatrix4x3fv;
+	
+	typedef void (CODEGEN_FUNCPTR *PFNBEGINCONDITIONALRENDER)(GLuint, GLenum);
+	static void CODEGEN_FUNCPTR Switch_BeginConditionalRender(GLuint a0, GLenum a1)
+	{
 		BeginConditionalRender = reinterpret_cast<PFNBEGINCONDITIONALRENDER>(IntGetProcAddress("glBeginConditionalRender"));
-		if(!BeginConditionalRender) ++numFailed;
+		return BeginConditionalRender(a0, a1);
+	}
+	PFNBEGINCONDITIONALRENDER BeginConditionalRender = Switch_BeginConditionalRender;
+	typedef void (CODEGEN_FUNCPTR *PFNBEGINTRANSFORMFEEDBACK)(GLenum);
+	static void CODEGEN_FUNCPTR Switch_BeginTransformFeedback(GLenum a0)
+	{
 		BeginTransformFeedback = reinterpret_cast<PFNBEGINTRANSFORMFEEDBACK>(IntGetProcAddress("glBeginTransformFeedback"));
-		if(!BeginTransformFeedback) ++numFailed;
+		return BeginTransformFeedback(a0);
+	}
+	PFNBEGINTRANSFORMFEEDBACK BeginTransformFeedback = Switch_BeginTransformFeedback;
+	typedef void (CODEGEN_FUNCPTR *PFNBINDBUFFERBASE)(GLenum, GLuint, GLuint);
+	static void CODEGEN_FUNCPTR Switch_BindBufferBase(GLenum a0, GLuint a1, GLuint a2)
+	{
 		BindBufferBase = reinterpret_cast<PFNBINDBUFFERBASE>(IntGetProcAddress("glBindBufferBase"));
-		if(!BindBufferBase) ++numFailed;
+		return BindBufferBase(a0, a1, a2);
+	}
+	PFNBINDBUFFERBASE BindBufferBase = Switch_BindBufferBase;
+	typedef void (CODEGEN_FUNCPTR *PFNBINDBUFFERRANGE)(GLenum, GLuint, GLuint, GLintptr, GLsizeiptr);
+	static void CODEGEN_FUNCPTR Switch_BindBufferRange(GLenum a0, GLuint a1, GLuint a2, GLintptr a3, GLsizeiptr a4)
+	{
 		BindBufferRange = reinterpret_cast<PFNBINDBUFFERRANGE>(IntGetProcAddress("glBindBufferRange"));
-		if(!BindBufferRange) ++numFailed;
+		return BindBufferRange(a0, a1, a2, a3, a4);
+	}
+	PFNBINDBUFFERRANGE BindBufferRange = Switch_BindBufferRange;
+	typedef void (CODEGEN_FUNCPTR *PFNBINDFRAGDATALOCATION)(GLuint, GLuint, const GLchar *);
+	static void CODEGEN_FUNCPTR Switch_BindFragDataLocation(GLuint a0, GLuint a1, const GLchar *a2)
+	{
 		BindFragDataLocation = reinterpret_cast<PFNBINDFRAGDATALOCATION>(IntGetProcAddress("glBindFragDataLocation"));
-		if(!BindFragDataLocation) ++numFailed;
+		return BindFragDataLocation(a0, a1, a2);
+	}
+	PFNBINDFRAGDATALOCATION BindFragDataLocation = Switch_BindFragDataLocation;
+	typedef void (CODEGEN_FUNCPTR *PFNBINDFRAMEBUFFER)(GLenum, GLuint);
+	static void CODEGEN_FUNCPTR Switch_BindFramebuffer(GLenum a0, GLuint a1)
+	{
 		BindFramebuffer = reinterpret_cast<PFNBINDFRAMEBUFFER>(IntGetProcAddress("glBindFramebuffer"));
-		if(!BindFramebuffer) ++numFailed;
+		return BindFramebuffer(a0, a1);
+	}
+	PFNBINDFRAMEBUFFER BindFramebuffer = Switch_BindFramebuffer;
+	typedef void (CODEGEN_FUNCPTR *PFNBINDRENDERBUFFER)(GLenum, GLuint);
+	static void CODEGEN_FUNCPTR Switch_BindRenderbuffer(GLenum a0, GLuint a1)
+	{
 		BindRenderbuffer = reinterpret_cast<PFNBINDRENDERBUFFER>(IntGetProcAddress("glBindRenderbuffer"));
-		if(!BindRenderbuffer) ++numFailed;
+		return BindRenderbuffer(a0, a1);
+	}
+	PFNBINDRENDERBUFFER BindRenderbuffer = Switch_BindRenderbuffer;
+	typedef void (CODEGEN_FUNCPTR *PFNBINDVERTEXARRAY)(GLuint);
+	static void CODEGEN_FUNCPTR Switch_BindVertexArray(GLuint a0)
+	{
 		BindVertexArray = reinterpret_cast<PFNBINDVERTEXARRAY>(IntGetProcAddress("glBindVertexArray"));
-		if(!BindVertexArray) ++numFailed;
+		return BindVertexArray(a0);
+	}
+	PFNBINDVERTEXARRAY BindVertexArray = Switch_BindVertexArray;
+	typedef void (CODEGEN_FUNCPTR *PFNBLITFRAMEBUFFER)(GLint, GLint, GLint, GLint, GLint, GLint, GLint, GLint, GLbitfield, GLenum);
+	static void CODEGEN_FUNCPTR Switch_BlitFramebuffer(GLint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLbitfield a8, GLenum a9)
+	{
 		BlitFramebuffer = reinterpret_cast<PFNBLITFRAMEBUFFER>(IntGetProcAddress("glBlitFramebuffer"));
-		if(!BlitFramebuffer) ++numFailed;
+		return BlitFramebuffer(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+	}
+	PFNBLITFRAMEBUFFER BlitFramebuffer = Switch_BlitFramebuffer;
+	typedef GLenum (CODEGEN_FUNCPTR *PFNCHECKFRAMEBUFFERSTATUS)(GLenum);
+	static GLenum CODEGEN_FUNCPTR Switch_CheckFramebufferStatus(GLenum a0)
+	{
 		CheckFramebufferStatus = reinterpret_cast<PFNCHECKFRAMEBUFFERSTATUS>(IntGetProcAddress("glCheckFramebufferStatus"));
-		if(!CheckFramebufferStatus) ++numFailed;
+		return CheckFramebufferStatus(a0);
+	}
+	PFNCHECKFRAMEBUFFERSTATUS CheckFramebufferStatus = Switch_CheckFramebufferStatus;
+	typedef void (CODEGEN_FUNCPTR *PFNCLAMPCOLOR)(GLenum, GLenum);
+	static void CODEGEN_FUNCPTR Switch_ClampColor(GLenum a0, GLenum a1)
+	{
 		ClampColor = reinterpret_cast<PFNCLAMPCOLOR>(IntGetProcAddress("glClampColor"));
-		if(!ClampColor) ++numFailed;
+		return ClampColor(a0, a1);
+	}
+	PFNCLAMPCOLOR ClampColor = Switch_ClampColor;
+	typedef void (CODEGEN_FUNCPTR *PFNCLEARBUFFERFI)(GLenum, GLint, GLfloat, GLint);
+	static void CODEGEN_FUNCPTR Switch_ClearBufferfi(GLenum a0, GLint a1, GLfloat a2, GLint a3)
+	{
 		ClearBufferfi = reinterpret_cast<PFNCLEARBUFFERFI>(IntGetProcAddress("glClearBufferfi"));
-		if(!ClearBufferfi) ++numFailed;
+		return ClearBufferfi(a0, a1, a2, a3);
+	}
+	PFNCLEARBUFFERFI ClearBufferfi = Switch_ClearBufferfi;
+	typedef void (CODEGEN_FUNCPTR *PFNCLEARBUFFERFV)(GLenum, GLint, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_ClearBufferfv(GLenum a0, GLint a1, const GLfloat *a2)
+	{
 		ClearBufferfv = reinterpret_cast<PFNCLEARBUFFERFV>(IntGetProcAddress("glClearBufferfv"));
-		if(!ClearBufferfv) ++numFailed;
+		return ClearBufferfv(a0, a1, a2);
+	}
+	PFNCLEARBUFFERFV ClearBufferfv = Switch_ClearBufferfv;
+	typedef void (CODEGEN_FUNCPTR *PFNCLEARBUFFERIV)(GLenum, GLint, const GLint *);
+	static void CODEGEN_FUNCPTR Switch_ClearBufferiv(GLenum a0, GLint a1, const GLint *a2)
+	{
 		ClearBufferiv = reinterpret_cast<PFNCLEARBUFFERIV>(IntGetProcAddress("glClearBufferiv"));
-		if(!ClearBufferiv) ++numFailed;
+		return ClearBufferiv(a0, a1, a2);
+	}
+	PFNCLEARBUFFERIV ClearBufferiv = Switch_ClearBufferiv;
+	typedef void (CODEGEN_FUNCPTR *PFNCLEARBUFFERUIV)(GLenum, GLint, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_ClearBufferuiv(GLenum a0, GLint a1, const GLuint *a2)
+	{
 		ClearBufferuiv = reinterpret_cast<PFNCLEARBUFFERUIV>(IntGetProcAddress("glClearBufferuiv"));
-		if(!ClearBufferuiv) ++numFailed;
+		return ClearBufferuiv(a0, a1, a2);
+	}
+	PFNCLEARBUFFERUIV ClearBufferuiv = Switch_ClearBufferuiv;
+	typedef void (CODEGEN_FUNCPTR *PFNCOLORMASKI)(GLuint, GLboolean, GLboolean, GLboolean, GLboolean);
+	static void CODEGEN_FUNCPTR Switch_ColorMaski(GLuint a0, GLboolean a1, GLboolean a2, GLboolean a3, GLboolean a4)
+	{
 		ColorMaski = reinterpret_cast<PFNCOLORMASKI>(IntGetProcAddress("glColorMaski"));
-		if(!ColorMaski) ++numFailed;
+		return ColorMaski(a0, a1, a2, a3, a4);
+	}
+	PFNCOLORMASKI ColorMaski = Switch_ColorMaski;
+	typedef void (CODEGEN_FUNCPTR *PFNDELETEFRAMEBUFFERS)(GLsizei, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_DeleteFramebuffers(GLsizei a0, const GLuint *a1)
+	{
 		DeleteFramebuffers = reinterpret_cast<PFNDELETEFRAMEBUFFERS>(IntGetProcAddress("glDeleteFramebuffers"));
-		if(!DeleteFramebuffers) ++numFailed;
+		return DeleteFramebuffers(a0, a1);
+	}
+	PFNDELETEFRAMEBUFFERS DeleteFramebuffers = Switch_DeleteFramebuffers;
+	typedef void (CODEGEN_FUNCPTR *PFNDELETERENDERBUFFERS)(GLsizei, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_DeleteRenderbuffers(GLsizei a0, const GLuint *a1)
+	{
 		DeleteRenderbuffers = reinterpret_cast<PFNDELETERENDERBUFFERS>(IntGetProcAddress("glDeleteRenderbuffers"));
-		if(!DeleteRenderbuffers) ++numFailed;
+		return DeleteRenderbuffers(a0, a1);
+	}
+	PFNDELETERENDERBUFFERS DeleteRenderbuffers = Switch_DeleteRenderbuffers;
+	typedef void (CODEGEN_FUNCPTR *PFNDELETEVERTEXARRAYS)(GLsizei, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_DeleteVertexArrays(GLsizei a0, const GLuint *a1)
+	{
 		DeleteVertexArrays = reinterpret_cast<PFNDELETEVERTEXARRAYS>(IntGetProcAddress("glDeleteVertexArrays"));
-		if(!DeleteVertexArrays) ++numFailed;
+		return DeleteVertexArrays(a0, a1);
+	}
+	PFNDELETEVERTEXARRAYS DeleteVertexArrays = Switch_DeleteVertexArrays;
+	typedef void (CODEGEN_FUNCPTR *PFNDISABLEI)(GLenum, GLuint);
+	static void CODEGEN_FUNCPTR Switch_Disablei(GLenum a0, GLuint a1)
+	{
 		Disablei = reinterpret_cast<PFNDISABLEI>(IntGetProcAddress("glDisablei"));
-		if(!Disablei) ++numFailed;
+		return Disablei(a0, a1);
+	}
+	PFNDISABLEI Disablei = Switch_Disablei;
+	typedef void (CODEGEN_FUNCPTR *PFNENABLEI)(GLenum, GLuint);
+	static void CODEGEN_FUNCPTR Switch_Enablei(GLenum a0, GLuint a1)
+	{
 		Enablei = reinterpret_cast<PFNENABLEI>(IntGetProcAddress("glEnablei"));
-		if(!Enablei) ++numFailed;
+		return Enablei(a0, a1);
+	}
+	PFNENABLEI Enablei = Switch_Enablei;
+	typedef void (CODEGEN_FUNCPTR *PFNENDCONDITIONALRENDER)(void);
+	static void CODEGEN_FUNCPTR Switch_EndConditionalRender(void)
+	{
 		EndConditionalRender = reinterpret_cast<PFNENDCONDITIONALRENDER>(IntGetProcAddress("glEndConditionalRender"));
-		if(!EndConditionalRender) ++numFailed;
+		return EndConditionalRender();
+	}
+	PFNENDCONDITIONALRENDER EndConditionalRender = Switch_EndConditionalRender;
+	typedef void (CODEGEN_FUNCPTR *PFNENDTRANSFORMFEEDBACK)(void);
+	static void CODEGEN_FUNCPTR Switch_EndTransformFeedback(void)
+	{
 		EndTransformFeedback = reinterpret_cast<PFNENDTRANSFORMFEEDBACK>(IntGetProcAddress("glEndTransformFeedback"));
-		if(!EndTransformFeedback) ++numFailed;
+		return EndTransformFeedback();
+	}
+	PFNENDTRANSFORMFEEDBACK EndTransformFeedback = Switch_EndTransformFeedback;
+	typedef void (CODEGEN_FUNCPTR *PFNFLUSHMAPPEDBUFFERRANGE)(GLenum, GLintptr, GLsizeiptr);
+	static void CODEGEN_FUNCPTR Switch_FlushMappedBufferRange(GLenum a0, GLintptr a1, GLsizeiptr a2)
+	{
 		FlushMappedBufferRange = reinterpret_cast<PFNFLUSHMAPPEDBUFFERRANGE>(IntGetProcAddress("glFlushMappedBufferRange"));
-		if(!FlushMappedBufferRange) ++numFailed;
+		return FlushMappedBufferRange(a0, a1, a2);
+	}
+	PFNFLUSHMAPPEDBUFFERRANGE FlushMappedBufferRange = Switch_FlushMappedBufferRange;
+	typedef void (CODEGEN_FUNCPTR *PFNFRAMEBUFFERRENDERBUFFER)(GLenum, GLenum, GLenum, GLuint);
+	static void CODEGEN_FUNCPTR Switch_FramebufferRenderbuffer(GLenum a0, GLenum a1, GLenum a2, GLuint a3)
+	{
 		FramebufferRenderbuffer = reinterpret_cast<PFNFRAMEBUFFERRENDERBUFFER>(IntGetProcAddress("glFramebufferRenderbuffer"));
-		if(!FramebufferRenderbuffer) ++numFailed;
+		return FramebufferRenderbuffer(a0, a1, a2, a3);
+	}
+	PFNFRAMEBUFFERRENDERBUFFER FramebufferRenderbuffer = Switch_FramebufferRenderbuffer;
+	typedef void (CODEGEN_FUNCPTR *PFNFRAMEBUFFERTEXTURE1D)(GLenum, GLenum, GLenum, GLuint, GLint);
+	static void CODEGEN_FUNCPTR Switch_FramebufferTexture1D(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4)
+	{
 		FramebufferTexture1D = reinterpret_cast<PFNFRAMEBUFFERTEXTURE1D>(IntGetProcAddress("glFramebufferTexture1D"));
-		if(!FramebufferTexture1D) ++numFailed;
+		return FramebufferTexture1D(a0, a1, a2, a3, a4);
+	}
+	PFNFRAMEBUFFERTEXTURE1D FramebufferTexture1D = Switch_FramebufferTexture1D;
+	typedef void (CODEGEN_FUNCPTR *PFNFRAMEBUFFERTEXTURE2D)(GLenum, GLenum, GLenum, GLuint, GLint);
+	static void CODEGEN_FUNCPTR Switch_FramebufferTexture2D(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4)
+	{
 		FramebufferTexture2D = reinterpret_cast<PFNFRAMEBUFFERTEXTURE2D>(IntGetProcAddress("glFramebufferTexture2D"));
-		if(!FramebufferTexture2D) ++numFailed;
+		return FramebufferTexture2D(a0, a1, a2, a3, a4);
+	}
+	PFNFRAMEBUFFERTEXTURE2D FramebufferTexture2D = Switch_FramebufferTexture2D;
+	typedef void (CODEGEN_FUNCPTR *PFNFRAMEBUFFERTEXTURE3D)(GLenum, GLenum, GLenum, GLuint, GLint, GLint);
+	static void CODEGEN_FUNCPTR Switch_FramebufferTexture3D(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLint a5)
+	{
 		FramebufferTexture3D = reinterpret_cast<PFNFRAMEBUFFERTEXTURE3D>(IntGetProcAddress("glFramebufferTexture3D"));
-		if(!FramebufferTexture3D) ++numFailed;
+		return FramebufferTexture3D(a0, a1, a2, a3, a4, a5);
+	}
+	PFNFRAMEBUFFERTEXTURE3D FramebufferTexture3D = Switch_FramebufferTexture3D;
+	typedef void (CODEGEN_FUNCPTR *PFNFRAMEBUFFERTEXTURELAYER)(GLenum, GLenum, GLuint, GLint, GLint);
+	static void CODEGEN_FUNCPTR Switch_FramebufferTextureLayer(GLenum a0, GLenum a1, GLuint a2, GLint a3, GLint a4)
+	{
 		FramebufferTextureLayer = reinterpret_cast<PFNFRAMEBUFFERTEXTURELAYER>(IntGetProcAddress("glFramebufferTextureLayer"));
-		if(!FramebufferTextureLayer) ++numFailed;
+		return FramebufferTextureLayer(a0, a1, a2, a3, a4);
+	}
+	PFNFRAMEBUFFERTEXTURELAYER FramebufferTextureLayer = Switch_FramebufferTextureLayer;
+	typedef void (CODEGEN_FUNCPTR *PFNGENFRAMEBUFFERS)(GLsizei, GLuint *);
+	static void CODEGEN_FUNCPTR Switch_GenFramebuffers(GLsizei a0, GLuint *a1)
+	{
 		GenFramebuffers = reinterpret_cast<PFNGENFRAMEBUFFERS>(IntGetProcAddress("glGenFramebuffers"));
-		if(!GenFramebuffers) ++numFailed;
+		return GenFramebuffers(a0, a1);
+	}
+	PFNGENFRAMEBUFFERS GenFramebuffers = Switch_GenFramebuffers;
+	typedef void (CODEGEN_FUNCPTR *PFNGENRENDERBUFFERS)(GLsizei, GLuint *);
+	static void CODEGEN_FUNCPTR Switch_GenRenderbuffers(GLsizei a0, GLuint *a1)
+	{
 		GenRenderbuffers = reinterpret_cast<PFNGENRENDERBUFFERS>(IntGetProcAddress("glGenRenderbuffers"));
-		if(!GenRenderbuffers) ++numFailed;
+		return GenRenderbuffers(a0, a1);
+	}
+	PFNGENRENDERBUFFERS GenRenderbuffers = Switch_GenRenderbuffers;
+	typedef void (CODEGEN_FUNCPTR *PFNGENVERTEXARRAYS)(GLsizei, GLuint *);
+	static void CODEGEN_FUNCPTR Switch_GenVertexArrays(GLsizei a0, GLuint *a1)
+	{
 		GenVertexArrays = reinterpret_cast<PFNGENVERTEXARRAYS>(IntGetProcAddress("glGenVertexArrays"));
-		if(!GenVertexArrays) ++numFailed;
+		return GenVertexArrays(a0, a1);
+	}
+	PFNGENVERTEXARRAYS GenVertexArrays = Switch_GenVertexArrays;
+	typedef void (CODEGEN_FUNCPTR *PFNGENERATEMIPMAP)(GLenum);
+	static void CODEGEN_FUNCPTR Switch_GenerateMipmap(GLenum a0)
+	{
 		GenerateMipmap = reinterpret_cast<PFNGENERATEMIPMAP>(IntGetProcAddress("glGenerateMipmap"));
-		if(!GenerateMipmap) ++numFailed;
+		return GenerateMipmap(a0);
+	}
+	PFNGENERATEMIPMAP GenerateMipmap = Switch_GenerateMipmap;
+	typedef void (CODEGEN_FUNCPTR *PFNGETBOOLEANI_V)(GLenum, GLuint, GLboolean *);
+	static void CODEGEN_FUNCPTR Switch_GetBooleani_v(GLenum a0, GLuint a1, GLboolean *a2)
+	{
 		GetBooleani_v = reinterpret_cast<PFNGETBOOLEANI_V>(IntGetProcAddress("glGetBooleani_v"));
-		if(!GetBooleani_v) ++numFailed;
+		return GetBooleani_v(a0, a1, a2);
+	}
+	PFNGETBOOLEANI_V GetBooleani_v = Switch_GetBooleani_v;
+	typedef GLint (CODEGEN_FUNCPTR *PFNGETFRAGDATALOCATION)(GLuint, const GLchar *);
+	static GLint CODEGEN_FUNCPTR Switch_GetFragDataLocation(GLuint a0, const GLchar *a1)
+	{
 		GetFragDataLocation = reinterpret_cast<PFNGETFRAGDATALOCATION>(IntGetProcAddress("glGetFragDataLocation"));
-		if(!GetFragDataLocation) ++numFailed;
+		return GetFragDataLocation(a0, a1);
+	}
+	PFNGETFRAGDATALOCATION GetFragDataLocation = Switch_GetFragDataLocation;
+	typedef void (CODEGEN_FUNCPTR *PFNGETFRAMEBUFFERATTACHMENTPARAMETERIV)(GLenum, GLenum, GLenum, GLint *);
+	static void CODEGEN_FUNCPTR Switch_GetFramebufferAttachmentParameteriv(GLenum a0, GLenum a1, GLenum a2, GLint *a3)
+	{
 		GetFramebufferAttachmentParameteriv = reinterpret_cast<PFNGETFRAMEBUFFERATTACHMENTPARAMETERIV>(IntGetProcAddress("glGetFramebufferAttachmentParameteriv"));
-		if(!GetFramebufferAttachmentParameteriv) ++numFailed;
+		return GetFramebufferAttachmentParameteriv(a0, a1, a2, a3);
+	}
+	PFNGETFRAMEBUFFERATTACHMENTPARAMETERIV GetFramebufferAttachmentParameteriv = Switch_GetFramebufferAttachmentParameteriv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETINTEGERI_V)(GLenum, GLuint, GLint *);
+	static void CODEGEN_FUNCPTR Switch_GetIntegeri_v(GLenum a0, GLuint a1, GLint *a2)
+	{
 		GetIntegeri_v = reinterpret_cast<PFNGETINTEGERI_V>(IntGetProcAddress("glGetIntegeri_v"));
-		if(!GetIntegeri_v) ++numFailed;
+		return GetIntegeri_v(a0, a1, a2);
+	}
+	PFNGETINTEGERI_V GetIntegeri_v = Switch_GetIntegeri_v;
+	typedef void (CODEGEN_FUNCPTR *PFNGETRENDERBUFFERPARAMETERIV)(GLenum, GLenum, GLint *);
+	static void CODEGEN_FUNCPTR Switch_GetRenderbufferParameteriv(GLenum a0, GLenum a1, GLint *a2)
+	{
 		GetRenderbufferParameteriv = reinterpret_cast<PFNGETRENDERBUFFERPARAMETERIV>(IntGetProcAddress("glGetRenderbufferParameteriv"));
-		if(!GetRenderbufferParameteriv) ++numFailed;
+		return GetRenderbufferParameteriv(a0, a1, a2);
+	}
+	PFNGETRENDERBUFFERPARAMETERIV GetRenderbufferParameteriv = Switch_GetRenderbufferParameteriv;
+	typedef const GLubyte * (CODEGEN_FUNCPTR *PFNGETSTRINGI)(GLenum, GLuint);
+	static const GLubyte * CODEGEN_FUNCPTR Switch_GetStringi(GLenum a0, GLuint a1)
+	{
 		GetStringi = reinterpret_cast<PFNGETSTRINGI>(IntGetProcAddress("glGetStringi"));
-		if(!GetStringi) ++numFailed;
+		return GetStringi(a0, a1);
+	}
+	PFNGETSTRINGI GetStringi = Switch_GetStringi;
+	typedef void (CODEGEN_FUNCPTR *PFNGETTEXPARAMETERIIV)(GLenum, GLenum, GLint *);
+	static void CODEGEN_FUNCPTR Switch_GetTexParameterIiv(GLenum a0, GLenum a1, GLint *a2)
+	{
 		GetTexParameterIiv = reinterpret_cast<PFNGETTEXPARAMETERIIV>(IntGetProcAddress("glGetTexParameterIiv"));
-		if(!GetTexParameterIiv) ++numFailed;
+		return GetTexParameterIiv(a0, a1, a2);
+	}
+	PFNGETTEXPARAMETERIIV GetTexParameterIiv = Switch_GetTexParameterIiv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETTEXPARAMETERIUIV)(GLenum, GLenum, GLuint *);
+	static void CODEGEN_FUNCPTR Switch_GetTexParameterIuiv(GLenum a0, GLenum a1, GLuint *a2)
+	{
 		GetTexParameterIuiv = reinterpret_cast<PFNGETTEXPARAMETERIUIV>(IntGetProcAddress("glGetTexParameterIuiv"));
-		if(!GetTexParameterIuiv) ++numFailed;
+		return GetTexParameterIuiv(a0, a1, a2);
+	}
+	PFNGETTEXPARAMETERIUIV GetTexParameterIuiv = Switch_GetTexParameterIuiv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETTRANSFORMFEEDBACKVARYING)(GLuint, GLuint, GLsizei, GLsizei *, GLsizei *, GLenum *, GLchar *);
+	static void CODEGEN_FUNCPTR Switch_GetTransformFeedbackVarying(GLuint a0, GLuint a1, GLsizei a2, GLsizei *a3, GLsizei *a4, GLenum *a5, GLchar *a6)
+	{
 		GetTransformFeedbackVarying = reinterpret_cast<PFNGETTRANSFORMFEEDBACKVARYING>(IntGetProcAddress("glGetTransformFeedbackVarying"));
-		if(!GetTransformFeedbackVarying) ++numFailed;
+		return GetTransformFeedbackVarying(a0, a1, a2, a3, a4, a5, a6);
+	}
+	PFNGETTRANSFORMFEEDBACKVARYING GetTransformFeedbackVarying = Switch_GetTransformFeedbackVarying;
+	typedef void (CODEGEN_FUNCPTR *PFNGETUNIFORMUIV)(GLuint, GLint, GLuint *);
+	static void CODEGEN_FUNCPTR Switch_GetUniformuiv(GLuint a0, GLint a1, GLuint *a2)
+	{
 		GetUniformuiv = reinterpret_cast<PFNGETUNIFORMUIV>(IntGetProcAddress("glGetUniformuiv"));
-		if(!GetUniformuiv) ++numFailed;
+		return GetUniformuiv(a0, a1, a2);
+	}
+	PFNGETUNIFORMUIV GetUniformuiv = Switch_GetUniformuiv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETVERTEXATTRIBIIV)(GLuint, GLenum, GLint *);
+	static void CODEGEN_FUNCPTR Switch_GetVertexAttribIiv(GLuint a0, GLenum a1, GLint *a2)
+	{
 		GetVertexAttribIiv = reinterpret_cast<PFNGETVERTEXATTRIBIIV>(IntGetProcAddress("glGetVertexAttribIiv"));
-		if(!GetVertexAttribIiv) ++numFailed;
+		return GetVertexAttribIiv(a0, a1, a2);
+	}
+	PFNGETVERTEXATTRIBIIV GetVertexAttribIiv = Switch_GetVertexAttribIiv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETVERTEXATTRIBIUIV)(GLuint, GLenum, GLuint *);
+	static void CODEGEN_FUNCPTR Switch_GetVertexAttribIuiv(GLuint a0, GLenum a1, GLuint *a2)
+	{
 		GetVertexAttribIuiv = reinterpret_cast<PFNGETVERTEXATTRIBIUIV>(IntGetProcAddress("glGetVertexAttribIuiv"));
-		if(!GetVertexAttribIuiv) ++numFailed;
+		return GetVertexAttribIuiv(a0, a1, a2);
+	}
+	PFNGETVERTEXATTRIBIUIV GetVertexAttribIuiv = Switch_GetVertexAttribIuiv;
+	typedef GLboolean (CODEGEN_FUNCPTR *PFNISENABLEDI)(GLenum, GLuint);
+	static GLboolean CODEGEN_FUNCPTR Switch_IsEnabledi(GLenum a0, GLuint a1)
+	{
 		IsEnabledi = reinterpret_cast<PFNISENABLEDI>(IntGetProcAddress("glIsEnabledi"));
-		if(!IsEnabledi) ++numFailed;
+		return IsEnabledi(a0, a1);
+	}
+	PFNISENABLEDI IsEnabledi = Switch_IsEnabledi;
+	typedef GLboolean (CODEGEN_FUNCPTR *PFNISFRAMEBUFFER)(GLuint);
+	static GLboolean CODEGEN_FUNCPTR Switch_IsFramebuffer(GLuint a0)
+	{
 		IsFramebuffer = reinterpret_cast<PFNISFRAMEBUFFER>(IntGetProcAddress("glIsFramebuffer"));
-		if(!IsFramebuffer) ++numFailed;
+		return IsFramebuffer(a0);
+	}
+	PFNISFRAMEBUFFER IsFramebuffer = Switch_IsFramebuffer;
+	typedef GLboolean (CODEGEN_FUNCPTR *PFNISRENDERBUFFER)(GLuint);
+	static GLboolean CODEGEN_FUNCPTR Switch_IsRenderbuffer(GLuint a0)
+	{
 		IsRenderbuffer = reinterpret_cast<PFNISRENDERBUFFER>(IntGetProcAddress("glIsRenderbuffer"));
-		if(!IsRenderbuffer) ++numFailed;
+		return IsRenderbuffer(a0);
+	}
+	PFNISRENDERBUFFER IsRenderbuffer = Switch_IsRenderbuffer;
+	typedef GLboolean (CODEGEN_FUNCPTR *PFNISVERTEXARRAY)(GLuint);
+	static GLboolean CODEGEN_FUNCPTR Switch_IsVertexArray(GLuint a0)
+	{
 		IsVertexArray = reinterpret_cast<PFNISVERTEXARRAY>(IntGetProcAddress("glIsVertexArray"));
-		if(!IsVertexArray) ++numFailed;
+		return IsVertexArray(a0);
+	}
+	PFNISVERTEXARRAY IsVertexArray = Switch_IsVertexArray;
+	typedef void * (CODEGEN_FUNCPTR *PFNMAPBUFFERRANGE)(GLenum, GLintptr, GLsizeiptr, GLbitfield);
+	static void * CODEGEN_FUNCPTR Switch_MapBufferRange(GLenum a0, GLintptr a1, GLsizeiptr a2, GLbitfield a3)
+	{
 		MapBufferRange = reinterpret_cast<PFNMAPBUFFERRANGE>(IntGetProcAddress("glMapBufferRange"));
-		if(!MapBufferRange) ++numFailed;
+		return MapBufferRange(a0, a1, a2, a3);
+	}
+	PFNMAPBUFFERRANGE MapBufferRange = Switch_MapBufferRange;
+	typedef void (CODEGEN_FUNCPTR *PFNRENDERBUFFERSTORAGE)(GLenum, GLenum, GLsizei, GLsizei);
+	static void CODEGEN_FUNCPTR Switch_RenderbufferStorage(GLenum a0, GLenum a1, GLsizei a2, GLsizei a3)
+	{
 		RenderbufferStorage = reinterpret_cast<PFNRENDERBUFFERSTORAGE>(IntGetProcAddress("glRenderbufferStorage"));
-		if(!RenderbufferStorage) ++numFailed;
+		return RenderbufferStorage(a0, a1, a2, a3);
+	}
+	PFNRENDERBUFFERSTORAGE RenderbufferStorage = Switch_RenderbufferStorage;
+	typedef void (CODEGEN_FUNCPTR *PFNRENDERBUFFERSTORAGEMULTISAMPLE)(GLenum, GLsizei, GLenum, GLsizei, GLsizei);
+	static void CODEGEN_FUNCPTR Switch_RenderbufferStorageMultisample(GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+	{
 		RenderbufferStorageMultisample = reinterpret_cast<PFNRENDERBUFFERSTORAGEMULTISAMPLE>(IntGetProcAddress("glRenderbufferStorageMultisample"));
-		if(!RenderbufferStorageMultisample) ++numFailed;
+		return RenderbufferStorageMultisample(a0, a1, a2, a3, a4);
+	}
+	PFNRENDERBUFFERSTORAGEMULTISAMPLE RenderbufferStorageMultisample = Switch_RenderbufferStorageMultisample;
+	typedef void (CODEGEN_FUNCPTR *PFNTEXPARAMETERIIV)(GLenum, GLenum, const GLint *);
+	static void CODEGEN_FUNCPTR Switch_TexParameterIiv(GLenum a0, GLenum a1, const GLint *a2)
+	{
 		TexParameterIiv = reinterpret_cast<PFNTEXPARAMETERIIV>(IntGetProcAddress("glTexParameterIiv"));
-		if(!TexParameterIiv) ++numFailed;
+		return TexParameterIiv(a0, a1, a2);
+	}
+	PFNTEXPARAMETERIIV TexParameterIiv = Switch_TexParameterIiv;
+	typedef void (CODEGEN_FUNCPTR *PFNTEXPARAMETERIUIV)(GLenum, GLenum, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_TexParameterIuiv(GLenum a0, GLenum a1, const GLuint *a2)
+	{
 		TexParameterIuiv = reinterpret_cast<PFNTEXPARAMETERIUIV>(IntGetProcAddress("glTexParameterIuiv"));
-		if(!TexParameterIuiv) ++numFailed;
+		return TexParameterIuiv(a0, a1, a2);
+	}
+	PFNTEXPARAMETERIUIV TexParameterIuiv = Switch_TexParameterIuiv;
+	typedef void (CODEGEN_FUNCPTR *PFNTRANSFORMFEEDBACKVARYINGS)(GLuint, GLsizei, const GLchar *const*, GLenum);
+	static void CODEGEN_FUNCPTR Switch_TransformFeedbackVaryings(GLuint a0, GLsizei a1, const GLchar *const*a2, GLenum a3)
+	{
 		TransformFeedbackVaryings = reinterpret_cast<PFNTRANSFORMFEEDBACKVARYINGS>(IntGetProcAddress("glTransformFeedbackVaryings"));
-		if(!TransformFeedbackVaryings) ++numFailed;
+		return TransformFeedbackVaryings(a0, a1, a2, a3);
+	}
+	PFNTRANSFORMFEEDBACKVARYINGS TransformFeedbackVaryings = Switch_TransformFeedbackVaryings;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM1UI)(GLint, GLuint);
+	static void CODEGEN_FUNCPTR Switch_Uniform1ui(GLint a0, GLuint a1)
+	{
 		Uniform1ui = reinterpret_cast<PFNUNIFORM1UI>(IntGetProcAddress("glUniform1ui"));
-		if(!Uniform1ui) ++numFailed;
+		return Uniform1ui(a0, a1);
+	}
+	PFNUNIFORM1UI Uniform1ui = Switch_Uniform1ui;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM1UIV)(GLint, GLsizei, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_Uniform1uiv(GLint a0, GLsizei a1, const GLuint *a2)
+	{
 		Uniform1uiv = reinterpret_cast<PFNUNIFORM1UIV>(IntGetProcAddress("glUniform1uiv"));
-		if(!Uniform1uiv) ++numFailed;
+		return Uniform1uiv(a0, a1, a2);
+	}
+	PFNUNIFORM1UIV Uniform1uiv = Switch_Uniform1uiv;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM2UI)(GLint, GLuint, GLuint);
+	static void CODEGEN_FUNCPTR Switch_Uniform2ui(GLint a0, GLuint a1, GLuint a2)
+	{
 		Uniform2ui = reinterpret_cast<PFNUNIFORM2UI>(IntGetProcAddress("glUniform2ui"));
-		if(!Uniform2ui) ++numFailed;
+		return Uniform2ui(a0, a1, a2);
+	}
+	PFNUNIFORM2UI Uniform2ui = Switch_Uniform2ui;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM2UIV)(GLint, GLsizei, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_Uniform2uiv(GLint a0, GLsizei a1, const GLuint *a2)
+	{
 		Uniform2uiv = reinterpret_cast<PFNUNIFORM2UIV>(IntGetProcAddress("glUniform2uiv"));
-		if(!Uniform2uiv) ++numFailed;
+		return Uniform2uiv(a0, a1, a2);
+	}
+	PFNUNIFORM2UIV Uniform2uiv = Switch_Uniform2uiv;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM3UI)(GLint, GLuint, GLuint, GLuint);
+	static void CODEGEN_FUNCPTR Switch_Uniform3ui(GLint a0, GLuint a1, GLuint a2, GLuint a3)
+	{
 		Uniform3ui = reinterpret_cast<PFNUNIFORM3UI>(IntGetProcAddress("glUniform3ui"));
-		if(!Uniform3ui) ++numFailed;
+		return Uniform3ui(a0, a1, a2, a3);
+	}
+	PFNUNIFORM3UI Uniform3ui = Switch_Uniform3ui;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM3UIV)(GLint, GLsizei, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_Uniform3uiv(GLint a0, GLsizei a1, const GLuint *a2)
+	{
 		Uniform3uiv = reinterpret_cast<PFNUNIFORM3UIV>(IntGetProcAddress("glUniform3uiv"));
-		if(!Uniform3uiv) ++numFailed;
+		return Uniform3uiv(a0, a1, a2);
+	}
+	PFNUNIFORM3UIV Uniform3uiv = Switch_Uniform3uiv;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM4UI)(GLint, GLuint, GLuint, GLuint, GLuint);
+	static void CODEGEN_FUNCPTR Switch_Uniform4ui(GLint a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4)
+	{
 		Uniform4ui = reinterpret_cast<PFNUNIFORM4UI>(IntGetProcAddress("glUniform4ui"));
-		if(!Uniform4ui) ++numFailed;
+		return Uniform4ui(a0, a1, a2, a3, a4);
+	}
+	PFNUNIFORM4UI Uniform4ui = Switch_Uniform4ui;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM4UIV)(GLint, GLsizei, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_Uniform4uiv(GLint a0, GLsizei a1, const GLuint *a2)
+	{
 		Uniform4uiv = reinterpret_cast<PFNUNIFORM4UIV>(IntGetProcAddress("glUniform4uiv"));
-		if(!Uniform4uiv) ++numFailed;
+		return Uniform4uiv(a0, a1, a2);
+	}
+	PFNUNIFORM4UIV Uniform4uiv = Switch_Uniform4uiv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI1I)(GLuint, GLint);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI1i(GLuint a0, GLint a1)
+	{
 		VertexAttribI1i = reinterpret_cast<PFNVERTEXATTRIBI1I>(IntGetProcAddress("glVertexAttribI1i"));
-		if(!VertexAttribI1i) ++numFailed;
+		return VertexAttribI1i(a0, a1);
+	}
+	PFNVERTEXATTRIBI1I VertexAttribI1i = Switch_VertexAttribI1i;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI1IV)(GLuint, const GLint *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI1iv(GLuint a0, const GLint *a1)
+	{
 		VertexAttribI1iv = reinterpret_cast<PFNVERTEXATTRIBI1IV>(IntGetProcAddress("glVertexAttribI1iv"));
-		if(!VertexAttribI1iv) ++numFailed;
+		return VertexAttribI1iv(a0, a1);
+	}
+	PFNVERTEXATTRIBI1IV VertexAttribI1iv = Switch_VertexAttribI1iv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI1UI)(GLuint, GLuint);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI1ui(GLuint a0, GLuint a1)
+	{
 		VertexAttribI1ui = reinterpret_cast<PFNVERTEXATTRIBI1UI>(IntGetProcAddress("glVertexAttribI1ui"));
-		if(!VertexAttribI1ui) ++numFailed;
+		return VertexAttribI1ui(a0, a1);
+	}
+	PFNVERTEXATTRIBI1UI VertexAttribI1ui = Switch_VertexAttribI1ui;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI1UIV)(GLuint, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI1uiv(GLuint a0, const GLuint *a1)
+	{
 		VertexAttribI1uiv = reinterpret_cast<PFNVERTEXATTRIBI1UIV>(IntGetProcAddress("glVertexAttribI1uiv"));
-		if(!VertexAttribI1uiv) ++numFailed;
+		return VertexAttribI1uiv(a0, a1);
+	}
+	PFNVERTEXATTRIBI1UIV VertexAttribI1uiv = Switch_VertexAttribI1uiv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI2I)(GLuint, GLint, GLint);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI2i(GLuint a0, GLint a1, GLint a2)
+	{
 		VertexAttribI2i = reinterpret_cast<PFNVERTEXATTRIBI2I>(IntGetProcAddress("glVertexAttribI2i"));
-		if(!VertexAttribI2i) ++numFailed;
+		return VertexAttribI2i(a0, a1, a2);
+	}
+	PFNVERTEXATTRIBI2I VertexAttribI2i = Switch_VertexAttribI2i;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI2IV)(GLuint, const GLint *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI2iv(GLuint a0, const GLint *a1)
+	{
 		VertexAttribI2iv = reinterpret_cast<PFNVERTEXATTRIBI2IV>(IntGetProcAddress("glVertexAttribI2iv"));
-		if(!VertexAttribI2iv) ++numFailed;
+		return VertexAttribI2iv(a0, a1);
+	}
+	PFNVERTEXATTRIBI2IV VertexAttribI2iv = Switch_VertexAttribI2iv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI2UI)(GLuint, GLuint, GLuint);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI2ui(GLuint a0, GLuint a1, GLuint a2)
+	{
 		VertexAttribI2ui = reinterpret_cast<PFNVERTEXATTRIBI2UI>(IntGetProcAddress("glVertexAttribI2ui"));
-		if(!VertexAttribI2ui) ++numFailed;
+		return VertexAttribI2ui(a0, a1, a2);
+	}
+	PFNVERTEXATTRIBI2UI VertexAttribI2ui = Switch_VertexAttribI2ui;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI2UIV)(GLuint, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI2uiv(GLuint a0, const GLuint *a1)
+	{
 		VertexAttribI2uiv = reinterpret_cast<PFNVERTEXATTRIBI2UIV>(IntGetProcAddress("glVertexAttribI2uiv"));
-		if(!VertexAttribI2uiv) ++numFailed;
+		return VertexAttribI2uiv(a0, a1);
+	}
+	PFNVERTEXATTRIBI2UIV VertexAttribI2uiv = Switch_VertexAttribI2uiv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI3I)(GLuint, GLint, GLint, GLint);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI3i(GLuint a0, GLint a1, GLint a2, GLint a3)
+	{
 		VertexAttribI3i = reinterpret_cast<PFNVERTEXATTRIBI3I>(IntGetProcAddress("glVertexAttribI3i"));
-		if(!VertexAttribI3i) ++numFailed;
+		return VertexAttribI3i(a0, a1, a2, a3);
+	}
+	PFNVERTEXATTRIBI3I VertexAttribI3i = Switch_VertexAttribI3i;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI3IV)(GLuint, const GLint *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI3iv(GLuint a0, const GLint *a1)
+	{
 		VertexAttribI3iv = reinterpret_cast<PFNVERTEXATTRIBI3IV>(IntGetProcAddress("glVertexAttribI3iv"));
-		if(!VertexAttribI3iv) ++numFailed;
+		return VertexAttribI3iv(a0, a1);
+	}
+	PFNVERTEXATTRIBI3IV VertexAttribI3iv = Switch_VertexAttribI3iv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI3UI)(GLuint, GLuint, GLuint, GLuint);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI3ui(GLuint a0, GLuint a1, GLuint a2, GLuint a3)
+	{
 		VertexAttribI3ui = reinterpret_cast<PFNVERTEXATTRIBI3UI>(IntGetProcAddress("glVertexAttribI3ui"));
-		if(!VertexAttribI3ui) ++numFailed;
+		return VertexAttribI3ui(a0, a1, a2, a3);
+	}
+	PFNVERTEXATTRIBI3UI VertexAttribI3ui = Switch_VertexAttribI3ui;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI3UIV)(GLuint, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI3uiv(GLuint a0, const GLuint *a1)
+	{
 		VertexAttribI3uiv = reinterpret_cast<PFNVERTEXATTRIBI3UIV>(IntGetProcAddress("glVertexAttribI3uiv"));
-		if(!VertexAttribI3uiv) ++numFailed;
+		return VertexAttribI3uiv(a0, a1);
+	}
+	PFNVERTEXATTRIBI3UIV VertexAttribI3uiv = Switch_VertexAttribI3uiv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4BV)(GLuint, const GLbyte *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4bv(GLuint a0, const GLbyte *a1)
+	{
 		VertexAttribI4bv = reinterpret_cast<PFNVERTEXATTRIBI4BV>(IntGetProcAddress("glVertexAttribI4bv"));
-		if(!VertexAttribI4bv) ++numFailed;
+		return VertexAttribI4bv(a0, a1);
+	}
+	PFNVERTEXATTRIBI4BV VertexAttribI4bv = Switch_VertexAttribI4bv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4I)(GLuint, GLint, GLint, GLint, GLint);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4i(GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4)
+	{
 		VertexAttribI4i = reinterpret_cast<PFNVERTEXATTRIBI4I>(IntGetProcAddress("glVertexAttribI4i"));
-		if(!VertexAttribI4i) ++numFailed;
+		return VertexAttribI4i(a0, a1, a2, a3, a4);
+	}
+	PFNVERTEXATTRIBI4I VertexAttribI4i = Switch_VertexAttribI4i;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4IV)(GLuint, const GLint *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4iv(GLuint a0, const GLint *a1)
+	{
 		VertexAttribI4iv = reinterpret_cast<PFNVERTEXATTRIBI4IV>(IntGetProcAddress("glVertexAttribI4iv"));
-		if(!VertexAttribI4iv) ++numFailed;
+		return VertexAttribI4iv(a0, a1);
+	}
+	PFNVERTEXATTRIBI4IV VertexAttribI4iv = Switch_VertexAttribI4iv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4SV)(GLuint, const GLshort *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4sv(GLuint a0, const GLshort *a1)
+	{
 		VertexAttribI4sv = reinterpret_cast<PFNVERTEXATTRIBI4SV>(IntGetProcAddress("glVertexAttribI4sv"));
-		if(!VertexAttribI4sv) ++numFailed;
+		return VertexAttribI4sv(a0, a1);
+	}
+	PFNVERTEXATTRIBI4SV VertexAttribI4sv = Switch_VertexAttribI4sv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4UBV)(GLuint, const GLubyte *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4ubv(GLuint a0, const GLubyte *a1)
+	{
 		VertexAttribI4ubv = reinterpret_cast<PFNVERTEXATTRIBI4UBV>(IntGetProcAddress("glVertexAttribI4ubv"));
-		if(!VertexAttribI4ubv) ++numFailed;
+		return VertexAttribI4ubv(a0, a1);
+	}
+	PFNVERTEXATTRIBI4UBV VertexAttribI4ubv = Switch_VertexAttribI4ubv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4UI)(GLuint, GLuint, GLuint, GLuint, GLuint);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4ui(GLuint a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4)
+	{
 		VertexAttribI4ui = reinterpret_cast<PFNVERTEXATTRIBI4UI>(IntGetProcAddress("glVertexAttribI4ui"));
-		if(!VertexAttribI4ui) ++numFailed;
+		return VertexAttribI4ui(a0, a1, a2, a3, a4);
+	}
+	PFNVERTEXATTRIBI4UI VertexAttribI4ui = Switch_VertexAttribI4ui;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4UIV)(GLuint, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4uiv(GLuint a0, const GLuint *a1)
+	{
 		VertexAttribI4uiv = reinterpret_cast<PFNVERTEXATTRIBI4UIV>(IntGetProcAddress("glVertexAttribI4uiv"));
-		if(!VertexAttribI4uiv) ++numFailed;
+		return VertexAttribI4uiv(a0, a1);
+	}
+	PFNVERTEXATTRIBI4UIV VertexAttribI4uiv = Switch_VertexAttribI4uiv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4USV)(GLuint, const GLushort *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4usv(GLuint a0, const GLushort *a1)
+	{
 		VertexAttribI4usv = reinterpret_cast<PFNVERTEXATTRIBI4USV>(IntGetProcAddress("glVertexAttribI4usv"));
-		if(!VertexAttribI4usv) ++numFailed;
+		return VertexAttribI4usv(a0, a1);
+	}
+	PFNVERTEXATTRIBI4USV VertexAttribI4usv = Switch_VertexAttribI4usv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBIPOINTER)(GLuint, GLint, GLenum, GLsizei, const void *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribIPointer(GLuint a0, GLint a1, GLenum a2, GLsizei a3, const void *a4)
+	{
 		VertexAttribIPointer = reinterpret_cast<PFNVERTEXATTRIBIPOINTER>(IntGetProcAddress("glVertexAttribIPointer"));
-		if(!VertexAttribIPointer) ++numFailed;
+		return VertexAttribIPointer(a0, a1, a2, a3, a4);
+	}
+	PFNVERTEXATTRIBIPOINTER VertexAttribIPointer = Switch_VertexAttribIPointer;
+	
+	typedef void (CODEGEN_FUNCPTR *PFNCOPYBUFFERSUBDATA)(GLenum, GLenum, GLintptr, GLintptr, GLsizeiptr);
+	static void CODEGEN_FUNCPTR Switch_CopyBufferSubData(GLenum a0, GLenum a1, GLintptr a2, GLintptr a3, GLsizeiptr a4)
+	{
 		CopyBufferSubData = reinterpret_cast<PFNCOPYBUFFERSUBDATA>(IntGetProcAddress("glCopyBufferSubData"));
-		if(!CopyBufferSubData) ++numFailed;
+		return CopyBufferSubData(a0, a1, a2, a3, a4);
+	}
+	PFNCOPYBUFFERSUBDATA CopyBufferSubData = Switch_CopyBufferSubData;
+	typedef void (CODEGEN_FUNCPTR *PFNDRAWARRAYSINSTANCED)(GLenum, GLint, GLsizei, GLsizei);
+	static void CODEGEN_FUNCPTR Switch_DrawArraysInstanced(GLenum a0, GLint a1, GLsizei a2, GLsizei a3)
+	{
 		DrawArraysInstanced = reinterpret_cast<PFNDRAWARRAYSINSTANCED>(IntGetProcAddress("glDrawArraysInstanced"));
-		if(!DrawArraysInstanced) ++numFailed;
+		return DrawArraysInstanced(a0, a1, a2, a3);
+	}
+	PFNDRAWARRAYSINSTANCED DrawArraysInstanced = Switch_DrawArraysInstanced;
+	typedef void (CODEGEN_FUNCPTR *PFNDRAWELEMENTSINSTANCED)(GLenum, GLsizei, GLenum, const void *, GLsizei);
+	static void CODEGEN_FUNCPTR Switch_DrawElementsInstanced(GLenum a0, GLsizei a1, GLenum a2, const void *a3, GLsizei a4)
+	{
 		DrawElementsInstanced = reinterpret_cast<PFNDRAWELEMENTSINSTANCED>(IntGetProcAddress("glDrawElementsInstanced"));
-		if(!DrawElementsInstanced) ++numFailed;
+		return DrawElementsInstanced(a0, a1, a2, a3, a4);
+	}
+	PFNDRAWELEMENTSINSTANCED DrawElementsInstanced = Switch_DrawElementsInstanced;
+	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVEUNIFORMBLOCKNAME)(GLuint, GLuint, GLsizei, GLsizei *, GLchar *);
+	static void CODEGEN_FUNCPTR Switch_GetActiveUniformBlockName(GLuint a0, GLuint a1, GLsizei a2, GLsizei *a3, GLchar *a4)
+	{
 		GetActiveUniformBlockName = reinterpret_cast<PFNGETACTIVEUNIFORMBLOCKNAME>(IntGetProcAddress("glGetActiveUniformBlockName"));
-		if(!GetActiveUniformBlockName) ++numFailed;
+		return GetActiveUniformBlockName(a0, a1, a2, a3, a4);
+	}
+	PFNGETACTIVEUNIFORMBLOCKNAME GetActiveUniformBlockName = Switch_GetActiveUniformBlockName;
+	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVEUNIFORMBLOCKIV)(GLuint, GLuint, GLenum, GLint *);
+	static void CODEGEN_FUNCPTR Switch_GetActiveUniformBlockiv(GLuint a0, GLuint a1, GLenum a2, GLint *a3)
+	{
 		GetActiveUniformBlockiv = reinterpret_cast<PFNGETACTIVEUNIFORMBLOCKIV>(IntGetProcAddress("glGetActiveUniformBlockiv"));
-		if(!GetActiveUniformBlockiv) ++numFailed;
+		return GetActiveUniformBlockiv(a0, a1, a2, a3);
+	}
+	PFNGETACTIVEUNIFORMBLOCKIV GetActiveUniformBlockiv = Switch_GetActiveUniformBlockiv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVEUNIFORMNAME)(GLuint, GLuint, GLsizei, GLsizei *, GLchar *);
+	static void CODEGEN_FUNCPTR Switch_GetActiveUniformName(GLuint a0, GLuint a1, GLsizei a2, GLsizei *a3, GLchar *a4)
+	{
 		GetActiveUniformName = reinterpret_cast<PFNGETACTIVEUNIFORMNAME>(IntGetProcAddress("glGetActiveUniformName"));
-		if(!GetActiveUniformName) ++numFailed;
+		return GetActiveUniformName(a0, a1, a2, a3, a4);
+	}
+	PFNGETACTIVEUNIFORMNAME GetActiveUniformName = Switch_GetActiveUniformName;
+	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVEUNIFORMSIV)(GLuint, GLsizei, const GLuint *, GLenum, GLint *);
+	static void CODEGEN_FUNCPTR Switch_GetActiveUniformsiv(GLuint a0, GLsizei a1, const GLuint *a2, GLenum a3, GLint *a4)
+	{
 		GetActiveUniformsiv = reinterpret_cast<PFNGETACTIVEUNIFORMSIV>(IntGetProcAddress("glGetActiveUniformsiv"));
-		if(!GetActiveUniformsiv) ++numFailed;
+		return GetActiveUniformsiv(a0, a1, a2, a3, a4);
+	}
+	PFNGETACTIVEUNIFORMSIV GetActiveUniformsiv = Switch_GetActiveUniformsiv;
+	typedef GLuint (CODEGEN_FUNCPTR *PFNGETUNIFORMBLOCKINDEX)(GLuint, const GLchar *);
+	static GLuint CODEGEN_FUNCPTR Switch_GetUniformBlockIndex(GLuint a0, const GLchar *a1)
+	{
 		GetUniformBlockIndex = reinterpret_cast<PFNGETUNIFORMBLOCKINDEX>(IntGetProcAddress("glGetUniformBlockIndex"));
-		if(!GetUniformBlockIndex) ++numFailed;
+		return GetUniformBlockIndex(a0, a1);
+	}
+	PFNGETUNIFORMBLOCKINDEX GetUniformBlockIndex = Switch_GetUniformBlockIndex;
+	typedef void (CODEGEN_FUNCPTR *PFNGETUNIFORMINDICES)(GLuint, GLsizei, const GLchar *const*, GLuint *);
+	static void CODEGEN_FUNCPTR Switch_GetUniformIndices(GLuint a0, GLsizei a1, const GLchar *const*a2, GLuint *a3)
+	{
 		GetUniformIndices = reinterpret_cast<PFNGETUNIFORMINDICES>(IntGetProcAddress("glGetUniformIndices"));
-		if(!GetUniformIndices) ++numFailed;
+		return GetUniformIndices(a0, a1, a2, a3);
+	}
+	PFNGETUNIFORMINDICES GetUniformIndices = Switch_GetUniformIndices;
+	typedef void (CODEGEN_FUNCPTR *PFNPRIMITIVERESTARTINDEX)(GLuint);
+	static void CODEGEN_FUNCPTR Switch_PrimitiveRestartIndex(GLuint a0)
+	{
 		PrimitiveRestartIndex = reinterpret_cast<PFNPRIMITIVERESTARTINDEX>(IntGetProcAddress("glPrimitiveRestartIndex"));
-		if(!PrimitiveRestartIndex) ++numFailed;
+		return PrimitiveRestartIndex(a0);
+	}
+	PFNPRIMITIVERESTARTINDEX PrimitiveRestartIndex = Switch_PrimitiveRestartIndex;
+	typedef void (CODEGEN_FUNCPTR *PFNTEXBUFFER)(GLenum, GLenum, GLuint);
+	static void CODEGEN_FUNCPTR Switch_TexBuffer(GLenum a0, GLenum a1, GLuint a2)
+	{
 		TexBuffer = reinterpret_cast<PFNTEXBUFFER>(IntGetProcAddress("glTexBuffer"));
-		if(!TexBuffer) ++numFailed;
+		return TexBuffer(a0, a1, a2);
+	}
+	PFNTEXBUFFER TexBuffer = Switch_TexBuffer;
+	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMBLOCKBINDING)(GLuint, GLuint, GLuint);
+	static void CODEGEN_FUNCPTR Switch_UniformBlockBinding(GLuint a0, GLuint a1, GLuint a2)
+	{
 		UniformBlockBinding = reinterpret_cast<PFNUNIFORMBLOCKBINDING>(IntGetProcAddress("glUniformBlockBinding"));
-		if(!UniformBlockBinding) ++numFailed;
+		return UniformBlockBinding(a0, a1, a2);
+	}
+	PFNUNIFORMBLOCKBINDING UniformBlockBinding = Switch_UniformBlockBinding;
+	
+	typedef GLenum (CODEGEN_FUNCPTR *PFNCLIENTWAITSYNC)(GLsync, GLbitfield, GLuint64);
+	static GLenum CODEGEN_FUNCPTR Switch_ClientWaitSync(GLsync a0, GLbitfield a1, GLuint64 a2)
+	{
 		ClientWaitSync = reinterpret_cast<PFNCLIENTWAITSYNC>(IntGetProcAddress("glClientWaitSync"));
-		if(!ClientWaitSync) ++numFailed;
+		return ClientWaitSync(a0, a1, a2);
+	}
+	PFNCLIENTWAITSYNC ClientWaitSync = Switch_ClientWaitSync;
+	typedef void (CODEGEN_FUNCPTR *PFNDELETESYNC)(GLsync);
+	static void CODEGEN_FUNCPTR Switch_DeleteSync(GLsync a0)
+	{
 		DeleteSync = reinterpret_cast<PFNDELETESYNC>(IntGetProcAddress("glDeleteSync"));
-		if(!DeleteSync) ++numFailed;
+		return DeleteSync(a0);
+	}
+	PFNDELETESYNC DeleteSync = Switch_DeleteSync;
+	typedef void (CODEGEN_FUNCPTR *PFNDRAWELEMENTSBASEVERTEX)(GLenum, GLsizei, GLenum, const void *, GLint);
+	static void CODEGEN_FUNCPTR Switch_DrawElementsBaseVertex(GLenum a0, GLsizei a1, GLenum a2, const void *a3, GLint a4)
+	{
 		DrawElementsBaseVertex = reinterpret_cast<PFNDRAWELEMENTSBASEVERTEX>(IntGetProcAddress("glDrawElementsBaseVertex"));
-		if(!DrawElementsBaseVertex) ++numFailed;
+		return DrawElementsBaseVertex(a0, a1, a2, a3, a4);
+	}
+	PFNDRAWELEMENTSBASEVERTEX DrawElementsBaseVertex = Switch_DrawElementsBaseVertex;
+	typedef void (CODEGEN_FUNCPTR *PFNDRAWELEMENTSINSTANCEDBASEVERTEX)(GLenum, GLsizei, GLenum, const void *, GLsizei, GLint);
+	static void CODEGEN_FUNCPTR Switch_DrawElementsInstancedBaseVertex(GLenum a0, GLsizei a1, GLenum a2, const void *a3, GLsizei a4, GLint a5)
+	{
 		DrawElementsInstancedBaseVertex = reinterpret_cast<PFNDRAWELEMENTSINSTANCEDBASEVERTEX>(IntGetProcAddress("glDrawElementsInstancedBaseVertex"));
-		if(!DrawElementsInstancedBaseVertex) ++numFailed;
+		return DrawElementsInstancedBaseVertex(a0, a1, a2, a3, a4, a5);
+	}
+	PFNDRAWELEMENTSINSTANCEDBASEVERTEX DrawElementsInstancedBaseVertex = Switch_DrawElementsInstancedBaseVertex;
+	typedef void (CODEGEN_FUNCPTR *PFNDRAWRANGEELEMENTSBASEVERTEX)(GLenum, GLuint, GLuint, GLsizei, GLenum, const void *, GLint);
+	static void CODEGEN_FUNCPTR Switch_DrawRangeElementsBaseVertex(GLenum a0, GLuint a1, GLuint a2, GLsizei a3, GLenum a4, const void *a5, GLint a6)
+	{
 		DrawRangeElementsBaseVertex = reinterpret_cast<PFNDRAWRANGEELEMENTSBASEVERTEX>(IntGetProcAddress("glDrawRangeElementsBaseVertex"));
-		if(!DrawRangeElementsBaseVertex) ++numFailed;
+		return DrawRangeElementsBaseVertex(a0, a1, a2, a3, a4, a5, a6);
+	}
+	PFNDRAWRANGEELEMENTSBASEVERTEX DrawRangeElementsBaseVertex = Switch_DrawRangeElementsBaseVertex;
+	typedef GLsync (CODEGEN_FUNCPTR *PFNFENCESYNC)(GLenum, GLbitfield);
+	static GLsync CODEGEN_FUNCPTR Switch_FenceSync(GLenum a0, GLbitfield a1)
+	{
 		FenceSync = reinterpret_cast<PFNFENCESYNC>(IntGetProcAddress("glFenceSync"));
-		if(!FenceSync) ++numFailed;
+		return FenceSync(a0, a1);
+	}
+	PFNFENCESYNC FenceSync = Switch_FenceSync;
+	typedef void (CODEGEN_FUNCPTR *PFNFRAMEBUFFERTEXTURE)(GLenum, GLenum, GLuint, GLint);
+	static void CODEGEN_FUNCPTR Switch_FramebufferTexture(GLenum a0, GLenum a1, GLuint a2, GLint a3)
+	{
 		FramebufferTexture = reinterpret_cast<PFNFRAMEBUFFERTEXTURE>(IntGetProcAddress("glFramebufferTexture"));
-		if(!FramebufferTexture) ++numFailed;
+		return FramebufferTexture(a0, a1, a2, a3);
+	}
+	PFNFRAMEBUFFERTEXTURE FramebufferTexture = Switch_FramebufferTexture;
+	typedef void (CODEGEN_FUNCPTR *PFNGETBUFFERPARAMETERI64V)(GLenum, GLenum, GLint64 *);
+	static void CODEGEN_FUNCPTR Switch_GetBufferParameteri64v(GLenum a0, GLenum a1, GLint64 *a2)
+	{
 		GetBufferParameteri64v = reinterpret_cast<PFNGETBUFFERPARAMETERI64V>(IntGetProcAddress("glGetBufferParameteri64v"));
-		if(!GetBufferParameteri64v) ++numFailed;
+		return GetBufferParameteri64v(a0, a1, a2);
+	}
+	PFNGETBUFFERPARAMETERI64V GetBufferParameteri64v = Switch_GetBufferParameteri64v;
+	typedef void (CODEGEN_FUNCPTR *PFNGETINTEGER64I_V)(GLenum, GLuint, GLint64 *);
+	static void CODEGEN_FUNCPTR Switch_GetInteger64i_v(GLenum a0, GLuint a1, GLint64 *a2)
+	{
 		GetInteger64i_v = reinterpret_cast<PFNGETINTEGER64I_V>(IntGetProcAddress("glGetInteger64i_v"));
-		if(!GetInteger64i_v) ++numFailed;
+		return GetInteger64i_v(a0, a1, a2);
+	}
+	PFNGETINTEGER64I_V GetInteger64i_v = Switch_GetInteger64i_v;
+	typedef void (CODEGEN_FUNCPTR *PFNGETINTEGER64V)(GLenum, GLint64 *);
+	static void CODEGEN_FUNCPTR Switch_GetInteger64v(GLenum a0, GLint64 *a1)
+	{
 		GetInteger64v = reinterpret_cast<PFNGETINTEGER64V>(IntGetProcAddress("glGetInteger64v"));
-		if(!GetInteger64v) ++numFailed;
+		return GetInteger64v(a0, a1);
+	}
+	PFNGETINTEGER64V GetInteger64v = Switch_GetInteger64v;
+	typedef void (CODEGEN_FUNCPTR *PFNGETMULTISAMPLEFV)(GLenum, GLuint, GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_GetMultisamplefv(GLenum a0, GLuint a1, GLfloat *a2)
+	{
 		GetMultisamplefv = reinterpret_cast<PFNGETMULTISAMPLEFV>(IntGetProcAddress("glGetMultisamplefv"));
-		if(!GetMultisamplefv) ++numFailed;
+		return GetMultisamplefv(a0, a1, a2);
+	}
+	PFNGETMULTISAMPLEFV GetMultisamplefv = Switch_GetMultisamplefv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETSYNCIV)(GLsync, GLenum, GLsizei, GLsizei *, GLint *);
+	static void CODEGEN_FUNCPTR Switch_GetSynciv(GLsync a0, GLenum a1, GLsizei a2, GLsizei *a3, GLint *a4)
+	{
 		GetSynciv = reinterpret_cast<PFNGETSYNCIV>(IntGetProcAddress("glGetSynciv"));
-		if(!GetSynciv) ++numFailed;
+		return GetSynciv(a0, a1, a2, a3, a4);
+	}
+	PFNGETSYNCIV GetSynciv = Switch_GetSynciv;
+	typedef GLboolean (CODEGEN_FUNCPTR *PFNISSYNC)(GLsync);
+	static GLboolean CODEGEN_FUNCPTR Switch_IsSync(GLsync a0)
+	{
 		IsSync = reinterpret_cast<PFNISSYNC>(IntGetProcAddress("glIsSync"));
-		if(!IsSync) ++numFailed;
+		return IsSync(a0);
+	}
+	PFNISSYNC IsSync = Switch_IsSync;
+	typedef void (CODEGEN_FUNCPTR *PFNMULTIDRAWELEMENTSBASEVERTEX)(GLenum, const GLsizei *, GLenum, const void *const*, GLsizei, const GLint *);
+	static void CODEGEN_FUNCPTR Switch_MultiDrawElementsBaseVertex(GLenum a0, const GLsizei *a1, GLenum a2, const void *const*a3, GLsizei a4, const GLint *a5)
+	{
 		MultiDrawElementsBaseVertex = reinterpret_cast<PFNMULTIDRAWELEMENTSBASEVERTEX>(IntGetProcAddress("glMultiDrawElementsBaseVertex"));
-		if(!MultiDrawElementsBaseVertex) ++numFailed;
+		return MultiDrawElementsBaseVertex(a0, a1, a2, a3, a4, a5);
+	}
+	PFNMULTIDRAWELEMENTSBASEVERTEX MultiDrawElementsBaseVertex = Switch_MultiDrawElementsBaseVertex;
+	typedef void (CODEGEN_FUNCPTR *PFNPROVOKINGVERTEX)(GLenum);
+	static void CODEGEN_FUNCPTR Switch_ProvokingVertex(GLenum a0)
+	{
 		ProvokingVertex = reinterpret_cast<PFNPROVOKINGVERTEX>(IntGetProcAddress("glProvokingVertex"));
-		if(!ProvokingVertex) ++numFailed;
+		return ProvokingVertex(a0);
+	}
+	PFNPROVOKINGVERTEX ProvokingVertex = Switch_ProvokingVertex;
+	typedef void (CODEGEN_FUNCPTR *PFNSAMPLEMASKI)(GLuint, GLbitfield);
+	static void CODEGEN_FUNCPTR Switch_SampleMaski(GLuint a0, GLbitfield a1)
+	{
 		SampleMaski = reinterpret_cast<PFNSAMPLEMASKI>(IntGetProcAddress("glSampleMaski"));
-		if(!SampleMaski) ++numFailed;
+		return SampleMaski(a0, a1);
+	}
+	PFNSAMPLEMASKI SampleMaski = Switch_SampleMaski;
+	typedef void (CODEGEN_FUNCPTR *PFNTEXIMAGE2DMULTISAMPLE)(GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLboolean);
+	static void CODEGEN_FUNCPTR Switch_TexImage2DMultisample(GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLboolean a5)
+	{
 		TexImage2DMultisample = reinterpret_cast<PFNTEXIMAGE2DMULTISAMPLE>(IntGetProcAddress("glTexImage2DMultisample"));
-		if(!TexImage2DMultisample) ++numFailed;
+		return TexImage2DMultisample(a0, a1, a2, a3, a4, a5);
+	}
+	PFNTEXIMAGE2DMULTISAMPLE TexImage2DMultisample = Switch_TexImage2DMultisample;
+	typedef void (CODEGEN_FUNCPTR *PFNTEXIMAGE3DMULTISAMPLE)(GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLsizei, GLboolean);
+	static void CODEGEN_FUNCPTR Switch_TexImage3DMultisample(GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLboolean a6)
+	{
 		TexImage3DMultisample = reinterpret_cast<PFNTEXIMAGE3DMULTISAMPLE>(IntGetProcAddress("glTexImage3DMultisample"));
-		if(!TexImage3DMultisample) ++numFailed;
+		return TexImage3DMultisample(a0, a1, a2, a3, a4, a5, a6);
+	}
+	PFNTEXIMAGE3DMULTISAMPLE TexImage3DMultisample = Switch_TexImage3DMultisample;
+	typedef void (CODEGEN_FUNCPTR *PFNWAITSYNC)(GLsync, GLbitfield, GLuint64);
+	static void CODEGEN_FUNCPTR Switch_WaitSync(GLsync a0, GLbitfield a1, GLuint64 a2)
+	{
 		WaitSync = reinterpret_cast<PFNWAITSYNC>(IntGetProcAddress("glWaitSync"));
-		if(!WaitSync) ++numFailed;
+		return WaitSync(a0, a1, a2);
+	}
+	PFNWAITSYNC WaitSync = Switch_WaitSync;
+	
+	typedef void (CODEGEN_FUNCPTR *PFNBINDFRAGDATALOCATIONINDEXED)(GLuint, GLuint, GLuint, const GLchar *);
+	static void CODEGEN_FUNCPTR Switch_BindFragDataLocationIndexed(GLuint a0, GLuint a1, GLuint a2, const GLchar *a3)
+	{
 		BindFragDataLocationIndexed = reinterpret_cast<PFNBINDFRAGDATALOCATIONINDEXED>(IntGetProcAddress("glBindFragDataLocationIndexed"));
-		if(!BindFragDataLocationIndexed) ++numFailed;
+		return BindFragDataLocationIndexed(a0, a1, a2, a3);
+	}
+	PFNBINDFRAGDATALOCATIONINDEXED BindFragDataLocationIndexed = Switch_BindFragDataLocationIndexed;
+	typedef void (CODEGEN_FUNCPTR *PFNBINDSAMPLER)(GLuint, GLuint);
+	static void CODEGEN_FUNCPTR Switch_BindSampler(GLuint a0, GLuint a1)
+	{
 		BindSampler = reinterpret_cast<PFNBINDSAMPLER>(IntGetProcAddress("glBindSampler"));
-		if(!BindSampler) ++numFailed;
+		return BindSampler(a0, a1);
+	}
+	PFNBINDSAMPLER BindSampler = Switch_BindSampler;
+	typedef void (CODEGEN_FUNCPTR *PFNDELETESAMPLERS)(GLsizei, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_DeleteSamplers(GLsizei a0, const GLuint *a1)
+	{
 		DeleteSamplers = reinterpret_cast<PFNDELETESAMPLERS>(IntGetProcAddress("glDeleteSamplers"));
-		if(!DeleteSamplers) ++numFailed;
+		return DeleteSamplers(a0, a1);
+	}
+	PFNDELETESAMPLERS DeleteSamplers = Switch_DeleteSamplers;
+	typedef void (CODEGEN_FUNCPTR *PFNGENSAMPLERS)(GLsizei, GLuint *);
+	static void CODEGEN_FUNCPTR Switch_GenSamplers(GLsizei a0, GLuint *a1)
+	{
 		GenSamplers = reinterpret_cast<PFNGENSAMPLERS>(IntGetProcAddress("glGenSamplers"));
-		if(!GenSamplers) ++numFailed;
+		return GenSamplers(a0, a1);
+	}
+	PFNGENSAMPLERS GenSamplers = Switch_GenSamplers;
+	typedef GLint (CODEGEN_FUNCPTR *PFNGETFRAGDATAINDEX)(GLuint, const GLchar *);
+	static GLint CODEGEN_FUNCPTR Switch_GetFragDataIndex(GLuint a0, const GLchar *a1)
+	{
 		GetFragDataIndex = reinterpret_cast<PFNGETFRAGDATAINDEX>(IntGetProcAddress("glGetFragDataIndex"));
-		if(!GetFragDataIndex) ++numFailed;
+		return GetFragDataIndex(a0, a1);
+	}
+	PFNGETFRAGDATAINDEX GetFragDataIndex = Switch_GetFragDataIndex;
+	typedef void (CODEGEN_FUNCPTR *PFNGETQUERYOBJECTI64V)(GLuint, GLenum, GLint64 *);
+	static void CODEGEN_FUNCPTR Switch_GetQueryObjecti64v(GLuint a0, GLenum a1, GLint64 *a2)
+	{
 		GetQueryObjecti64v = reinterpret_cast<PFNGETQUERYOBJECTI64V>(IntGetProcAddress("glGetQueryObjecti64v"));
-		if(!GetQueryObjecti64v) ++numFailed;
+		return GetQueryObjecti64v(a0, a1, a2);
+	}
+	PFNGETQUERYOBJECTI64V GetQueryObjecti64v = Switch_GetQueryObjecti64v;
+	typedef void (CODEGEN_FUNCPTR *PFNGETQUERYOBJECTUI64V)(GLuint, GLenum, GLuint64 *);
+	static void CODEGEN_FUNCPTR Switch_GetQueryObjectui64v(GLuint a0, GLenum a1, GLuint64 *a2)
+	{
 		GetQueryObjectui64v = reinterpret_cast<PFNGETQUERYOBJECTUI64V>(IntGetProcAddress("glGetQueryObjectui64v"));
-		if(!GetQueryObjectui64v) ++numFailed;
+		return GetQueryObjectui64v(a0, a1, a2);
+	}
+	PFNGETQUERYOBJECTUI64V GetQueryObjectui64v = Switch_GetQueryObjectui64v;
+	typedef void (CODEGEN_FUNCPTR *PFNGETSAMPLERPARAMETERIIV)(GLuint, GLenum, GLint *);
+	static void CODEGEN_FUNCPTR Switch_GetSamplerParameterIiv(GLuint a0, GLenum a1, GLint *a2)
+	{
 		GetSamplerParameterIiv = reinterpret_cast<PFNGETSAMPLERPARAMETERIIV>(IntGetProcAddress("glGetSamplerParameterIiv"));
-		if(!GetSamplerParameterIiv) ++numFailed;
+		return GetSamplerParameterIiv(a0, a1, a2);
+	}
+	PFNGETSAMPLERPARAMETERIIV GetSamplerParameterIiv = Switch_GetSamplerParameterIiv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETSAMPLERPARAMETERIUIV)(GLuint, GLenum, GLuint *);
+	static void CODEGEN_FUNCPTR Switch_GetSamplerParameterIuiv(GLuint a0, GLenum a1, GLuint *a2)
+	{
 		GetSamplerParameterIuiv = reinterpret_cast<PFNGETSAMPLERPARAMETERIUIV>(IntGetProcAddress("glGetSamplerParameterIuiv"));
-		if(!GetSamplerParameterIuiv) ++numFailed;
+		return GetSamplerParameterIuiv(a0, a1, a2);
+	}
+	PFNGETSAMPLERPARAMETERIUIV GetSamplerParameterIuiv = Switch_GetSamplerParameterIuiv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETSAMPLERPARAMETERFV)(GLuint, GLenum, GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_GetSamplerParameterfv(GLuint a0, GLenum a1, GLfloat *a2)
+	{
 		GetSamplerParameterfv = reinterpret_cast<PFNGETSAMPLERPARAMETERFV>(IntGetProcAddress("glGetSamplerParameterfv"));
-		if(!GetSamplerParameterfv) ++numFailed;
+		return GetSamplerParameterfv(a0, a1, a2);
+	}
+	PFNGETSAMPLERPARAMETERFV GetSamplerParameterfv = Switch_GetSamplerParameterfv;
+	typedef void (CODEGEN_FUNCPTR *PFNGETSAMPLERPARAMETERIV)(GLuint, GLenum, GLint *);
+	static void CODEGEN_FUNCPTR Switch_GetSamplerParameteriv(GLuint a0, GLenum a1, GLint *a2)
+	{
 		GetSamplerParameteriv = reinterpret_cast<PFNGETSAMPLERPARAMETERIV>(IntGetProcAddress("glGetSamplerParameteriv"));
-		if(!GetSamplerParameteriv) ++numFailed;
+		return GetSamplerParameteriv(a0, a1, a2);
+	}
+	PFNGETSAMPLERPARAMETERIV GetSamplerParameteriv = Switch_GetSamplerParameteriv;
+	typedef GLboolean (CODEGEN_FUNCPTR *PFNISSAMPLER)(GLuint);
+	static GLboolean CODEGEN_FUNCPTR Switch_IsSampler(GLuint a0)
+	{
 		IsSampler = reinterpret_cast<PFNISSAMPLER>(IntGetProcAddress("glIsSampler"));
-		if(!IsSampler) ++numFailed;
+		return IsSampler(a0);
+	}
+	PFNISSAMPLER IsSampler = Switch_IsSampler;
+	typedef void (CODEGEN_FUNCPTR *PFNQUERYCOUNTER)(GLuint, GLenum);
+	static void CODEGEN_FUNCPTR Switch_QueryCounter(GLuint a0, GLenum a1)
+	{
 		QueryCounter = reinterpret_cast<PFNQUERYCOUNTER>(IntGetProcAddress("glQueryCounter"));
-		if(!QueryCounter) ++numFailed;
+		return QueryCounter(a0, a1);
+	}
+	PFNQUERYCOUNTER QueryCounter = Switch_QueryCounter;
+	typedef void (CODEGEN_FUNCPTR *PFNSAMPLERPARAMETERIIV)(GLuint, GLenum, const GLint *);
+	static void CODEGEN_FUNCPTR Switch_SamplerParameterIiv(GLuint a0, GLenum a1, const GLint *a2)
+	{
 		SamplerParameterIiv = reinterpret_cast<PFNSAMPLERPARAMETERIIV>(IntGetProcAddress("glSamplerParameterIiv"));
-		if(!SamplerParameterIiv) ++numFailed;
+		return SamplerParameterIiv(a0, a1, a2);
+	}
+	PFNSAMPLERPARAMETERIIV SamplerParameterIiv = Switch_SamplerParameterIiv;
+	typedef void (CODEGEN_FUNCPTR *PFNSAMPLERPARAMETERIUIV)(GLuint, GLenum, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_SamplerParameterIuiv(GLuint a0, GLenum a1, const GLuint *a2)
+	{
 		SamplerParameterIuiv = reinterpret_cast<PFNSAMPLERPARAMETERIUIV>(IntGetProcAddress("glSamplerParameterIuiv"));
-		if(!SamplerParameterIuiv) ++numFailed;
+		return SamplerParameterIuiv(a0, a1, a2);
+	}
+	PFNSAMPLERPARAMETERIUIV SamplerParameterIuiv = Switch_SamplerParameterIuiv;
+	typedef void (CODEGEN_FUNCPTR *PFNSAMPLERPARAMETERF)(GLuint, GLenum, GLfloat);
+	static void CODEGEN_FUNCPTR Switch_SamplerParameterf(GLuint a0, GLenum a1, GLfloat a2)
+	{
 		SamplerParameterf = reinterpret_cast<PFNSAMPLERPARAMETERF>(IntGetProcAddress("glSamplerParameterf"));
-		if(!SamplerParameterf) ++numFailed;
+		return SamplerParameterf(a0, a1, a2);
+	}
+	PFNSAMPLERPARAMETERF SamplerParameterf = Switch_SamplerParameterf;
+	typedef void (CODEGEN_FUNCPTR *PFNSAMPLERPARAMETERFV)(GLuint, GLenum, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_SamplerParameterfv(GLuint a0, GLenum a1, const GLfloat *a2)
+	{
 		SamplerParameterfv = reinterpret_cast<PFNSAMPLERPARAMETERFV>(IntGetProcAddress("glSamplerParameterfv"));
-		if(!SamplerParameterfv) ++numFailed;
+		return SamplerParameterfv(a0, a1, a2);
+	}
+	PFNSAMPLERPARAMETERFV SamplerParameterfv = Switch_SamplerParameterfv;
+	typedef void (CODEGEN_FUNCPTR *PFNSAMPLERPARAMETERI)(GLuint, GLenum, GLint);
+	static void CODEGEN_FUNCPTR Switch_SamplerParameteri(GLuint a0, GLenum a1, GLint a2)
+	{
 		SamplerParameteri = reinterpret_cast<PFNSAMPLERPARAMETERI>(IntGetProcAddress("glSamplerParameteri"));
-		if(!SamplerParameteri) ++numFailed;
+		return SamplerParameteri(a0, a1, a2);
+	}
+	PFNSAMPLERPARAMETERI SamplerParameteri = Switch_SamplerParameteri;
+	typedef void (CODEGEN_FUNCPTR *PFNSAMPLERPARAMETERIV)(GLuint, GLenum, const GLint *);
+	static void CODEGEN_FUNCPTR Switch_SamplerParameteriv(GLuint a0, GLenum a1, const GLint *a2)
+	{
 		SamplerParameteriv = reinterpret_cast<PFNSAMPLERPARAMETERIV>(IntGetProcAddress("glSamplerParameteriv"));
-		if(!SamplerParameteriv) ++numFailed;
+		return SamplerParameteriv(a0, a1, a2);
+	}
+	PFNSAMPLERPARAMETERIV SamplerParameteriv = Switch_SamplerParameteriv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBDIVISOR)(GLuint, GLuint);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribDivisor(GLuint a0, GLuint a1)
+	{
 		VertexAttribDivisor = reinterpret_cast<PFNVERTEXATTRIBDIVISOR>(IntGetProcAddress("glVertexAttribDivisor"));
-		if(!VertexAttribDivisor) ++numFailed;
+		return VertexAttribDivisor(a0, a1);
+	}
+	PFNVERTEXATTRIBDIVISOR VertexAttribDivisor = Switch_VertexAttribDivisor;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP1UI)(GLuint, GLenum, GLboolean, GLuint);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP1ui(GLuint a0, GLenum a1, GLboolean a2, GLuint a3)
+	{
 		VertexAttribP1ui = reinterpret_cast<PFNVERTEXATTRIBP1UI>(IntGetProcAddress("glVertexAttribP1ui"));
-		if(!VertexAttribP1ui) ++numFailed;
+		return VertexAttribP1ui(a0, a1, a2, a3);
+	}
+	PFNVERTEXATTRIBP1UI VertexAttribP1ui = Switch_VertexAttribP1ui;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP1UIV)(GLuint, GLenum, GLboolean, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP1uiv(GLuint a0, GLenum a1, GLboolean a2, const GLuint *a3)
+	{
 		VertexAttribP1uiv = reinterpret_cast<PFNVERTEXATTRIBP1UIV>(IntGetProcAddress("glVertexAttribP1uiv"));
-		if(!VertexAttribP1uiv) ++numFailed;
+		return VertexAttribP1uiv(a0, a1, a2, a3);
+	}
+	PFNVERTEXATTRIBP1UIV VertexAttribP1uiv = Switch_VertexAttribP1uiv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP2UI)(GLuint, GLenum, GLboolean, GLuint);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP2ui(GLuint a0, GLenum a1, GLboolean a2, GLuint a3)
+	{
 		VertexAttribP2ui = reinterpret_cast<PFNVERTEXATTRIBP2UI>(IntGetProcAddress("glVertexAttribP2ui"));
-		if(!VertexAttribP2ui) ++numFailed;
+		return VertexAttribP2ui(a0, a1, a2, a3);
+	}
+	PFNVERTEXATTRIBP2UI VertexAttribP2ui = Switch_VertexAttribP2ui;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP2UIV)(GLuint, GLenum, GLboolean, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP2uiv(GLuint a0, GLenum a1, GLboolean a2, const GLuint *a3)
+	{
 		VertexAttribP2uiv = reinterpret_cast<PFNVERTEXATTRIBP2UIV>(IntGetProcAddress("glVertexAttribP2uiv"));
-		if(!VertexAttribP2uiv) ++numFailed;
+		return VertexAttribP2uiv(a0, a1, a2, a3);
+	}
+	PFNVERTEXATTRIBP2UIV VertexAttribP2uiv = Switch_VertexAttribP2uiv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP3UI)(GLuint, GLenum, GLboolean, GLuint);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP3ui(GLuint a0, GLenum a1, GLboolean a2, GLuint a3)
+	{
 		VertexAttribP3ui = reinterpret_cast<PFNVERTEXATTRIBP3UI>(IntGetProcAddress("glVertexAttribP3ui"));
-		if(!VertexAttribP3ui) ++numFailed;
+		return VertexAttribP3ui(a0, a1, a2, a3);
+	}
+	PFNVERTEXATTRIBP3UI VertexAttribP3ui = Switch_VertexAttribP3ui;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP3UIV)(GLuint, GLenum, GLboolean, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP3uiv(GLuint a0, GLenum a1, GLboolean a2, const GLuint *a3)
+	{
 		VertexAttribP3uiv = reinterpret_cast<PFNVERTEXATTRIBP3UIV>(IntGetProcAddress("glVertexAttribP3uiv"));
-		if(!VertexAttribP3uiv) ++numFailed;
+		return VertexAttribP3uiv(a0, a1, a2, a3);
+	}
+	PFNVERTEXATTRIBP3UIV VertexAttribP3uiv = Switch_VertexAttribP3uiv;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP4UI)(GLuint, GLenum, GLboolean, GLuint);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP4ui(GLuint a0, GLenum a1, GLboolean a2, GLuint a3)
+	{
 		VertexAttribP4ui = reinterpret_cast<PFNVERTEXATTRIBP4UI>(IntGetProcAddress("glVertexAttribP4ui"));
-		if(!VertexAttribP4ui) ++numFailed;
+		return VertexAttribP4ui(a0, a1, a2, a3);
+	}
+	PFNVERTEXATTRIBP4UI VertexAttribP4ui = Switch_VertexAttribP4ui;
+	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP4UIV)(GLuint, GLenum, GLboolean, const GLuint *);
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP4uiv(GLuint a0, GLenum a1, GLboolean a2, const GLuint *a3)
+	{
 		VertexAttribP4uiv = reinterpret_cast<PFNVERTEXATTRIBP4UIV>(IntGetProcAddress("glVertexAttribP4uiv"));
-		if(!VertexAttribP4uiv) ++numFailed;
-		return numFailed;
+		return VertexAttribP4uiv(a0, a1, a2, a3);
 	}
+	PFNVERTEXATTRIBP4UIV VertexAttribP4uiv = Switch_VertexAttribP4uiv;
 	
 	namespace sys
 	{
@@ -1512,13 +2603,19 @@ namespace gl
 			
 			void InitializeMappingTable(std::vector<MapEntry> &table)
 			{
-				table.reserve(1);
+				table.reserve(4);
 				table.push_back(MapEntry("GL_EXT_texture_compression_s3tc", &exts::var_EXT_texture_compression_s3tc));
+				table.push_back(MapEntry("GL_ARB_get_program_binary", &exts::var_ARB_get_program_binary, Load_ARB_get_program_binary));
+				table.push_back(MapEntry("GL_KHR_debug", &exts::var_KHR_debug, Load_KHR_debug));
+				table.push_back(MapEntry("GL_ARB_debug_output", &exts::var_ARB_debug_output, Load_ARB_debug_output));
 			}
 			
 			void ClearExtensionVars()
 			{
 				exts::var_EXT_texture_compression_s3tc = exts::LoadTest();
+				exts::var_ARB_get_program_binary = exts::LoadTest();
+				exts::var_KHR_debug = exts::LoadTest();
+				exts::var_ARB_debug_output = exts::LoadTest();
 			}
 			
 			void LoadExtByName(std::vector<MapEntry> &table, const char *extensionName)
@@ -1566,8 +2663,10 @@ namespace gl
 			
 			ProcExtsFromExtList(table);
 			
-			int numFailed = LoadCoreFunctions();
-			return exts::LoadTest(true, numFailed);
+			// Core functions start out as trampolines that resolve
+			// themselves on their first call, so only the entry points
+			// that are actually used are ever looked up.
+			return exts::LoadTest(true, 0);
 		}
 		
 		static int g_major_version = 0;
@@ -175,6 +175,9 @@ namespace gl
 		};
 		
 		extern LoadTest var_EXT_texture_compression_s3tc;
+		extern LoadTest var_ARB_get_program_binary;
+		extern LoadTest var_KHR_debug;
+		extern LoadTest var_ARB_debug_output;
 		
 	} //namespace exts
 	enum
@@ -184,6 +187,36 @@ namespace gl
 		COMPRESSED_RGBA_S3TC_DXT5_EXT    = 0x83F3,
 		COMPRESSED_RGB_S3TC_DXT1_EXT     = 0x83F0,
 		
+		NUM_PROGRAM_BINARY_FORMATS       = 0x87FE,
+		PROGRAM_BINARY_FORMATS           = 0x87FF,
+		PROGRAM_BINARY_LENGTH            = 0x8741,
+		PROGRAM_BINARY_RETRIEVABLE_HINT  = 0x8257,
+		
+		CONTEXT_FLAG_DEBUG_BIT           = 0x00000002,
+		DEBUG_CALLBACK_FUNCTION          = 0x8244,
+		DEBUG_CALLBACK_USER_PARAM        = 0x8245,
+		DEBUG_OUTPUT                     = 0x92E0,
+		DEBUG_OUTPUT_SYNCHRONOUS         = 0x8242,
+		DEBUG_SEVERITY_HIGH              = 0x9146,
+		DEBUG_SEVERITY_LOW               = 0x9148,
+		DEBUG_SEVERITY_MEDIUM            = 0x9147,
+		DEBUG_SEVERITY_NOTIFICATION      = 0x826B,
+		DEBUG_SOURCE_API                 = 0x8246,
+		DEBUG_SOURCE_APPLICATION         = 0x824A,
+		DEBUG_SOURCE_OTHER               = 0x824B,
+		DEBUG_SOURCE_SHADER_COMPILER     = 0x8248,
+		DEBUG_SOURCE_THIRD_PARTY         = 0x8249,
+		DEBUG_SOURCE_WINDOW_SYSTEM       = 0x8247,
+		DEBUG_TYPE_DEPRECATED_BEHAVIOR   = 0x824D,
+		DEBUG_TYPE_ERROR                 = 0x824C,
+		DEBUG_TYPE_MARKER                = 0x8268,
+		DEBUG_TYPE_OTHER                 = 0x8251,
+		DEBUG_TYPE_PERFORMANCE           = 0x8250,
+		DEBUG_TYPE_POP_GROUP             = 0x826A,
+		DEBUG_TYPE_PORTABILITY           = 0x824F,
+		DEBUG_TYPE_PUSH_GROUP            = 0x8269,
+		DEBUG_TYPE_UNDEFINED_BEHAVIOR    = 0x824E,
+		
 		ALPHA                            = 0x1906,
 		ALWAYS                           = 0x0207,
 		AND                              = 0x1501,
@@ -999,6 +1032,23 @@ namespace gl
 		
 	};
 	
+	// Extension: ARB_get_program_binary
+	extern void (CODEGEN_FUNCPTR *GetProgramBinary)(GLuint program, GLsizei bufSize, GLsizei * length, GLenum * binaryFormat, void * binary);
+	extern void (CODEGEN_FUNCPTR *ProgramBinary)(GLuint program, GLenum binaryFormat, const void * binary, GLsizei length);
+	extern void (CODEGEN_FUNCPTR *ProgramParameteri)(GLuint program, GLenum pname, GLint value);
+	
+	// Extension: KHR_debug
+	extern void (CODEGEN_FUNCPTR *DebugMessageCallback)(GLDEBUGPROC callback, const void * userParam);
+	extern void (CODEGEN_FUNCPTR *DebugMessageControl)(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint * ids, GLboolean enabled);
+	extern void (CODEGEN_FUNCPTR *DebugMessageInsert)(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar * buf);
+	extern void (CODEGEN_FUNCPTR *PopDebugGroup)(void);
+	extern void (CODEGEN_FUNCPTR *PushDebugGroup)(GLenum source, GLuint id, GLsizei length, const GLchar * message);
+	
+	// Extension: ARB_debug_output
+	extern void (CODEGEN_FUNCPTR *DebugMessageCallbackARB)(GLDEBUGPROCARB callback, const void * userParam);
+	extern void (CODEGEN_FUNCPTR *DebugMessageControlARB)(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint * ids, GLboolean enabled);
+	extern void (CODEGEN_FUNCPTR *DebugMessageInsertARB)(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar * buf);
+	
 	extern void (CODEGEN_FUNCPTR *BlendFunc)(GLenum sfactor, GLenum dfactor);
 	extern void (CODEGEN_FUNCPTR *Clear)(GLbitfield mask);
 	extern void (CODEGEN_FUNCPTR *ClearColor)(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
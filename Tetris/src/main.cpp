@@ -5,179 +5,215 @@
 #include <glm/gtx/transform.hpp>
 #include <cstdlib>
 #include <ctime>
-#include <sstream>
+#include <algorithm>
 #include "Image.hpp"
 #include "Texture.hpp"
 #include "PNGCodec.hpp"
+#include "Vertex.hpp"
+#include "TextureAtlas.hpp"
+#include "SpriteBatch.hpp"
+#include "RenderQueue.hpp"
+#include "BitmapFont.hpp"
+#include "Text.hpp"
+#include "ShaderProgram.hpp"
+#include "UniformBuffer.hpp"
+#include "Game.hpp"
+#include "RenderTarget.hpp"
+#include "SoftwareRasterizer.hpp"
+#include "FrameCapture.hpp"
+#include "DebugOutput.hpp"
+#include "FrameArena.hpp"
+#include "AllocationCounter.hpp"
+#include "Trace.hpp"
+#include "FrameLimiter.hpp"
+#include <cassert>
+#include <cstdio>
 
 
 #define WIDTH 800
 #define HEIGHT 600
 
-struct Color
+// Every visible cell of the board as two triangles.
+const size_t MAX_BLOCK_VERTICES = GameBoard::VISIBLE_ROWS * GameBoard::COLUMNS * 6;
+const double UPDATE_TIME = 1.0 / TICKS_PER_SECOND;
+const size_t FRAME_ARENA_SIZE = 64 * 1024;
+// Frames before the steady state allocation check starts.
+const unsigned int WARMUP_FRAMES = 120;
+// Longest sleep of the idle loop between two looks at the window.
+const double IDLE_WAIT_TIME = 0.25;
+
+// Set from the GLFW callbacks, read by the main loop.
+struct WindowState
 {
-	float r, g, b, a;
+	bool redraw;
+	bool paused;
+	// Time of the first key press not yet on screen, zero if none.
+	double inputTime;
+};
 
-	bool operator==(const Color &col)
+int RunSoftware(unsigned int frames, const std::string &output);
+void OnKey(GLFWwindow *wnd, int key, int scancode, int action, int mods);
+void OnWindowRefresh(GLFWwindow *wnd);
+void OnWindowFocus(GLFWwindow *wnd, int focused);
+void OnWindowIconify(GLFWwindow *wnd, int iconified);
+
+// --headless renders into an offscreen framebuffer, --software does the
+// same on the CPU without a GL context. Both run a fixed number of ticks
+// with a fixed seed and no input, then write the last frame to a PNG.
+// --capture prefix records every frame as PNG, or raw with --capture-raw.
+// --gl-debug asks for a debug context and logs driver messages.
+// --trace file writes a Chrome trace on exit and whenever F12 is pressed.
+// --pacing rate turns vsync off and limits the frame rate instead, input is
+// then sampled right before the frame is built. Input to present latency is
+// printed on exit. --latency measures it with vsync too, at the cost of a
+// stall after every frame with a key press.
+// P pauses, so does losing focus or minimizing. While paused or after game
+// over the window is only redrawn on input or when the system asks for it.
+int main(int argc, char *argv[])
+{
+	bool headless = false;
+	bool software = false;
+	bool glDebug = false;
+	std::string traceFile;
+	double pacingRate = 0.0;
+	bool measureLatency = false;
+	unsigned int frames = 600;
+	std::string output = "frame";
+	std::string capturePrefix;
+	CaptureFormat captureFormat = CaptureFormat::PNG;
+
+	for (int i = 1; i < argc; i++)
 	{
-		return (r == col.r && g == col.g && b == col.b && a == col.a);
+		std::string arg = argv[i];
+
+		if (arg == "--headless")
+			headless = true;
+		else if (arg == "--software")
+			headless = software = true;
+		else if (arg == "--frames" && i + 1 < argc)
+			frames = std::strtoul(argv[++i], nullptr, 10);
+		else if (arg == "--output" && i + 1 < argc)
+			output = argv[++i];
+		else if (arg == "--capture" && i + 1 < argc)
+			capturePrefix = argv[++i];
+		else if (arg == "--capture-raw")
+			captureFormat = CaptureFormat::RAW;
+		else if (arg == "--gl-debug")
+			glDebug = true;
+		else if (arg == "--trace" && i + 1 < argc)
+			traceFile = argv[++i];
+		else if (arg == "--pacing" && i + 1 < argc)
+			pacingRate = std::strtod(argv[++i], nullptr);
+		else if (arg == "--latency")
+			measureLatency = true;
 	}
-};
 
-#pragma pack(push, 1)
-struct Vertex
-{
-	float x, y;
-	float r, g, b, a;
-};
+	if (!traceFile.empty())
+	{
+		Trace::SetEnabled(true);
+		Trace::SetThreadName("main");
+	}
+
+	if (software)
+		return RunSoftware(frames, output);
 
-struct TextureVertex
-{
-	float x, y, u, v;
-};
-#pragma pack(pop)
-
-GLuint LoadProgram(const char *vs, const char *fs);
-void CreateGrid(void *vboData, size_t &vboOffset, float x, float y, 
-	float width, float height, size_t *linesCount);
-size_t PrepareDynamicBuffer(GLuint vbo, Color* table[][10], float x, float y, float width, float height);
-size_t CreateLine(GLuint vbo, size_t offset, Color col, float x, float y, float width, float height);
-void PlaceTetramino(Color* table[][10], Color* (*tetramino)[4], int32_t x, int32_t y);
-void RemoveTetramino(Color* table[][10], Color* (*tetramino)[4], int32_t x, int32_t y);
-void GetTopCoords(Color* (*tetramino)[4], int32_t *x, int32_t *y);
-bool CheckCollision(Color* table[][10], Color* (*tetramino)[4], int32_t x, int32_t y);
-void CopyTetramino(Color* (*dst)[4], Color* (*src)[4]);
-void RotateTetraminoLeft(Color* (*tetramino)[4]);
-void RotateTetraminoRight(Color* (*tetramino)[4]);
-void LookForLines(Color* table[][10], int32_t indices[4]);
-void RemoveLine(Color* table[][10], uint32_t index);
-
-int main()
-{
 	glfwInit();
 	glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_API);
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
 	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-	GLFWwindow *wnd = glfwCreateWindow(WIDTH, HEIGHT, "Tetris Score: 0", nullptr, nullptr);
+
+	if (headless)
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+	if (glDebug)
+		glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GLFW_TRUE);
+
+	GLFWwindow *wnd = glfwCreateWindow(WIDTH, HEIGHT, "Tetris", nullptr, nullptr);
 	glfwMakeContextCurrent(wnd);
 	gl::sys::LoadFunctions();
-	srand(time(nullptr));
-	gl::Enable(gl::BLEND);
-	gl::BlendFunc(gl::SRC_ALPHA, gl::ONE_MINUS_SRC_ALPHA);
-	glfwSwapInterval(1);
-
-	glm::mat4x4 orthoMatrix;
-	GLuint program;
-	GLuint textureProgram;
+
+	std::unique_ptr<DebugOutput> debugOutput;
+	unsigned int warningFrames = 0;
+	unsigned int maxFrameWarnings = 0;
+
+	if (glDebug)
+	{
+		debugOutput.reset(new DebugOutput());
+
+		if (!debugOutput->install())
+			debugOutput.reset();
+	}
+
+	glfwSwapInterval(headless || pacingRate > 0.0 ? 0 : 1);
+
+	std::unique_ptr<FrameLimiter> frameLimiter;
+
+	if (!headless && pacingRate > 0.0)
+		frameLimiter.reset(new FrameLimiter(pacingRate));
+
+	WindowState windowState = { true, false, 0.0 };
+
+	if (!headless)
+	{
+		glfwSetWindowUserPointer(wnd, &windowState);
+		glfwSetKeyCallback(wnd, OnKey);
+		glfwSetWindowRefreshCallback(wnd, OnWindowRefresh);
+		glfwSetWindowFocusCallback(wnd, OnWindowFocus);
+		glfwSetWindowIconifyCallback(wnd, OnWindowIconify);
+	}
+
+	std::unique_ptr<RenderTarget> renderTarget;
+
+	if (headless)
+	{
+		renderTarget.reset(new RenderTarget(WIDTH, HEIGHT));
+
+		if (!renderTarget->isComplete())
+		{
+			// TODO: Error handling.
+			glfwDestroyWindow(wnd);
+			glfwTerminate();
+			return 1;
+		}
+
+		renderTarget->bind();
+	}
+
+	FrameConstants frameConstants;
+	UniformBuffer frameConstantsBuffer(sizeof(FrameConstants), FRAME_CONSTANTS_BINDING);
+	std::shared_ptr<ShaderProgram> program;
+	std::shared_ptr<ShaderProgram> blockProgram;
+	std::shared_ptr<ShaderProgram> textureProgram;
 	GLuint sampler;
-	GLint samplerLocation;
-	GLint orthoMatrixLocation1;
-	GLint orthoMatrixLocation2;
 	GLuint dynamicVao;
 	GLuint dynamicVbo;
 	std::vector<Vertex> staticVertexData;
+	std::vector<GLushort> staticIndexData;
 	GLuint staticVao;
 	GLuint staticVbo;
-	size_t staticVboOffset;
-	void *staticVboData;
-	std::vector<TextureVertex> dynamicTextureVertexData;
-	GLuint dynamicTextureVao;
-	GLuint dynamicTextureVbo;
-	size_t linesOffset;
-	size_t linesCount;
-	Color colors[8] =
-	{
-		Color { 0.0f, 0.0f, 0.0f, 1.0f },
-		Color { 0.192f, 0.78f, 0.937f, 1.0f },
-		Color { 0.969f, 0.827f, 0.031f, 1.0f },
-		Color { 0.678f, 0.302f, 0.612f, 1.0f },
-		Color { 0.004f, 0.8f, 0.0f, 1.0f },
-		Color { 0.8f, 0.0f, 0.0f, 1.0f },
-		Color { 0.0f, 0.0f, 0.8f, 1.0f },
-		Color { 0.937f, 0.475f, 0.129f, 1.0f },
-	};
-
-	Color* table[22][10];
-	Color* tetraminoType[7][4][4] =
-	{
-		{ // I-type
-			{ nullptr, nullptr, nullptr, nullptr },
-			{ &colors[1], &colors[1], &colors[1], &colors[1] },
-			{ nullptr, nullptr, nullptr, nullptr },
-			{ nullptr, nullptr, nullptr, nullptr }
-		},
-
-		{ // O-type
-			{ nullptr, nullptr, nullptr, nullptr },
-			{ nullptr, &colors[2], &colors[2], nullptr },
-			{ nullptr, &colors[2], &colors[2], nullptr },
-			{ nullptr, nullptr, nullptr, nullptr }
-		},
-
-		{ // T-type
-			{ nullptr, nullptr, nullptr, nullptr },
-			{ nullptr, &colors[3], nullptr, nullptr },
-			{ &colors[3], &colors[3], &colors[3], nullptr },
-			{ nullptr, nullptr, nullptr, nullptr }
-		},
-
-		{ // S-type
-			{ nullptr, nullptr, nullptr, nullptr },
-			{ nullptr, &colors[4], &colors[4], nullptr },
-			{ &colors[4], &colors[4], nullptr, nullptr },
-			{ nullptr, nullptr, nullptr, nullptr }
-		},
-
-		{ // Z-type
-			{ nullptr, nullptr, nullptr, nullptr },
-			{ &colors[5], &colors[5], nullptr, nullptr },
-			{ nullptr, &colors[5], &colors[5], nullptr },
-			{ nullptr, nullptr, nullptr, nullptr }
-		},
-
-		{ // J-type
-			{ nullptr, nullptr, nullptr, nullptr },
-			{ &colors[6], nullptr, nullptr, nullptr },
-			{ &colors[6], &colors[6], &colors[6], nullptr },
-			{ nullptr, nullptr, nullptr, nullptr }
-		},
-
-		{ // L-type
-			{ nullptr, nullptr, nullptr, nullptr },
-			{ nullptr, nullptr, &colors[7], nullptr },
-			{ &colors[7], &colors[7], &colors[7], nullptr },
-			{ nullptr, nullptr, nullptr, nullptr }
-		}
-	};
-	Color* currTetramino[4][4];
-
-	for (int i = 0; i < 22 * 10; i++)
-		table[i / 10][i % 10] = nullptr;
-
+	GLuint staticIbo;
+	Game game(headless ? 0 : static_cast<uint32_t>(time(nullptr)));
 
-	program = LoadProgram(VERTEX_SHADER, FRAGMENT_SHADER);
-	textureProgram = LoadProgram(VERTEX_TEXTURE_SHADER, FRAGMENT_TEXTURE_SHADER);
+	ShaderProgram::SetUniformBlockBinding(FRAME_CONSTANTS_BLOCK_NAME, FRAME_CONSTANTS_BINDING);
+	program = ShaderProgram::Get(VERTEX_SHADER, FRAGMENT_SHADER);
+	blockProgram = ShaderProgram::Get(VERTEX_SHADER, FRAGMENT_BLOCK_SHADER);
+	textureProgram = ShaderProgram::Get(VERTEX_TEXTURE_SHADER, FRAGMENT_TEXTURE_SHADER);
 	gl::GenVertexArrays(1, &staticVao);
 	gl::GenBuffers(1, &staticVbo);
+	gl::GenBuffers(1, &staticIbo);
 
-	// Fullscreen Quad;
-	staticVertexData.push_back(Vertex{ 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f });
-	staticVertexData.push_back(Vertex{ 400.0f, 600.0f, 0.0f, 1.0f, 0.0f, 1.0f });
-	staticVertexData.push_back(Vertex{ 800.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f });
-	
+	CreateGrid(staticVertexData, staticIndexData, GameBoard::COLUMNS, GameBoard::VISIBLE_ROWS,
+		255.0f, 10.0f, 290.0f, 580.0f);
+
+	// Static buffers are allocated once with their final contents.
 	gl::BindVertexArray(staticVao);
 	gl::BindBuffer(gl::ARRAY_BUFFER, staticVbo);
-	gl::BufferData(gl::ARRAY_BUFFER, 1024*1024*4, 
-		nullptr, gl::STATIC_DRAW);
-
-	staticVboData = gl::MapBuffer(gl::ARRAY_BUFFER, gl::WRITE_ONLY);
-	staticVboOffset = 0;
-	memcpy(staticVboData, staticVertexData.data(), sizeof(Vertex) * staticVertexData.size());
-	staticVboOffset += sizeof(Vertex) * staticVertexData.size();
-	linesOffset = staticVertexData.size();
-	CreateGrid(staticVboData, staticVboOffset, 255.0f, 10.0f, 290.0f, 580.0f, &linesCount);
-	gl::UnmapBuffer(gl::ARRAY_BUFFER);
+	gl::BufferData(gl::ARRAY_BUFFER, staticVertexData.size() * sizeof(Vertex),
+		staticVertexData.data(), gl::STATIC_DRAW);
+	gl::BindBuffer(gl::ELEMENT_ARRAY_BUFFER, staticIbo);
+	gl::BufferData(gl::ELEMENT_ARRAY_BUFFER, staticIndexData.size() * sizeof(GLushort),
+		staticIndexData.data(), gl::STATIC_DRAW);
 
 	gl::EnableVertexAttribArray(0);
 	gl::VertexAttribPointer(0, 2, gl::FLOAT, gl::FALSE_,
@@ -191,7 +227,7 @@ int main()
 	gl::BindVertexArray(dynamicVao);
 	gl::GenBuffers(1, &dynamicVbo);
 	gl::BindBuffer(gl::ARRAY_BUFFER, dynamicVbo);
-	gl::BufferData(gl::ARRAY_BUFFER, 1024 * 1024 * 4, nullptr, gl::DYNAMIC_DRAW);
+	gl::BufferData(gl::ARRAY_BUFFER, MAX_BLOCK_VERTICES * sizeof(Vertex), nullptr, gl::DYNAMIC_DRAW);
 	gl::EnableVertexAttribArray(0);
 	gl::VertexAttribPointer(0, 2, gl::FLOAT, gl::FALSE_,
 		sizeof(Vertex), 0);
@@ -200,566 +236,375 @@ int main()
 		sizeof(Vertex), (GLvoid*)(2 * sizeof(float)));
 
 
-	gl::GenVertexArrays(1, &dynamicTextureVao);
-	gl::BindVertexArray(dynamicTextureVao);
-	gl::GenBuffers(1, &dynamicTextureVbo);
-	gl::BindBuffer(gl::ARRAY_BUFFER, dynamicTextureVbo);
-	gl::BufferData(gl::ARRAY_BUFFER, 1024 * 1024, nullptr, gl::DYNAMIC_DRAW);
-	gl::EnableVertexAttribArray(0);
-	gl::VertexAttribPointer(0, 2, gl::FLOAT, gl::FALSE_, sizeof(TextureVertex), 0);
-	gl::EnableVertexAttribArray(1);
-	gl::VertexAttribPointer(1, 2, gl::FLOAT, gl::FALSE_, sizeof(TextureVertex), (GLvoid*)(2 * sizeof(float)));
-
-
-	dynamicTextureVertexData.push_back(TextureVertex{ 0.0f, 0.0f, 0.0f, 0.0f });
-	dynamicTextureVertexData.push_back(TextureVertex{ 0.0f, 600.0f, 0.0f, 1.0f });
-	dynamicTextureVertexData.push_back(TextureVertex{ 800.0f, 0.0f, 1.0f, 0.0f });
-
-	dynamicTextureVertexData.push_back(TextureVertex{ 0.0f, 600.0f, 0.0f, 1.0f });
-	dynamicTextureVertexData.push_back(TextureVertex{ 800.0f, 0.0f, 1.0f, 0.0f });
-	dynamicTextureVertexData.push_back(TextureVertex{ 800.0f, 600.0f, 1.0f, 1.0f });
-
-	gl::BufferSubData(gl::ARRAY_BUFFER, 0, dynamicTextureVertexData.size() * sizeof(TextureVertex), dynamicTextureVertexData.data());
-
 	gl::GenSamplers(1, &sampler);
 	gl::SamplerParameteri(sampler, gl::TEXTURE_WRAP_S, gl::CLAMP_TO_EDGE);
 	gl::SamplerParameteri(sampler, gl::TEXTURE_WRAP_T, gl::CLAMP_TO_EDGE);
-	gl::SamplerParameteri(sampler, gl::TEXTURE_MIN_FILTER, gl::LINEAR);
+	gl::SamplerParameteri(sampler, gl::TEXTURE_MIN_FILTER, gl::LINEAR_MIPMAP_LINEAR);
 	gl::SamplerParameteri(sampler, gl::TEXTURE_MAG_FILTER, gl::LINEAR);
 
 	gl::ClearColor(0.8f, 0.8f, 0.8f, 1.0f);
 	gl::Viewport(0, 0, WIDTH, HEIGHT);
-	orthoMatrix = glm::ortho(0.0f, (float)WIDTH, 0.0f, (float)HEIGHT);
-	orthoMatrixLocation1 = gl::GetUniformLocation(program, "orthoMatrix");
-	orthoMatrixLocation2 = gl::GetUniformLocation(textureProgram, "orthoMatrix");
-	samplerLocation = gl::GetUniformLocation(textureProgram, "tex");
+	frameConstants.projection = glm::ortho(0.0f, (float)WIDTH, 0.0f, (float)HEIGHT);
+	frameConstants.time = 0.0f;
+	frameConstants.clearStartTime = 0.0f;
+	frameConstants.clearedRows = 0;
+	frameConstants.boardRows = (float)GameBoard::VISIBLE_ROWS;
+	frameConstants.boardRect[0] = 255.0f;
+	frameConstants.boardRect[1] = 10.0f;
+	frameConstants.boardRect[2] = 290.0f;
+	frameConstants.boardRect[3] = 580.0f;
+	textureProgram->use();
+	gl::Uniform1i(textureProgram->getUniformLocation("tex"), 0);
+
+	std::unique_ptr<FrameCapture> frameCapture;
+
+	if (!capturePrefix.empty())
+		frameCapture.reset(new FrameCapture(WIDTH, HEIGHT, capturePrefix, captureFormat));
 
 	Image endImage;
-	Texture endTexture;
+	TextureAtlas atlas(1024, 1024, ColorFormat::RGBA8);
+	SpriteBatch spriteBatch(256);
+	RenderQueue renderQueue;
+	AtlasRegion endRegion;
+
+	// Without the picture game over is only shown by the score text.
+	bool hasEndImage = endImage.loadFromFile("endImage.png", &PNGCodec());
 
-	endImage.loadFromFile("endImage.png", &PNGCodec());
-	endTexture.createFromImage(endImage);
+	if (hasEndImage)
+	{
+		endImage.convert(ColorFormat::RGBA8);
+		hasEndImage = atlas.insert(endImage, &endRegion);
+	}
+
+	BitmapFont font;
+	font.loadFromFile("font.png", atlas, 16, 6);
+	Text scoreText(font, 64);
+	scoreText.setPosition(20.0f, 580.0f);
+	// The longest strings of a game over and a pause, so the allocation
+	// check never sees them for the first time.
+	scoreText.setString("Score: 4294967295\nGAME OVER");
+	scoreText.setString("Score: 4294967295\nPAUSED");
+	scoreText.setString("Score: 0");
 	
-	double lastTime, currTime = lastTime = glfwGetTime();
+	double lastTime, currTime = lastTime = headless ? 0.0 : glfwGetTime();
 	double dt;
 	double acc = 0.0;
-	const double UPDATE_TIME = 1 / 60.0;
-	std::stringstream str;
-	double downAcceleration = 0.05;
-	double downSpeed = 2.0;
-	double downFastSpeed = 30.0;
-	double sideSpeed = 17.0;
-	double x = 0.0, y = 0.0;
-	int32_t ix = 0, iy = 0.0;
-	double dx = 0.0, dy = 0.0;
 	uint32_t points = 0;
-	size_t countBlocksVertices = 0;
-	size_t countLinesVertices = 0;
-	bool needNew = true;
 	bool gameOver = false;
-	int space;
-	bool removeAnimation = false;
-	double animationTime = 0.0;
-	int32_t linesToRemove[4] = { -1, -1, -1, -1 };
+	bool paused = false;
+	unsigned int frame = 0;
+	unsigned int frameCount = 0;
+	char scoreString[64];
+	bool traceKeyDown = false;
+	unsigned int latencyCount = 0;
+	double latencySum = 0.0;
+	double latencyMax = 0.0;
+	FrameArena frameArena(FRAME_ARENA_SIZE);
 
 	while (!glfwWindowShouldClose(wnd))
 	{
-		currTime = glfwGetTime();
-		dt = currTime - lastTime;
-		lastTime = currTime;
-		acc += dt;
+		// Nothing moves, sleep until something happens. Captures keep every frame.
+		if (!headless && !frameCapture && (gameOver || paused) && !windowState.redraw)
+		{
+			{
+				TRACE_SCOPE("wait");
+				glfwWaitEventsTimeout(IDLE_WAIT_TIME);
+			}
 
-		glfwPollEvents();
+			// Time spent waiting is not played.
+			lastTime = glfwGetTime();
+			continue;
+		}
 
-		gl::Clear(gl::COLOR_BUFFER_BIT);
+		windowState.redraw = false;
 
+		TRACE_SCOPE("frame");
+#ifdef TRACK_ALLOCATIONS
+		uint64_t frameAllocations = GetAllocationCount();
+#endif
+		frameArena.reset();
 
-		if (glfwGetKey(wnd, GLFW_KEY_ESCAPE) == GLFW_PRESS)
-			glfwSetWindowShouldClose(wnd, 0);
-
-		while (acc >= UPDATE_TIME)
+		// Wait before sampling anything so input is as fresh as possible.
+		if (frameLimiter)
 		{
-			if (gameOver == true)
-				break;
-
-			if (glfwGetKey(wnd, GLFW_KEY_SPACE) == GLFW_PRESS)
-				space += 1;
+			TRACE_SCOPE("limit");
+			frameLimiter->wait();
+		}
 
-			if (glfwGetKey(wnd, GLFW_KEY_SPACE) == GLFW_RELEASE)
-				space = 0;
+		// Headless runs advance exactly one tick per frame.
+		if (headless)
+			currTime = frame * UPDATE_TIME;
+		else
+			currTime = glfwGetTime();
 
-			if (glfwGetKey(wnd, GLFW_KEY_LEFT) == GLFW_PRESS)
-				dx = -UPDATE_TIME * sideSpeed;
+		dt = currTime - lastTime;
+		lastTime = currTime;
+		acc += headless ? UPDATE_TIME : dt;
 
-			if (glfwGetKey(wnd, GLFW_KEY_RIGHT) == GLFW_PRESS)
-				dx = UPDATE_TIME * sideSpeed;
+		{
+			TRACE_SCOPE("poll");
+			glfwPollEvents();
+		}
 
-			downSpeed += UPDATE_TIME * downAcceleration;
-			downFastSpeed += UPDATE_TIME * downAcceleration;
+		gl::Clear(gl::COLOR_BUFFER_BIT);
 
-			if (glfwGetKey(wnd, GLFW_KEY_DOWN) == GLFW_PRESS)
-				dy = UPDATE_TIME * downFastSpeed;
-			else
-				dy = UPDATE_TIME * downSpeed;
 
+		if (glfwGetKey(wnd, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+			glfwSetWindowShouldClose(wnd, 0);
 
-			// Checks if it's time to choose new tetramino and if so
-			// places in on top of the table.
-			if (needNew)
-			{
-				CopyTetramino(currTetramino, tetraminoType[rand() % 7]);
-				GetTopCoords(currTetramino, &ix, &iy);
-				x = ix;
-				y = iy;
-
-				if (!CheckCollision(table, currTetramino, x, y))
-				{
-					std::stringstream str;
-					str << "Tetris Score: " << points << " GAME OVER";
-					gameOver = true;
-					glfwSetWindowTitle(wnd, str.str().c_str());
-				}
-				
-				needNew = false;
-			}
+		GameInput input = {};
 
-			// Rotating tetramino.
-			if (space == 1)
-			{
-				RotateTetraminoRight(currTetramino);
-
-				if (CheckCollision(table, currTetramino, x, y));
-				else if (CheckCollision(table, currTetramino, x + 1.0, y))
-					x += 1.0;
-				else if (CheckCollision(table, currTetramino, x - 1.0, y))
-					x -= 1.0;
-				else 
-				{
-					RotateTetraminoLeft(currTetramino);
-					RotateTetraminoLeft(currTetramino);
-
-					if (!CheckCollision(table, currTetramino, x, y))
-						RotateTetraminoRight(currTetramino);
-				}
-			}
+		if (!headless)
+		{
+			input.left = glfwGetKey(wnd, GLFW_KEY_LEFT) == GLFW_PRESS;
+			input.right = glfwGetKey(wnd, GLFW_KEY_RIGHT) == GLFW_PRESS;
+			input.down = glfwGetKey(wnd, GLFW_KEY_DOWN) == GLFW_PRESS;
+			input.rotate = glfwGetKey(wnd, GLFW_KEY_SPACE) == GLFW_PRESS;
+			input.drop = glfwGetKey(wnd, GLFW_KEY_UP) == GLFW_PRESS;
 
+			bool traceKey = glfwGetKey(wnd, GLFW_KEY_F12) == GLFW_PRESS;
 
-			PlaceTetramino(table, currTetramino, x, y);
-			countLinesVertices = 0;
-			countBlocksVertices = PrepareDynamicBuffer(dynamicVbo, table, 255.0f, 10.0f, 290.0f, 580.0f);
-			RemoveTetramino(table, currTetramino, x, y);
-			
-			// Tetramino go down or stays on its place.
-			if (!CheckCollision(table, currTetramino, x, y + dy))
-			{
-				PlaceTetramino(table, currTetramino, x, y);
-				needNew = true;
-			}
-			else if (CheckCollision(table, currTetramino, x + dx, y + dy))
-				x += dx;
-		
-			y += dy;
+			if (traceKey && !traceKeyDown && !traceFile.empty())
+				Trace::WriteChromeJson(traceFile);
 
-			if (removeAnimation == false && needNew == true)
-			{
-				LookForLines(table, linesToRemove);
-				animationTime = 0.0;
+			traceKeyDown = traceKey;
+		}
 
-				if (linesToRemove[0] != -1)
-					removeAnimation = true;
-			}
+		if (windowState.paused)
+			acc = 0.0;
+		else
+		{
+			TRACE_SCOPE("tick");
 
-			if (removeAnimation == true)
+			while (acc >= UPDATE_TIME)
 			{
-				if (animationTime > 0.5)
-				{
-					uint32_t sum = 0;
-					uint32_t multiplier = 0;
-					for (int i = 0; i < 4 && linesToRemove[i] != -1; i++)
-					{
-						sum += (22 - linesToRemove[i]) * 5;
-						multiplier++;
-						RemoveLine(table, linesToRemove[i]);
-					}
-
-					points += sum * multiplier;
-
-					std::stringstream str;
-					str << "Tetris Score: " << points;
-					glfwSetWindowTitle(wnd, str.str().c_str());
-
-					removeAnimation = false;
-				}
-
-				float alpha = animationTime < 0.3 ? (float)animationTime / 0.3f : 1.0f;
-
-				for (int i = 0; i < 4 && linesToRemove[i] != -1; i++)
-					countLinesVertices += CreateLine(dynamicVbo, (countBlocksVertices + countLinesVertices) * sizeof(Vertex),
-						Color{ 0.8f, 0.8f, 0.8f, alpha }, 255.0f, 10.0f + (21 - linesToRemove[i]) * 580.0f / 20.0f,
-						290.0f, 580.0f / 20.0f);
-
-				animationTime += UPDATE_TIME;
+				game.update(input);
+				acc -= UPDATE_TIME;
 			}
+		}
 
-			dy = 0.0;
-			dx = 0.0;
-
-			acc -= UPDATE_TIME;
+		if (game.getPoints() != points || game.isGameOver() != gameOver || windowState.paused != paused)
+		{
+			points = game.getPoints();
+			gameOver = game.isGameOver();
+			paused = windowState.paused;
+			snprintf(scoreString, sizeof(scoreString), "Score: %u%s", points,
+				gameOver ? "\nGAME OVER" : paused ? "\nPAUSED" : "");
+			scoreText.setString(scoreString);
 		}
 
-		gl::UseProgram(program);
-		gl::UniformMatrix4fv(orthoMatrixLocation1, 1, gl::FALSE_, &orthoMatrix[0][0]);
+		uint32_t clearedRows = game.getClearedRows();
 
-		gl::BindVertexArray(dynamicVao);
-		gl::DrawArrays(gl::TRIANGLES, 0, countBlocksVertices + countLinesVertices);
+		if (clearedRows != 0 && frameConstants.clearedRows == 0)
+			frameConstants.clearStartTime = (float)currTime;
 
-		gl::BindVertexArray(staticVao);
-		gl::DrawArrays(gl::LINES, linesOffset, linesCount);
+		frameConstants.clearedRows = clearedRows;
+
+		GLsizei blockVertexCount;
 
-		if (gameOver == true)
 		{
-			gl::UseProgram(textureProgram);
-			gl::Uniform1i(samplerLocation, 0);
-			gl::UniformMatrix4fv(orthoMatrixLocation1, 1, gl::FALSE_, &orthoMatrix[0][0]);
+			TRACE_SCOPE("buffer prep");
+			FrameVector<Vertex> blockVertexData{ FrameAllocator<Vertex>(frameArena) };
+			blockVertexData.reserve(MAX_BLOCK_VERTICES);
+			game.buildBlockVertices(blockVertexData, 255.0f, 10.0f, 290.0f, 580.0f);
+			gl::BindBuffer(gl::ARRAY_BUFFER, dynamicVbo);
+			gl::BufferSubData(gl::ARRAY_BUFFER, 0, blockVertexData.size() * sizeof(Vertex),
+				blockVertexData.data());
+			blockVertexCount = (GLsizei)blockVertexData.size();
+
+			frameConstants.time = (float)currTime;
+			frameConstantsBuffer.update(&frameConstants, sizeof(FrameConstants));
+		}
 
-			endTexture.bind(0);
+		{
+			TRACE_SCOPE("draw");
+			DrawCommand command = { RenderLayer::BOARD, BlendMode::ALPHA, blockProgram->getId(),
+				dynamicVao, 0, 0, gl::TRIANGLES, 0, blockVertexCount };
+			renderQueue.submit(command);
+
+			command.layer = RenderLayer::GRID;
+			command.program = program->getId();
+			command.vao = staticVao;
+			command.primitive = gl::LINES;
+			command.first = 0;
+			command.count = staticIndexData.size();
+			command.indexType = gl::UNSIGNED_SHORT;
+			renderQueue.submit(command);
+
+			command.program = textureProgram->getId();
+			command.texture = atlas.getTexture().getId();
+			command.sampler = sampler;
+
+			if (gameOver == true && hasEndImage)
+			{
+				command.layer = RenderLayer::OVERLAY;
+				spriteBatch.begin();
+				spriteBatch.draw(endRegion, 0.0f, 0.0f, (float)WIDTH, (float)HEIGHT);
+				spriteBatch.end(renderQueue, command);
+			}
 
-			gl::BindSampler(0, sampler);
+			command.layer = RenderLayer::UI;
+			scoreText.draw(renderQueue, command);
 
-			gl::BindVertexArray(dynamicTextureVao);
-			gl::DrawArrays(gl::TRIANGLES, 0, 6);
+			renderQueue.flush();
 		}
 
-		glfwSwapBuffers(wnd);
-	}
+		if (frameCapture)
+			frameCapture->capture();
 
-	glfwDestroyWindow(wnd);
-	glfwTerminate();
-	return 0;
-}
+		if (headless)
+		{
+			if (++frame >= frames)
+				glfwSetWindowShouldClose(wnd, 1);
+		}
+		else
+		{
+			TRACE_SCOPE("swap");
+			glfwSwapBuffers(wnd);
 
-GLuint LoadProgram(const char *vs, const char *fs)
-{
-	GLuint vertexShaderID = gl::CreateShader(gl::VERTEX_SHADER);
-	GLuint fragmentShaderID = gl::CreateShader(gl::FRAGMENT_SHADER);
-	GLint result;
-	GLint logLength;
-	gl::ShaderSource(vertexShaderID, 1, (const GLchar**)&vs, nullptr);
-	gl::CompileShader(vertexShaderID);
-	gl::GetShaderiv(vertexShaderID, gl::COMPILE_STATUS, &result);
-	gl::GetShaderiv(vertexShaderID, gl::INFO_LOG_LENGTH, &logLength);
-	char *vslog = new char[logLength + 1];
-	vslog[logLength] = '\0';
-	gl::GetShaderInfoLog(vertexShaderID, logLength, nullptr, vslog);
-	std::cout << vslog << std::endl;
-	delete[] vslog;
-
-	gl::ShaderSource(fragmentShaderID, 1, (const GLchar**)&fs, nullptr);
-	gl::CompileShader(fragmentShaderID);
-	gl::GetShaderiv(fragmentShaderID, gl::COMPILE_STATUS, &result);
-	gl::GetShaderiv(fragmentShaderID, gl::INFO_LOG_LENGTH, &logLength);
-	char *fslog = new char[logLength + 1];
-	fslog[logLength] = '\0';
-	gl::GetShaderInfoLog(fragmentShaderID, logLength, nullptr, fslog);
-	std::cout << fslog << std::endl;
-	delete[] fslog;
-
-	GLuint program = gl::CreateProgram();
-	gl::AttachShader(program, vertexShaderID);
-	gl::AttachShader(program, fragmentShaderID);
-	gl::LinkProgram(program);
-	gl::GetProgramiv(program, gl::LINK_STATUS, &result);
-	gl::GetProgramiv(program, gl::INFO_LOG_LENGTH, &logLength);
-	char *proglog = new char[logLength + 1];
-	proglog[logLength] = '\0';
-	gl::GetProgramInfoLog(program, logLength, nullptr, proglog);
-	std::cout << proglog << std::endl;
-	delete[] proglog;
-
-	gl::DeleteShader(vertexShaderID);
-	gl::DeleteShader(fragmentShaderID);
-
-	return program;
-}
+			// Keep the driver from queueing frames ahead, they only add latency.
+			if (frameLimiter)
+				gl::Finish();
 
-void CreateGrid(void *vboData, size_t &vboOffset, float x, float y, 
-	float width, float height, size_t *linesCount)
-{
-	const uint8_t GRID_COLUMNS = 10;
-	const uint8_t GRID_ROWS = 20;
+			if ((frameLimiter || measureLatency) && windowState.inputTime != 0.0)
+			{
+				// With vsync the swap may return while the frame is still
+				// queued, wait for it so both modes measure the same end point.
+				if (!frameLimiter)
+					gl::Finish();
+
+				double latency = glfwGetTime() - windowState.inputTime;
+				latencySum += latency;
+				latencyMax = std::max(latencyMax, latency);
+				++latencyCount;
+				windowState.inputTime = 0.0;
+			}
+		}
 
-	float dw = width / GRID_COLUMNS;
-	float dh = height / GRID_ROWS;
+		if (debugOutput)
+		{
+			unsigned int warnings = debugOutput->getFrameWarningCount();
 
-	std::vector<Vertex> lines;
+			warningFrames += warnings > 0 ? 1 : 0;
+			maxFrameWarnings = std::max(maxFrameWarnings, warnings);
+			debugOutput->beginFrame();
+		}
 
-	for (uint8_t i = 0; i <= GRID_COLUMNS; i++)
-	{
-		lines.push_back(Vertex{ x + dw * i, y, 0.0f, 0.0f, 1.0f, 1.0f });
-		lines.push_back(Vertex{ x + dw * i, y + height, 0.0f, 0.0f, 1.0f, 1.0f });
+#ifdef TRACK_ALLOCATIONS
+		// Capture and debug output allocate as they go, by design.
+		if (++frameCount > WARMUP_FRAMES && !frameCapture && !debugOutput)
+			assert(GetAllocationCount() == frameAllocations);
+#endif
 	}
 
-	for (uint8_t j = 0; j <= GRID_ROWS; j++)
+	if (frameCapture)
 	{
-		lines.push_back(Vertex{ x, y + j * dh, 0.0f, 0.0f, 1.0f, 1.0f });
-		lines.push_back(Vertex{ x + width, y + j * dh, 0.0f, 0.0f, 1.0f, 1.0f });
+		frameCapture->finish();
+		std::cout << "Captured " << frameCapture->getWrittenFrames() << " of "
+			<< frameCapture->getCapturedFrames() << " frames, dropped "
+			<< frameCapture->getDroppedFrames() << std::endl;
+		frameCapture.reset();
 	}
 
-	memcpy(&((char*)vboData)[vboOffset], lines.data(), lines.size() * sizeof(Vertex));
-	vboOffset += lines.size() * sizeof(Vertex);
-	*linesCount = lines.size();
-
-	return;
-}
-
-size_t PrepareDynamicBuffer(GLuint vbo, Color* table[][10], float x, float y, float width, float height)
-{
-	std::vector<Vertex> vertexData;
-	const uint8_t GRID_COLUMNS = 10;
-	const uint8_t GRID_ROWS = 20;
-
-	y += height; // up to down.
-
-	float dw = width / GRID_COLUMNS;
-	float dh = height / GRID_ROWS;
-
-	for (int i = 2; i < GRID_ROWS + 2; i++)
+	if (headless)
 	{
-		for (int j = 0; j < GRID_COLUMNS; j++)
-		{
-			if (table[i][j] == nullptr) continue;
+		Image frameImage;
+		PNGCodec codec;
 
-			vertexData.push_back(Vertex{ x + dw * j, y - dh * (i - 2), (*table[i][j]).r, (*table[i][j]).g, (*table[i][j]).b, (*table[i][j]).a });
-			vertexData.push_back(Vertex{ x + dw * (j + 1), y - dh * (i - 2), (*table[i][j]).r, (*table[i][j]).g, (*table[i][j]).b, (*table[i][j]).a });
-			vertexData.push_back(Vertex{ x + dw * j, y - dh * (i - 1), (*table[i][j]).r + 0.2f, (*table[i][j]).g + 0.2f, (*table[i][j]).b + 0.2f, (*table[i][j]).a });
-
-			vertexData.push_back(Vertex{ x + dw * j, y - dh * (i - 1), (*table[i][j]).r + 0.2f, (*table[i][j]).g + 0.2f, (*table[i][j]).b + 0.2f, (*table[i][j]).a });
-			vertexData.push_back(Vertex{ x + dw * (j + 1), y - dh * (i - 2), (*table[i][j]).r, (*table[i][j]).g, (*table[i][j]).b, (*table[i][j]).a });
-			vertexData.push_back(Vertex{ x + dw * (j + 1), y - dh * (i - 1), (*table[i][j]).r, (*table[i][j]).g, (*table[i][j]).b, (*table[i][j]).a });
-		}
+		gl::Finish();
+		renderTarget->readPixels(frameImage);
+		frameImage.saveToFile(output + ".png", &codec);
+		renderTarget.reset();
 	}
-	
-	gl::BindBuffer(gl::ARRAY_BUFFER, vbo);
-	void *vboData = gl::MapBuffer(gl::ARRAY_BUFFER, gl::WRITE_ONLY);
-	memcpy(vboData, vertexData.data(), vertexData.size() * sizeof(Vertex));
-	gl::UnmapBuffer(gl::ARRAY_BUFFER);
-
-	return vertexData.size();
-}
 
-size_t CreateLine(GLuint vbo, size_t offset, Color col, float x, float y, float width, float height)
-{
-	std::vector<Vertex> vertexData;
-	void *vboData;
-
-	vertexData.push_back(Vertex{ x, y, col.r, col.g, col.b, col.a });
-	vertexData.push_back(Vertex{ x, y + height, col.r, col.g, col.b, col.a });
-	vertexData.push_back(Vertex{ x + width, y, col.r, col.g, col.b, col.a });
-
-	vertexData.push_back(Vertex{ x, y + height, col.r, col.g, col.b, col.a });
-	vertexData.push_back(Vertex{ x + width, y + height, col.r, col.g, col.b, col.a });
-	vertexData.push_back(Vertex{ x + width, y, col.r, col.g, col.b, col.a });
-
-	gl::BindBuffer(gl::ARRAY_BUFFER, vbo);
-	vboData = gl::MapBufferRange(gl::ARRAY_BUFFER, offset, vertexData.size() * sizeof(Vertex), gl::MAP_WRITE_BIT);
-	memcpy(vboData, vertexData.data(), vertexData.size() * sizeof(Vertex));
-	gl::UnmapBuffer(gl::ARRAY_BUFFER);
-
-	return vertexData.size();
-}
-
-void PlaceTetramino(Color* table[][10], Color* (*tetramino)[4], int32_t x, int32_t y)
-{
-	for (int i = 0; i < 4; i++)
+	if (latencyCount > 0)
 	{
-		for (int j = 0; j < 4; j++)
-		{
-			if (tetramino[i][j] == nullptr)
-				continue;
-
-			table[y + i][x + j] = tetramino[i][j];
-		}
+		std::cout << "Input to present: " << latencySum / latencyCount * 1000.0
+			<< " ms average, " << latencyMax * 1000.0 << " ms max over "
+			<< latencyCount << " key presses" << std::endl;
 	}
-}
 
-void RemoveTetramino(Color* table[][10], Color* (*tetramino)[4], int32_t x, int32_t y)
-{
-	// No error checking.
+	if (!traceFile.empty())
+		Trace::WriteChromeJson(traceFile);
 
-	for (int i = 0; i < 4; i++)
+	if (debugOutput)
 	{
-		for (int j = 0; j < 4; j++)
-		{
-			if (tetramino[i][j] == nullptr)
-				continue;
-
-			table[y + i][x + j] = nullptr;
-		}
+		debugOutput->printSummary();
+		std::cout << warningFrames << " frames with warnings, at most "
+			<< maxFrameWarnings << " in one frame" << std::endl;
+		debugOutput.reset();
 	}
-}
 
-void GetTopCoords(Color* (*tetramino)[4], int32_t *x, int32_t *y)
-{
-	*x = 3;
-	
-	for (int i = 0; i < 4; i++)
-	{
-		for(int j = 0; j < 4; j++) // Columns first!
-		{
-			if (!(tetramino[i][j] == nullptr))
-			{
-				*y = -i;
-				return;
-			}
-		}
-	}
+	glfwDestroyWindow(wnd);
+	glfwTerminate();
+	return 0;
 }
 
-bool CheckCollision(Color* table[][10], Color* (*tetramino)[4], int32_t x, int32_t y)
+int RunSoftware(unsigned int frames, const std::string &output)
 {
-	for (int i = 0; i < 4; i++)
-	{
-		for (int j = 0; j < 4; j++)
-		{
-			if (tetramino[i][j] != nullptr)
-			{
-				if (x + j > 9 || x + j < 0 ||
-					y + i > 21 || y + i < 0)
-					return false;
-
-				if (table[y + i][x + j] != nullptr)
-					return false;
-			}
-		}
-	}
+	Game game(0);
+	GameInput input = {};
+	SoftwareRasterizer rasterizer(WIDTH, HEIGHT);
+	std::vector<Vertex> gridVertexData;
+	std::vector<GLushort> gridIndexData;
+	FrameArena frameArena(FRAME_ARENA_SIZE);
+	FrameVector<Vertex> blockVertexData{ FrameAllocator<Vertex>(frameArena) };
+	Image frameImage;
+	PNGCodec codec;
+
+	CreateGrid(gridVertexData, gridIndexData, GameBoard::COLUMNS, GameBoard::VISIBLE_ROWS,
+		255.0f, 10.0f, 290.0f, 580.0f);
+
+	for (unsigned int i = 0; i < frames; i++)
+		game.update(input);
+
+	game.buildBlockVertices(blockVertexData, 255.0f, 10.0f, 290.0f, 580.0f);
+
+	// Same order as the render queue layers, blocks below the grid.
+	rasterizer.clear(0.8f, 0.8f, 0.8f, 1.0f);
+	rasterizer.drawTriangles(blockVertexData.data(), blockVertexData.size());
+	rasterizer.drawLines(gridVertexData.data(), gridIndexData.data(), gridIndexData.size());
+	rasterizer.copyToImage(frameImage);
+	frameImage.saveToFile(output + ".png", &codec);
 
-	return true;
+	return 0;
 }
 
-void CopyTetramino(Color * (*dst)[4], Color* (*src)[4])
+void OnKey(GLFWwindow *wnd, int key, int scancode, int action, int mods)
 {
-	for (int i = 0; i < 4; i++)
-	{
-		for (int j = 0; j < 4; j++)
-			dst[i][j] = src[i][j];
-	}
+	WindowState *state = reinterpret_cast<WindowState*>(glfwGetWindowUserPointer(wnd));
 
-}
+	if (key == GLFW_KEY_P && action == GLFW_PRESS)
+		state->paused = !state->paused;
 
-void RotateTetraminoRight(Color* (*tetramino)[4])
-{
-	// [0][0] [0][1]  [0][2]  [0][3]
-	// [1][0] [1][1]  [1][2]  [1][3]
-	// [2][0] [2][1]  [2][2]  [2][3]
-	// [3][0] [3][1]  [3][2]  [3][3]
-	Color *tmp;
-	tmp = tetramino[3][0];
-	tetramino[3][0] = tetramino[3][3];
-	tetramino[3][3] = tetramino[0][3];
-	tetramino[0][3] = tetramino[0][0];
-	tetramino[0][0] = tmp;
-
-	tmp = tetramino[2][0];
-	tetramino[2][0] = tetramino[3][2];
-	tetramino[3][2] = tetramino[1][3];
-	tetramino[1][3] = tetramino[0][1];
-	tetramino[0][1] = tmp;
-
-	tmp = tetramino[1][0];
-	tetramino[1][0] = tetramino[3][1];
-	tetramino[3][1] = tetramino[2][3];
-	tetramino[2][3] = tetramino[0][2];
-	tetramino[0][2] = tmp;
-
-	tmp = tetramino[2][1];
-	tetramino[2][1] = tetramino[2][2];
-	tetramino[2][2] = tetramino[1][2];
-	tetramino[1][2] = tetramino[1][1];
-	tetramino[1][1] = tmp;
+	if (action == GLFW_PRESS && state->inputTime == 0.0)
+		state->inputTime = glfwGetTime();
+
+	state->redraw = true;
 }
 
-void RotateTetraminoLeft(Color* (*tetramino)[4])
+void OnWindowRefresh(GLFWwindow *wnd)
 {
-	// [0][0] [0][1]  [0][2]  [0][3]
-	// [1][0] [1][1]  [1][2]  [1][3]
-	// [2][0] [2][1]  [2][2]  [2][3]
-	// [3][0] [3][1]  [3][2]  [3][3]
-	Color *tmp;
-	tmp = tetramino[3][0];
-	tetramino[3][0] = tetramino[0][0];
-	tetramino[0][0] = tetramino[0][3];
-	tetramino[0][3] = tetramino[3][3];
-	tetramino[3][3] = tmp;
-
-	tmp = tetramino[2][0];
-	tetramino[2][0] = tetramino[0][1];
-	tetramino[0][1] = tetramino[1][3];
-	tetramino[1][3] = tetramino[3][2];
-	tetramino[3][2] = tmp;
-
-	tmp = tetramino[1][0];
-	tetramino[1][0] = tetramino[0][2];
-	tetramino[0][2] = tetramino[2][3];
-	tetramino[2][3] = tetramino[3][1];
-	tetramino[3][1] = tmp;
-
-	tmp = tetramino[2][1];
-	tetramino[2][1] = tetramino[1][1];
-	tetramino[1][1] = tetramino[1][2];
-	tetramino[1][2] = tetramino[2][2];
-	tetramino[2][2] = tmp;
-
-	// [0][3] [1][3] [2][3] [3][3]
-	// [0][2] [1][2] [2][2] [3][2]
-	// [0][1] [1][1] [2][1] [3][1]
-	// [0][0] [1][0] [2][0] [3][0]
+	WindowState *state = reinterpret_cast<WindowState*>(glfwGetWindowUserPointer(wnd));
+	state->redraw = true;
 }
 
-void LookForLines(Color* table[][10], int32_t indices[4])
+void OnWindowFocus(GLFWwindow *wnd, int focused)
 {
-	int index = 0;
-	const uint8_t GRID_COLUMNS = 10;
-	const uint8_t GRID_ROWS = 20;
-	bool fullLine = true;
-
-	for (int i = 0; i < 4; i++)
-		indices[i] = -1;
-
-	for (int i = 2; i < GRID_ROWS + 2; i++)
-	{
-		for (int j = 0; j < GRID_COLUMNS; j++)
-		{
-			if (table[i][j] == nullptr)
-			{
-				fullLine = false;
-				break;
-			}
-		}
+	WindowState *state = reinterpret_cast<WindowState*>(glfwGetWindowUserPointer(wnd));
 
-		if (fullLine == true)
-		{
-			if (index > 3) return;
+	if (focused == GLFW_FALSE)
+		state->paused = true;
 
-			indices[index] = i;
-			index++;
-		}
-
-		fullLine = true;
-	}
+	state->redraw = true;
 }
 
-void RemoveLine(Color* table[][10], uint32_t index)
+void OnWindowIconify(GLFWwindow *wnd, int iconified)
 {
-	const uint8_t GRID_COLUMNS = 10;
-	const uint8_t GRID_ROWS = 20;
+	WindowState *state = reinterpret_cast<WindowState*>(glfwGetWindowUserPointer(wnd));
 
-	for (int i = index - 1; i >= 0; i--)
-	{
-		for (int j = 0; j < GRID_COLUMNS; j++)
-			table[i + 1][j] = table[i][j];
-	}
+	if (iconified == GLFW_TRUE)
+		state->paused = true;
 
-	for (int j = 0; j < GRID_COLUMNS; j++)
-		table[0][j] = nullptr;
+	state->redraw = true;
 }
-